@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+#include <modm/driver/storage/block_device_file.hpp>
+#include <modm/driver/storage/block_device_cache.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// Set the log level
+#undef	MODM_LOG_LEVEL
+#define	MODM_LOG_LEVEL modm::log::INFO
+
+/**
+ * Replays a sector access trace of a FAT file system against a file block
+ * device with and without a cache in front of it and compares the run time.
+ *
+ * The trace is either read from a file given as the first argument, with
+ * one access `r|w <sector> <count>` per line, or synthesized to resemble
+ * FatFS writing and reading back a number of files: The FAT and directory
+ * sectors are reread and rewritten for every cluster, while the file data
+ * is accessed sector by sector.
+ */
+
+constexpr uint32_t SectorSize = 512;
+constexpr uint32_t MemorySize = 8*1024*1024;
+
+struct Access
+{
+	bool write;
+	uint32_t sector;
+	uint32_t count;
+};
+
+struct UncachedFile {
+	static constexpr const char* name = "uncached.bin~";
+};
+struct CachedFile {
+	static constexpr const char* name = "cached.bin~";
+};
+
+std::vector<Access>
+synthesizeTrace()
+{
+	constexpr uint32_t FatBegin = 1;
+	constexpr uint32_t DirectoryBegin = FatBegin + 64;
+	constexpr uint32_t DataBegin = DirectoryBegin + 32;
+	constexpr uint32_t SectorsPerCluster = 8;
+	constexpr uint32_t Files = 64;
+
+	std::vector<Access> trace;
+	uint32_t nextCluster{0};
+	uint32_t firstCluster[Files];
+	uint32_t clusters[Files];
+	uint32_t seed{1};
+
+	for (uint32_t file = 0; file < Files; file++)
+	{
+		seed = seed * 1103515245 + 12345;
+		clusters[file] = 1 + (seed >> 16) % 24;
+		firstCluster[file] = nextCluster;
+		const uint32_t directory = DirectoryBegin + file / 16;
+		trace.push_back({false, directory, 1});
+		trace.push_back({true, directory, 1});
+		for (uint32_t cluster = nextCluster; cluster < nextCluster + clusters[file]; cluster++)
+		{
+			// allocate the cluster in the FAT
+			trace.push_back({false, FatBegin + cluster / 256, 1});
+			trace.push_back({true, FatBegin + cluster / 256, 1});
+			for (uint32_t sector = 0; sector < SectorsPerCluster; sector++) {
+				trace.push_back({true, DataBegin + cluster * SectorsPerCluster + sector, 1});
+			}
+		}
+		nextCluster += clusters[file];
+		// update the file size in the directory entry
+		trace.push_back({false, directory, 1});
+		trace.push_back({true, directory, 1});
+	}
+
+	for (uint32_t file = 0; file < Files; file++)
+	{
+		trace.push_back({false, DirectoryBegin + file / 16, 1});
+		for (uint32_t cluster = firstCluster[file]; cluster < firstCluster[file] + clusters[file]; cluster++)
+		{
+			// follow the cluster chain
+			trace.push_back({false, FatBegin + cluster / 256, 1});
+			for (uint32_t sector = 0; sector < SectorsPerCluster; sector++) {
+				trace.push_back({false, DataBegin + cluster * SectorsPerCluster + sector, 1});
+			}
+		}
+	}
+	return trace;
+}
+
+std::vector<Access>
+loadTrace(const char* filename)
+{
+	std::vector<Access> trace;
+	std::ifstream file(filename);
+	char type;
+	Access access;
+	while (file >> type >> access.sector >> access.count)
+	{
+		access.write = (type == 'w');
+		if (access.count and (access.sector + access.count) * SectorSize <= MemorySize) {
+			trace.push_back(access);
+		}
+	}
+	return trace;
+}
+
+template <class Device>
+double
+replay(Device& device, const std::vector<Access>& trace)
+{
+	static uint8_t buffer[64*SectorSize];
+	const auto start = std::chrono::steady_clock::now();
+	for (const Access& access : trace)
+	{
+		for (uint32_t offset = 0; offset < access.count; offset += 64)
+		{
+			const uint32_t size = std::min<uint32_t>(access.count - offset, 64) * SectorSize;
+			const uint32_t address = (access.sector + offset) * SectorSize;
+			if (access.write)
+			{
+				std::memset(buffer, uint8_t(access.sector), size);
+				if (not device.program(buffer, address, size)) {
+					MODM_LOG_INFO << "Error: Unable to program data." << modm::endl;
+					exit(1);
+				}
+			}
+			else if (not device.read(buffer, address, size)) {
+				MODM_LOG_INFO << "Error: Unable to read data." << modm::endl;
+				exit(1);
+			}
+		}
+	}
+	if constexpr (requires { device.flush(); }) {
+		if (not device.flush()) {
+			MODM_LOG_INFO << "Error: Unable to flush cache." << modm::endl;
+			exit(1);
+		}
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int
+main(int argc, char* argv[])
+{
+	const std::vector<Access> trace = (argc > 1) ? loadTrace(argv[1]) : synthesizeTrace();
+	MODM_LOG_INFO << "Replaying " << trace.size() << " sector accesses" << modm::endl;
+
+	// create empty files
+	std::ofstream(UncachedFile::name).close();
+	std::ofstream(CachedFile::name).close();
+
+	modm::BdFile<UncachedFile, MemorySize> uncached;
+	modm::BdCache<modm::BdFile<CachedFile, MemorySize>, 16, 4096> cached;
+	if (not uncached.initialize() or not cached.initialize()) {
+		MODM_LOG_INFO << "Error: Unable to initialize device." << modm::endl;
+		exit(1);
+	}
+
+	const double uncachedTime = replay(uncached, trace);
+	const double cachedTime = replay(cached, trace);
+	uncached.deinitialize();
+	cached.deinitialize();
+
+	const auto& statistics = cached.getStatistics();
+	MODM_LOG_INFO.printf("uncached: %9.2f ms\n", uncachedTime);
+	MODM_LOG_INFO.printf("cached:   %9.2f ms (%.2fx)\n", cachedTime, uncachedTime / cachedTime);
+	MODM_LOG_INFO.printf("hits: %lu, misses: %lu, read-aheads: %lu, write-backs: %lu\n",
+			(unsigned long) statistics.hits, (unsigned long) statistics.misses,
+			(unsigned long) statistics.readAheads, (unsigned long) statistics.writeBacks);
+
+	// both devices must end up with the same content
+	std::ifstream a(UncachedFile::name, std::ios::binary), b(CachedFile::name, std::ios::binary);
+	if (not std::equal(std::istreambuf_iterator<char>(a), std::istreambuf_iterator<char>(),
+					   std::istreambuf_iterator<char>(b), std::istreambuf_iterator<char>()))
+	{
+		MODM_LOG_INFO << "Error: Cached content differs." << modm::endl;
+		exit(1);
+	}
+	MODM_LOG_INFO << "Finished!" << modm::endl;
+
+	return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+#include <modm/driver/storage/block_device_file.hpp>
+#include <modm/driver/storage/block_device_mapped_file.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+// Set the log level
+#undef	MODM_LOG_LEVEL
+#define	MODM_LOG_LEVEL modm::log::INFO
+
+/**
+ * Compares the throughput of `modm::BdFile` and `modm::BdMappedFile` for
+ * small block accesses and checks the NOR flash simulation of the latter.
+ */
+
+constexpr uint32_t BlockSize = 64;
+constexpr uint32_t MemorySize = 4*1024*1024;
+
+struct StreamFile {
+	static constexpr const char* name = "stream.bin~";
+};
+struct MappedFile {
+	static constexpr const char* name = "mapped.bin~";
+};
+struct FlashFile {
+	static constexpr const char* name = "flash.bin~";
+};
+
+template <class Device>
+double
+benchmark(Device& device)
+{
+	uint8_t pattern[BlockSize];
+	uint8_t buffer[BlockSize];
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t iteration = 0; iteration < 4; iteration++)
+	{
+		std::memset(pattern, iteration, BlockSize);
+		for (uint32_t address = 0; address < MemorySize; address += BlockSize)
+		{
+			if (not device.write(pattern, address, BlockSize)) {
+				MODM_LOG_INFO << "Error: Unable to write data." << modm::endl;
+				exit(1);
+			}
+		}
+		for (uint32_t address = 0; address < MemorySize; address += BlockSize)
+		{
+			if (not device.read(buffer, address, BlockSize) or std::memcmp(buffer, pattern, BlockSize)) {
+				MODM_LOG_INFO << "Error: Unable to read data." << modm::endl;
+				exit(1);
+			}
+		}
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int
+main()
+{
+	// create empty files
+	std::ofstream(StreamFile::name).close();
+	std::ofstream(MappedFile::name).close();
+	std::ofstream(FlashFile::name).close();
+
+	modm::BdFile<StreamFile, MemorySize> stream;
+	modm::BdMappedFile<MappedFile, MemorySize> mapped;
+	if (not stream.initialize() or not mapped.initialize()) {
+		MODM_LOG_INFO << "Error: Unable to initialize device." << modm::endl;
+		exit(1);
+	}
+	mapped.advise(decltype(mapped)::Advice::Sequential);
+
+	const double streamTime = benchmark(stream);
+	const double mappedTime = benchmark(mapped);
+	MODM_LOG_INFO.printf("BdFile:       %9.2f ms\n", streamTime);
+	MODM_LOG_INFO.printf("BdMappedFile: %9.2f ms (%.1fx)\n", mappedTime, streamTime / mappedTime);
+	stream.deinitialize();
+	mapped.deinitialize();
+
+	// NOR flash with 4kB erase blocks, every change is synchronized to the file
+	modm::BdMappedFile<FlashFile, 64*1024, modm::BdSync::OnWrite, 4096> flash;
+	if (not flash.initialize() or flash.getMemory()[0] != 0xff) {
+		MODM_LOG_INFO << "Error: Flash is not erased after creation." << modm::endl;
+		exit(1);
+	}
+	const uint8_t first[] = {0xf0};
+	const uint8_t second[] = {0x0f};
+	flash.program(first, 0, 1);
+	flash.program(second, 0, 1);
+	if (flash.getMemory()[0] != 0x00) {
+		MODM_LOG_INFO << "Error: Programming must only clear bits." << modm::endl;
+		exit(1);
+	}
+	if (flash.erase(0, 1024) or not flash.erase(0, 4096) or flash.getMemory()[0] != 0xff) {
+		MODM_LOG_INFO << "Error: Erasing must set whole blocks." << modm::endl;
+		exit(1);
+	}
+	flash.program(first, 100, 1);
+	flash.deinitialize();
+
+	std::ifstream file(FlashFile::name, std::ios::binary);
+	file.seekg(100);
+	if (file.get() != 0xf0) {
+		MODM_LOG_INFO << "Error: Data was not written to the file." << modm::endl;
+		exit(1);
+	}
+
+	MODM_LOG_INFO << "Finished!" << modm::endl;
+
+	return 0;
+}
@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+#include <modm/driver/storage/block_device_spistack_flash.hpp>
+#include <modm/driver/storage/block_device_mirror.hpp>
+#include <cstring>
+#include <vector>
+
+// Set the log level
+#undef	MODM_LOG_LEVEL
+#define	MODM_LOG_LEVEL modm::log::INFO
+
+/**
+ * Simulates stacked SPI flash dies with modeled SPI transfer and busy times
+ * to compare the throughput of the linear and striped `modm::BdSpiStackFlash`
+ * layouts and of `modm::BdMirror`.
+ *
+ * The sequential reference waits for every command to finish before issuing
+ * the next one, so no two dies are ever busy at the same time.
+ *
+ * The die select sequence of `modm::BdSpiFlash` (SDS, wait, WE, GBU, wait) is
+ * measured separately, since pipelined and striped jobs change the die much
+ * more often than linear jobs.
+ */
+
+/// Virtual time in nanoseconds
+static uint64_t now{0};
+
+/// Time spent selecting dies, including waiting for the selected die
+struct SelectStatistics
+{
+	uint32_t count;
+	uint64_t time;
+	uint64_t waiting;
+};
+static SelectStatistics selects{};
+
+template <uint8_t Id, bool Sequential, uint8_t Dies = 1, uint32_t DieSize = 1024*1024>
+class SimulatedFlash : public modm::BlockDevice, protected modm::NestedResumable<3>
+{
+	// 50 MHz SPI clock and typical timings of a W25M stacked die flash
+	static constexpr uint64_t ByteTime = 160;
+	static constexpr uint64_t CommandTime = 1'000;
+	static constexpr uint64_t ProgramTime = 700'000;
+	static constexpr uint64_t SectorEraseTime = 45'000'000;
+	static constexpr uint64_t ChipEraseTime = 2'000'000'000;
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 256;
+	static constexpr bd_size_t BlockSizeErase = 4 * 1024;
+	static constexpr bd_size_t DeviceSize = DieSize;
+
+	modm::ResumableResult<bool>
+	initialize()
+	{
+		RF_BEGIN();
+		memory.assign(Dies * DieSize, 0xff);
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	deinitialize()
+	{
+		RF_BEGIN();
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		RF_BEGIN();
+		wait();
+		transfer(5 + size);
+		std::memcpy(buffer, &memory[die * DieSize + address], size);
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		RF_BEGIN();
+		for (bd_size_t index = 0; index < size; index += BlockSizeWrite)
+		{
+			wait();
+			transfer(1);
+			transfer(4 + BlockSizeWrite);
+			for (bd_size_t ii = 0; ii < BlockSizeWrite; ii++) {
+				memory[die * DieSize + address + index + ii] &= buffer[index + ii];
+			}
+			busy(ProgramTime);
+		}
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size)
+	{
+		RF_BEGIN();
+		if (address == 0 and size == DieSize)
+		{
+			wait();
+			transfer(1);
+			busy(ChipEraseTime);
+		}
+		else for (bd_size_t index = 0; index < size; index += BlockSizeErase)
+		{
+			wait();
+			transfer(1);
+			transfer(4);
+			busy(SectorEraseTime);
+		}
+		std::memset(&memory[die * DieSize + address], 0xff, size);
+		RF_END_RETURN(true);
+	}
+
+	modm::ResumableResult<void>
+	selectDie(uint8_t selected)
+	{
+		RF_BEGIN();
+		const uint64_t start = now;
+		transfer(2);
+		die = selected;
+		selects.waiting += wait();
+		transfer(1);
+		transfer(1);
+		selects.waiting += wait();
+		selects.time += now - start;
+		selects.count++;
+		RF_END();
+	}
+
+	modm::ResumableResult<bool>
+	isBusy()
+	{
+		RF_BEGIN();
+		transfer(2);
+		RF_END_RETURN(now < busyUntil[die]);
+	}
+
+private:
+	static void
+	transfer(bd_size_t bytes)
+	{ now += CommandTime + bytes * ByteTime; }
+
+	/// @return the time waited for the die to become idle
+	uint64_t
+	wait()
+	{
+		// poll the status register until the die is idle
+		const uint64_t waited = (busyUntil[die] > now) ? busyUntil[die] - now : 0;
+		now += waited;
+		transfer(2);
+		return waited;
+	}
+
+	void
+	busy(uint64_t duration)
+	{
+		busyUntil[die] = now + duration;
+		if constexpr (Sequential) wait();
+	}
+
+	std::vector<uint8_t> memory;
+	uint64_t busyUntil[Dies]{};
+	uint8_t die{0};
+};
+
+constexpr uint8_t DieCount = 4;
+
+template <class Device>
+void
+benchmark(const char* name, uint32_t address, uint32_t size)
+{
+	static Device device;
+	static std::vector<uint8_t> pattern, buffer;
+	pattern.resize(size);
+	buffer.resize(size);
+	for (uint32_t ii = 0; ii < size; ii++) pattern[ii] = ii * 7 + ii / 256;
+
+	if (not device.initialize()) {
+		MODM_LOG_INFO << "Error: Unable to initialize device." << modm::endl;
+		exit(1);
+	}
+	selects = {};
+	uint64_t start = now;
+	if (not device.write(pattern.data(), address, size)) {
+		MODM_LOG_INFO << "Error: Unable to write data." << modm::endl;
+		exit(1);
+	}
+	device.waitWhileBusy();
+	const uint64_t duration = now - start;
+	const SelectStatistics writeSelects = selects;
+
+	selects = {};
+	start = now;
+	if (not device.read(buffer.data(), address, size) or pattern != buffer) {
+		MODM_LOG_INFO << "Error: Unable to read back data." << modm::endl;
+		exit(1);
+	}
+	const uint64_t readDuration = now - start;
+	const SelectStatistics readSelects = selects;
+
+	MODM_LOG_INFO.printf("%-26s %5lu kB in %8.1f ms: %7.1f kB/s, read %7.1f kB/s\n", name,
+			(unsigned long) size / 1024, duration / 1e6, size / 1.024 / (duration / 1e6),
+			size / 1.024 / (readDuration / 1e6));
+	if (writeSelects.count or readSelects.count)
+	{
+		MODM_LOG_INFO.printf("%-26s write: %5lu selects in %6.1f ms (%4.1f%%, %6.1f ms waiting), "
+				"read: %4lu selects in %5.2f ms (%4.1f%%)\n", "",
+				(unsigned long) writeSelects.count, writeSelects.time / 1e6,
+				100.0 * writeSelects.time / duration, writeSelects.waiting / 1e6,
+				(unsigned long) readSelects.count, readSelects.time / 1e6,
+				100.0 * readSelects.time / readDuration);
+	}
+}
+
+/// Adds `waitWhileBusy()` to the mirror of two simulated devices
+template <class Mirror>
+struct WaitingMirror : public Mirror
+{
+	void
+	waitWhileBusy()
+	{
+		while (this->getBlockDeviceA().isBusy() or this->getBlockDeviceB().isBusy()) {}
+	}
+};
+
+int
+main()
+{
+	constexpr uint32_t Small = 128 * 1024;
+	constexpr uint32_t Large = 4 * 1024 * 1024;
+
+	MODM_LOG_INFO.printf("Stack of %u dies, sequential job:\n", DieCount);
+	benchmark<modm::BdSpiStackFlash<SimulatedFlash<0, true, DieCount>, DieCount>>("  sequential", 0, Small);
+	benchmark<modm::BdSpiStackFlash<SimulatedFlash<1, false, DieCount>, DieCount>>("  linear, pipelined", 0, Small);
+	benchmark<modm::BdSpiStackFlash<SimulatedFlash<2, false, DieCount>, DieCount, true>>("  striped, pipelined", 0, Small);
+
+	MODM_LOG_INFO.printf("Stack of %u dies, whole device:\n", DieCount);
+	benchmark<modm::BdSpiStackFlash<SimulatedFlash<3, true, DieCount>, DieCount>>("  sequential", 0, Large);
+	benchmark<modm::BdSpiStackFlash<SimulatedFlash<4, false, DieCount>, DieCount>>("  linear, pipelined", 0, Large);
+	benchmark<modm::BdSpiStackFlash<SimulatedFlash<5, false, DieCount>, DieCount, true>>("  striped, pipelined", 0, Large);
+
+	MODM_LOG_INFO << "Mirror of two devices:" << modm::endl;
+	benchmark<WaitingMirror<modm::BdMirror<SimulatedFlash<6, true>, SimulatedFlash<7, true>>>>("  sequential", 0, Small);
+	benchmark<WaitingMirror<modm::BdMirror<SimulatedFlash<8, false>, SimulatedFlash<9, false>>>>("  concurrent", 0, Small);
+
+	MODM_LOG_INFO << "Finished!" << modm::endl;
+	return 0;
+}
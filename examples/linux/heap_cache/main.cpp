@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/platform.hpp>
+#include <modm/driver/storage/size_class_cache.hpp>
+#include <tlsf/tlsf.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// Same memory for both allocators, the cache takes its arena from TLSF
+alignas(16) uint8_t memory[256 * 1024];
+constexpr std::size_t CacheSize{32 * 1024};
+constexpr uint32_t Operations{1'000'000};
+constexpr std::size_t Live{512};
+
+tlsf_t tlsf;
+modm::SizeClassCache<> cache;
+
+struct TlsfHeap
+{
+	static void* allocate(std::size_t size) { return tlsf_malloc(tlsf, size); }
+	static void free(void* ptr) { tlsf_free(tlsf, ptr); }
+};
+
+struct CachedHeap
+{
+	static void*
+	allocate(std::size_t size)
+	{
+		if (void* ptr = cache.allocate(size)) return ptr;
+		return tlsf_malloc(tlsf, size);
+	}
+	static void
+	free(void* ptr)
+	{
+		if (not cache.free(ptr)) tlsf_free(tlsf, ptr);
+	}
+};
+
+struct SystemHeap
+{
+	static void* allocate(std::size_t size) { return std::malloc(size); }
+	static void free(void* ptr) { std::free(ptr); }
+};
+
+/// Replaces random live blocks with mostly small, sometimes large blocks,
+/// like list nodes, shared pointers and std::function captures do.
+template< class Heap >
+double
+measure()
+{
+	void* blocks[Live]{};
+	uint32_t random{0x12345678};
+	const auto start = std::chrono::steady_clock::now();
+	for (uint32_t ii = 0; ii < Operations; ii++)
+	{
+		random = random * 1664525 + 1013904223;
+		void*& block = blocks[(random >> 8) % Live];
+		if (block) Heap::free(block);
+		const std::size_t size = (random >> 24) < 16 ? 64 + (random & 0x1ff) : 4 + (random & 0x3c);
+		block = Heap::allocate(size);
+	}
+	const auto duration = std::chrono::steady_clock::now() - start;
+	for (void* block : blocks) if (block) Heap::free(block);
+	return std::chrono::duration<double, std::nano>(duration).count() / Operations;
+}
+
+int
+main()
+{
+	tlsf = tlsf_create_with_pool(memory, sizeof(memory));
+	uint8_t* arena = static_cast<uint8_t*>(tlsf_malloc(tlsf, CacheSize));
+	cache.initialize(arena, arena + CacheSize);
+
+	std::printf("%u allocations with %u live blocks:\n", unsigned(Operations), unsigned(Live));
+	std::printf("%-12s %6.1f ns per allocation and free\n", "system", measure<SystemHeap>());
+	std::printf("%-12s %6.1f ns per allocation and free\n", "tlsf", measure<TlsfHeap>());
+	std::printf("%-12s %6.1f ns per allocation and free\n", "cache+tlsf", measure<CachedHeap>());
+
+	std::printf("\nclass  size  allocations  misses  peak  pages\n");
+	for (std::size_t ii = 0; ii < 8; ii++)
+	{
+		const auto& stats = cache.getStatistics(ii);
+		std::printf("%5u %5u %12lu %7lu %5u %6u\n", unsigned(ii), unsigned((ii + 1) * 8),
+					(unsigned long)stats.allocations, (unsigned long)stats.misses,
+					stats.peak, stats.pages);
+	}
+	std::printf("free pages: %u/%u, fragmentation: %u bytes\n",
+				unsigned(cache.getFreePageCount()), unsigned(cache.getPageCount()),
+				unsigned(cache.getFragmentedSize()));
+	return 0;
+}
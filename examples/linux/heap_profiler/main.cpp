@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+#include <modm/debug/heap/profiler.hpp>
+#include <cstdlib>
+#include <vector>
+
+// Symbolize the output with:
+//   python3 -m modm_tools.heap build/linux/heap_profiler/scons-release/heap_profiler.elf output.txt
+
+__attribute__((noinline)) void *
+leak()
+{
+	return std::malloc(100);
+}
+
+int
+main()
+{
+	void *leaked = leak();
+	auto *values = new std::vector<int>(50);
+	char *buffer = new char[1000];
+	delete[] buffer;
+
+	void *blocks[20];
+	for (auto &block : blocks) block = std::malloc(8);
+	for (auto &block : blocks) std::free(block);
+
+	modm::HeapProfiler::dump(MODM_LOG_INFO);
+
+	std::free(leaked);
+	delete values;
+
+	const modm::HeapProfile &profile = modm::HeapProfiler::getProfile();
+	for (const auto &pool : profile.pool)
+	{
+		if (pool.live) {
+			MODM_LOG_ERROR << "Leaked " << pool.bytes << " bytes!" << modm::endl;
+			return 1;
+		}
+	}
+	MODM_LOG_INFO << "No leaks." << modm::endl;
+	return 0;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/platform.hpp>
+#include <modm/debug/logger.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/// Counts the bytes instead of transmitting them, optionally copies them to a file
+class CountingDevice : public modm::IODevice
+{
+public:
+	using IODevice::write;
+
+	void
+	write(char c) override
+	{
+		count++;
+		if (file) std::fputc(c, file);
+	}
+
+	void
+	flush() override {}
+
+	bool
+	read(char&) override
+	{ return false; }
+
+	std::size_t count{0};
+	FILE* file{nullptr};
+};
+
+CountingDevice textDevice;
+CountingDevice recordDevice;
+modm::log::Logger textLogger(textDevice);
+
+modm::log::RecordBuffer<4096> recordBuffer;
+modm::log::DeferredLogger modm::log::deferred(recordBuffer);
+
+constexpr uint32_t Statements{100'000};
+
+struct Measurement
+{
+	double nanoseconds;
+	double cycles;
+};
+
+template< typename Function >
+Measurement
+measure(Function&& function)
+{
+	const auto start = std::chrono::steady_clock::now();
+#if defined(__x86_64__) || defined(__i386__)
+	const uint64_t cycles = __rdtsc();
+#endif
+	for (uint32_t ii = 0; ii < Statements; ii++) function(ii);
+	Measurement result{};
+#if defined(__x86_64__) || defined(__i386__)
+	result.cycles = double(__rdtsc() - cycles) / Statements;
+#endif
+	result.nanoseconds = std::chrono::duration<double, std::nano>(
+			std::chrono::steady_clock::now() - start).count() / Statements;
+	return result;
+}
+
+int
+main(int argc, char* argv[])
+{
+	// Pass a file name to store the deferred records for `python3 -m modm_tools.log`
+	if (argc > 1) recordDevice.file = std::fopen(argv[1], "wb");
+	const char* const states[] = {"idle", "running", "error"};
+
+	const auto text = measure([&](uint32_t ii)
+	{
+		textLogger.printf("adc=%u temperature=%.2f state=%s\n",
+						  unsigned(ii & 0xfff), 20.f + ii * 1e-4f, states[ii % 3]);
+	});
+	const std::size_t textBytes = std::exchange(textDevice.count, 0);
+	const auto stream = measure([&](uint32_t ii)
+	{
+		textLogger << "adc=" << (ii & 0xfff) << " temperature=" << 20.f + ii * 1e-4f
+				   << " state=" << states[ii % 3] << modm::endl;
+	});
+	// the statements only copy into the buffer, formatting happens on the host
+	const auto deferred = measure([&](uint32_t ii)
+	{
+		MODM_DLOG_INFO("adc=%u temperature=%.2f state=%s\n",
+					   unsigned(ii & 0xfff), 20.f + ii * 1e-4f, states[ii % 3]);
+		if (recordBuffer.getFree() < 256) recordBuffer.drain(recordDevice);
+	});
+	recordBuffer.drain(recordDevice);
+	if (recordDevice.file) std::fclose(recordDevice.file);
+
+	const auto report = [](const char* name, const Measurement& measurement, std::size_t bytes)
+	{
+		std::printf("%-10s %6.1f bytes %8.1f ns %8.1f cycles per statement\n", name,
+					double(bytes) / Statements, measurement.nanoseconds, measurement.cycles);
+	};
+	std::printf("%u statements:\n", unsigned(Statements));
+	report("printf", text, textBytes);
+	report("stream", stream, textDevice.count);
+	report("deferred", deferred, recordDevice.count);
+
+	return 0;
+}
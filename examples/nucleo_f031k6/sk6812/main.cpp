@@ -17,7 +17,8 @@
 using namespace Board;
 
 using Output = Board::D11;
-modm::Sk6812w<SpiMaster1, Output, 8*8> leds;
+using Spi = SpiMaster1_Dma<Dma1::Channel2, Dma1::Channel3>;
+modm::Sk6812w<Spi, Output, 8*8> leds;
 modm::ShortPeriodicTimer tmr{33ms};
 
 int
@@ -25,6 +26,7 @@ main()
 {
 	Board::initialize();
 	LedD13::setOutput();
+	Dma1::enable();
 	leds.initialize<Board::SystemClock>();
 
 	constexpr uint8_t max = 62;
@@ -42,7 +44,7 @@ main()
 			if (g++ >= max) g = 0;
 			if (b++ >= max) b = 0;
 		}
-		leds.write();
+		RF_CALL_BLOCKING(leds.write());
 
 		while(not tmr.execute()) ;
 		LedD13::toggle();
@@ -17,7 +17,8 @@
 using namespace Board;
 
 using Output = Board::D11;
-modm::Ws2812b<SpiMaster1, Output, 8*8> leds;
+using Spi = SpiMaster1_Dma<Dma2::Channel0, Dma2::Channel3>;
+modm::Ws2812b<Spi, Output, 8*8> leds;
 modm::ShortPeriodicTimer tmr{33ms};
 
 int
@@ -25,6 +26,7 @@ main()
 {
 	Board::initialize();
 	LedD13::setOutput();
+	Dma2::enable();
 	leds.initialize<Board::SystemClock>();
 
 	constexpr uint8_t max = 62;
@@ -42,7 +44,7 @@ main()
 			if (g++ >= max) g = 0;
 			if (b++ >= max) b = 0;
 		}
-		leds.write();
+		RF_CALL_BLOCKING(leds.write());
 
 		while(not tmr.execute()) ;
 		LedD13::toggle();
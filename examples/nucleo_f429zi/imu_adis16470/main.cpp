@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2022, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -110,31 +111,32 @@ main()
 		MODM_LOG_INFO << "Unable to USER_SCR1 register." << modm::endl;
 	}
 
-	std::array<uint16_t, 11> data;
+	modm::adis16470::BurstQueue<16> queue;
+	modm::adis16470::Sample samples[16];
 
 	while (true)
 	{
-		MODM_LOG_INFO.printf("\nIMU data: ");
-
-		while (!Dr::read()) {}
-		while (Dr::read()) {}
-
-		if( !imu.readRegisterBurst(data)) {
-			MODM_LOG_INFO.printf("checksum mismatch! ");
-			Board::LedRed::toggle();
+		// Collect a block of bursts
+		while (queue.getSize() < 10)
+		{
+			if (!imu.readBurst<Dr>(queue)) {
+				Board::LedRed::toggle();
+			}
 		}
 
-		// print data anyways
-		MODM_LOG_INFO.printf("DIAG_STAT=%05u, ", data[1]);
-		MODM_LOG_INFO.printf("X_GYRO_OUT=%+05i, ", static_cast<int16_t>(data[2]));
-		MODM_LOG_INFO.printf("Y_GYRO_OUT=%+05i, ", static_cast<int16_t>(data[3]));
-		MODM_LOG_INFO.printf("Z_GYRO_OUT=%+05i, ", static_cast<int16_t>(data[4]));
-		MODM_LOG_INFO.printf("X_ACCL_OUT=%+05i, ", static_cast<int16_t>(data[5]));
-		MODM_LOG_INFO.printf("Y_ACCL_OUT=%+05i, ", static_cast<int16_t>(data[6]));
-		MODM_LOG_INFO.printf("Z_ACCL_OUT=%+05i, ", static_cast<int16_t>(data[7]));
-		MODM_LOG_INFO.printf("TEMP_OUT=%+05i (1/10 C), ", data[8]);
-		MODM_LOG_INFO.printf("DATA_CNTR=%05u, ", data[9]);
-		MODM_LOG_INFO.printf("checksum=%05u", data[10]);
+		const size_t count = modm::adis16470::convert(queue.front(), samples);
+		queue.pop(count);
+
+		for (const auto& sample : std::span{samples, count})
+		{
+			MODM_LOG_INFO << "\nIMU data: " << sample.diagStat;
+			MODM_LOG_INFO.printf(", DATA_CNTR=%05u", sample.counter);
+			MODM_LOG_INFO.printf(", gyro=(%+.3f, %+.3f, %+.3f) rad/s",
+					sample.angularRate[0], sample.angularRate[1], sample.angularRate[2]);
+			MODM_LOG_INFO.printf(", accel=(%+.3f, %+.3f, %+.3f) m/s^2",
+					sample.acceleration[0], sample.acceleration[1], sample.acceleration[2]);
+			MODM_LOG_INFO.printf(", temp=%.1f C", sample.temperature);
+		}
 
 		Board::LedGreen::toggle();
 	}
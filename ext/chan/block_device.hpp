@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "ff.h"
+#include "diskio.h"
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/architecture/interface/fiber.hpp>
+#include <modm/architecture/interface/memory.hpp>
+#include <modm/processing/resumable.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace modm::fatfs
+{
+
+/**
+ * Physical drive accessed by the FatFs `disk_*()` functions.
+ *
+ * The functions follow the FatFs disk I/O interface, but without the drive
+ * number, which is resolved by `registerDisk()`.
+ *
+ * @ingroup modm_fatfs_block_device
+ */
+class Disk
+{
+public:
+	virtual DSTATUS
+	initialize() = 0;
+
+	virtual DSTATUS
+	status() = 0;
+
+	virtual DRESULT
+	read(BYTE *buffer, LBA_t sector, UINT count) = 0;
+
+	virtual DRESULT
+	write(const BYTE *buffer, LBA_t sector, UINT count) = 0;
+
+	virtual DRESULT
+	ioctl(BYTE command, void *buffer) = 0;
+};
+
+/// Connects a disk to the physical drive number `drive`.
+/// @return false if the drive number is out of range.
+/// @ingroup modm_fatfs_block_device
+bool
+registerDisk(uint8_t drive, Disk &disk);
+
+/// Disconnects the disk from the physical drive number `drive`.
+/// @ingroup modm_fatfs_block_device
+void
+unregisterDisk(uint8_t drive);
+
+/**
+ * FatFs disk backed by a `modm::BlockDevice`.
+ *
+ * A request for several consecutive sectors is forwarded to the block device
+ * as a single call, so that drivers can stream the whole range in one
+ * transaction. Devices with a block based interface, like `modm::BdSdCard`,
+ * are accessed through `readBlocks()` and `writeBlocks()` to reach beyond
+ * the 4 GiB limit of the byte addresses.
+ *
+ * Buffers passed in by FatFs are used directly if their address is aligned to
+ * `Alignment`, otherwise the data is copied through a bounce buffer of
+ * `BounceSectors` sectors. It is allocated once in `initialize()` from memory
+ * with the `modm::MemoryDMA` trait.
+ *
+ * The sector size defaults to the erase block size of the device, but at
+ * least `FF_MIN_SS`, so that FatFs never has to read-modify-write a block.
+ * `CTRL_TRIM` erases the released sectors if `FF_USE_TRIM` is enabled.
+ *
+ * The block device is called with `RF_CALL_BLOCKING()`, which in fiber mode
+ * lets other fibers run while the device waits for the hardware. Accesses to
+ * the same disk from several fibers are serialized, however FatFs itself must
+ * be configured with `FF_FS_REENTRANT` if the same volume is used by several
+ * fibers.
+ *
+ * @tparam Device			Block device with `BlockSizeRead`, `BlockSizeWrite`
+ * 							and `BlockSizeErase`, and either `DeviceSize` or
+ * 							`getBlockCount()`.
+ * @tparam SectorSize		Size of a FatFs sector in bytes
+ * @tparam BounceSectors	Number of sectors copied at once for unaligned buffers
+ * @tparam Alignment		Alignment of buffers accessed by DMA in bytes
+ *
+ * @ingroup modm_fatfs_block_device
+ */
+template< class Device,
+		  size_t SectorSize = std::max<size_t>(FF_MIN_SS, Device::BlockSizeErase),
+		  size_t BounceSectors = 1, size_t Alignment = 4 >
+class BlockDeviceDisk : public Disk
+{
+	static_assert(std::has_single_bit(SectorSize) and
+				  FF_MIN_SS <= SectorSize and SectorSize <= FF_MAX_SS,
+			"SectorSize must be a power of two between FF_MIN_SS and FF_MAX_SS!");
+	static_assert(SectorSize % Device::BlockSizeErase == 0 and
+				  SectorSize % Device::BlockSizeWrite == 0 and
+				  SectorSize % Device::BlockSizeRead == 0,
+			"SectorSize must be a multiple of all block sizes of the device!");
+	static_assert(BounceSectors > 0, "BounceSectors must be at least one!");
+	static_assert(std::has_single_bit(Alignment), "Alignment must be a power of two!");
+
+	static constexpr bool HasBlockInterface = requires(Device &d, uint8_t *b)
+	{
+		d.readBlocks(b, 0, 1);
+		d.writeBlocks(b, 0, 1);
+		d.eraseBlocks(0, 1);
+		Device::BlockSize;
+	};
+	static constexpr size_t BounceSize = BounceSectors * SectorSize;
+
+public:
+	explicit BlockDeviceDisk(Device &device) :
+		device(device)
+	{}
+
+	~BlockDeviceDisk()
+	{
+		delete[] bounceMemory;
+	}
+
+	DSTATUS
+	initialize() override
+	{
+		Lock lock(busy);
+		if (bounceMemory == nullptr)
+		{
+			bounceMemory = new (modm::MemoryDMA, std::nothrow) uint8_t[BounceSize + Alignment - 1];
+			if (bounceMemory == nullptr) return diskStatus;
+			bounce = align(bounceMemory);
+		}
+		if (RF_CALL_BLOCKING(device.initialize()))
+			diskStatus &= ~STA_NOINIT;
+		else
+			diskStatus |= STA_NOINIT;
+		return diskStatus;
+	}
+
+	DSTATUS
+	status() override
+	{
+		return diskStatus;
+	}
+
+	DRESULT
+	read(BYTE *buffer, LBA_t sector, UINT count) override
+	{
+		if (diskStatus & STA_NOINIT) return RES_NOTRDY;
+		Lock lock(busy);
+
+		if (isAligned(buffer))
+			return RF_CALL_BLOCKING(readSectors(buffer, sector, count)) ? RES_OK : RES_ERROR;
+
+		while (count)
+		{
+			const UINT chunk = std::min<UINT>(count, BounceSectors);
+			if (not RF_CALL_BLOCKING(readSectors(bounce, sector, chunk))) return RES_ERROR;
+			std::memcpy(buffer, bounce, chunk * SectorSize);
+			buffer += chunk * SectorSize;
+			sector += chunk;
+			count -= chunk;
+		}
+		return RES_OK;
+	}
+
+	DRESULT
+	write(const BYTE *buffer, LBA_t sector, UINT count) override
+	{
+		if (diskStatus & STA_NOINIT) return RES_NOTRDY;
+		Lock lock(busy);
+
+		if (isAligned(buffer))
+			return RF_CALL_BLOCKING(writeSectors(buffer, sector, count)) ? RES_OK : RES_ERROR;
+
+		while (count)
+		{
+			const UINT chunk = std::min<UINT>(count, BounceSectors);
+			std::memcpy(bounce, buffer, chunk * SectorSize);
+			if (not RF_CALL_BLOCKING(writeSectors(bounce, sector, chunk))) return RES_ERROR;
+			buffer += chunk * SectorSize;
+			sector += chunk;
+			count -= chunk;
+		}
+		return RES_OK;
+	}
+
+	DRESULT
+	ioctl(BYTE command, void *buffer) override
+	{
+		if (diskStatus & STA_NOINIT) return RES_NOTRDY;
+		switch (command)
+		{
+			case CTRL_SYNC:
+				// all writes are completed before returning
+				return RES_OK;
+
+			case GET_SECTOR_COUNT:
+				*static_cast<LBA_t*>(buffer) = getSectorCount();
+				return RES_OK;
+
+			case GET_SECTOR_SIZE:
+				*static_cast<WORD*>(buffer) = SectorSize;
+				return RES_OK;
+
+			case GET_BLOCK_SIZE:
+				// the sector is already a multiple of the erase block
+				*static_cast<DWORD*>(buffer) = 1;
+				return RES_OK;
+
+			case CTRL_TRIM:
+			{
+				const LBA_t *range = static_cast<const LBA_t*>(buffer);
+				if (range[1] < range[0] or range[1] >= getSectorCount()) return RES_PARERR;
+				Lock lock(busy);
+				return RF_CALL_BLOCKING(eraseSectors(range[0], range[1] - range[0] + 1)) ?
+						RES_OK : RES_ERROR;
+			}
+
+			default:
+				return RES_PARERR;
+		}
+	}
+
+private:
+	/// Serializes the access of several fibers to the device
+	class Lock
+	{
+	public:
+		explicit Lock(bool &busy) : busy(busy)
+		{
+			modm::this_fiber::poll([&busy] { return not busy; });
+			busy = true;
+		}
+
+		~Lock() { busy = false; }
+
+	private:
+		bool &busy;
+	};
+
+	static bool
+	isAligned(const void *buffer)
+	{
+		return (reinterpret_cast<uintptr_t>(buffer) & (Alignment - 1)) == 0;
+	}
+
+	static uint8_t*
+	align(uint8_t *buffer)
+	{
+		return reinterpret_cast<uint8_t*>(
+				(reinterpret_cast<uintptr_t>(buffer) + Alignment - 1) & ~uintptr_t(Alignment - 1));
+	}
+
+	LBA_t
+	getSectorCount() const
+	{
+		if constexpr (HasBlockInterface)
+			return LBA_t(device.getBlockCount()) / (SectorSize / Device::BlockSize);
+		else
+			return Device::DeviceSize / SectorSize;
+	}
+
+	modm::ResumableResult<bool>
+	readSectors(uint8_t *buffer, LBA_t sector, UINT count)
+	{
+		if constexpr (HasBlockInterface) {
+			constexpr size_t Factor = SectorSize / Device::BlockSize;
+			return device.readBlocks(buffer, sector * Factor, count * Factor);
+		}
+		else return device.read(buffer, sector * SectorSize, count * SectorSize);
+	}
+
+	modm::ResumableResult<bool>
+	writeSectors(const uint8_t *buffer, LBA_t sector, UINT count)
+	{
+		if constexpr (HasBlockInterface) {
+			constexpr size_t Factor = SectorSize / Device::BlockSize;
+			return device.writeBlocks(buffer, sector * Factor, count * Factor);
+		}
+		else return device.write(buffer, sector * SectorSize, count * SectorSize);
+	}
+
+	modm::ResumableResult<bool>
+	eraseSectors(LBA_t sector, LBA_t count)
+	{
+		if constexpr (HasBlockInterface) {
+			constexpr size_t Factor = SectorSize / Device::BlockSize;
+			return device.eraseBlocks(sector * Factor, count * Factor);
+		}
+		else return device.erase(sector * SectorSize, count * SectorSize);
+	}
+
+private:
+	Device &device;
+	uint8_t *bounceMemory{nullptr};
+	uint8_t *bounce{nullptr};
+	DSTATUS diskStatus{STA_NOINIT};
+	bool busy{false};
+};
+
+} // namespace modm::fatfs
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device.hpp"
+
+namespace
+{
+// One physical drive per volume, unless volumes are mapped onto partitions
+modm::fatfs::Disk *disks[FF_VOLUMES]{};
+
+modm::fatfs::Disk*
+getDisk(BYTE drive)
+{
+	return (drive < FF_VOLUMES) ? disks[drive] : nullptr;
+}
+}
+
+bool
+modm::fatfs::registerDisk(uint8_t drive, Disk &disk)
+{
+	if (drive >= FF_VOLUMES) return false;
+	disks[drive] = &disk;
+	return true;
+}
+
+void
+modm::fatfs::unregisterDisk(uint8_t drive)
+{
+	if (drive < FF_VOLUMES) disks[drive] = nullptr;
+}
+
+// ----------------------------------------------------------------------------
+extern "C" DSTATUS
+disk_initialize(BYTE drive)
+{
+	if (auto *disk = getDisk(drive)) return disk->initialize();
+	return STA_NOINIT;
+}
+
+extern "C" DSTATUS
+disk_status(BYTE drive)
+{
+	if (auto *disk = getDisk(drive)) return disk->status();
+	return STA_NOINIT;
+}
+
+extern "C" DRESULT
+disk_read(BYTE drive, BYTE *buffer, LBA_t sector, UINT count)
+{
+	if (auto *disk = getDisk(drive)) return disk->read(buffer, sector, count);
+	return RES_NOTRDY;
+}
+
+extern "C" DRESULT
+disk_write(BYTE drive, const BYTE *buffer, LBA_t sector, UINT count)
+{
+	if (auto *disk = getDisk(drive)) return disk->write(buffer, sector, count);
+	return RES_NOTRDY;
+}
+
+extern "C" DRESULT
+disk_ioctl(BYTE drive, BYTE command, void *buffer)
+{
+	if (auto *disk = getDisk(drive)) return disk->ioctl(command, buffer);
+	return RES_NOTRDY;
+}
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -10,6 +11,9 @@
  */
 // ----------------------------------------------------------------------------
 
+#include "atomic/block_queue.hpp"
 #include "atomic/flag.hpp"
 #include "atomic/container.hpp"
 #include "atomic/queue.hpp"
+#include "atomic/record_argument.hpp"
+#include "atomic/ring_writer.hpp"
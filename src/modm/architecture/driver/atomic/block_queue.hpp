@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_ATOMIC_BLOCK_QUEUE_HPP
+#define	MODM_ATOMIC_BLOCK_QUEUE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <span>
+
+namespace modm
+{
+	namespace atomic
+	{
+		/**
+		 * \ingroup	modm_architecture_atomic
+		 * \brief	Lock-free queue of blocks for a single producer and a single consumer
+		 *
+		 * The producer writes an element directly into the slot returned by
+		 * `reserve()` and publishes it with `commit()`. The consumer accesses
+		 * the oldest elements as a contiguous block with `front()` and
+		 * releases them with `pop()`, so blocks are processed without
+		 * copying. The producer and the consumer may run in an interrupt and
+		 * a fiber, as long as each side is only used from one context.
+		 *
+		 * \tparam	T	Type of the elements
+		 * \tparam	N	Capacity, which must be a power of two
+		 */
+		template< class T, std::size_t N >
+		class BlockQueue
+		{
+			static_assert(std::has_single_bit(N), "The capacity must be a power of two!");
+
+		public:
+			using ValueType = T;
+
+		public:
+			/// @return A free slot, or nullptr if the queue is full.
+			T*
+			reserve()
+			{
+				if (getSize() >= N) {
+					overruns++;
+					return nullptr;
+				}
+				return &elements[head % N];
+			}
+
+			/// Publish the slot returned by `reserve()` to the consumer.
+			void
+			commit()
+			{ head = head + 1; }
+
+			bool
+			isEmpty() const
+			{ return head == tail; }
+
+			std::size_t
+			getSize() const
+			{ return head - tail; }
+
+			static constexpr std::size_t
+			getMaxSize()
+			{ return N; }
+
+			/// @return The oldest elements up to the end of the internal buffer.
+			std::span<const T>
+			front() const
+			{
+				const std::size_t index = tail % N;
+				return {&elements[index], std::min(getSize(), N - index)};
+			}
+
+			/// Release the oldest `count` elements to the producer.
+			void
+			pop(std::size_t count = 1)
+			{ tail = tail + std::min(count, getSize()); }
+
+			/// Number of elements, which were dropped because the queue was full
+			std::size_t
+			getOverruns() const
+			{ return overruns; }
+
+		private:
+			T elements[N];
+			volatile std::size_t head{0};
+			volatile std::size_t tail{0};
+			std::size_t overruns{0};
+		};
+	}
+}
+
+#endif	// MODM_ATOMIC_BLOCK_QUEUE_HPP
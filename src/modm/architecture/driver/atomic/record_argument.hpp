@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_ATOMIC_RECORD_ARGUMENT_HPP
+#define	MODM_ATOMIC_RECORD_ARGUMENT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace modm
+{
+	namespace atomic
+	{
+		/// @cond
+		namespace detail
+		{
+			template < typename T >
+			bool
+			copyRecordArgument(uint8_t*& position, const uint8_t* end, const T& value)
+			{
+				if (sizeof(T) > std::size_t(end - position)) return false;
+				std::memcpy(position, &value, sizeof(T));
+				position += sizeof(T);
+				return true;
+			}
+		}
+		/// @endcond
+
+		/**
+		 * \ingroup	modm_architecture_atomic
+		 * \brief	Appends one argument to a binary log record
+		 *
+		 * Arguments are promoted like for `printf` to simplify decoding on
+		 * the host: integers to at least 32 bits, enums to their underlying
+		 * type and floating point numbers to `double`. Pointers are stored
+		 * as `uintptr_t` and strings are copied including their null
+		 * terminator.
+		 *
+		 * @param	position	advanced past the argument on success
+		 * @param	end			end of the record buffer
+		 * @return	false if the argument does not fit into the record.
+		 */
+		template < typename T >
+		bool
+		packRecordArgument(uint8_t*& position, const uint8_t* end, const T& arg)
+		{
+			using U = std::remove_cv_t<T>;
+			if constexpr (std::is_convertible_v<const T&, const char*>)
+			{
+				const char* string = arg;
+				const std::size_t length = std::strlen(string) + 1;
+				if (length > std::size_t(end - position)) return false;
+				std::memcpy(position, string, length);
+				position += length;
+				return true;
+			}
+			else if constexpr (std::is_enum_v<U>) {
+				return packRecordArgument(position, end, std::to_underlying(arg));
+			}
+			else if constexpr (std::is_floating_point_v<U>) {
+				return detail::copyRecordArgument(position, end, double(arg));
+			}
+			else if constexpr (std::is_integral_v<U> and sizeof(U) < sizeof(int32_t)) {
+				return detail::copyRecordArgument(position, end,
+						std::conditional_t<std::is_signed_v<U>, int32_t, uint32_t>(arg));
+			}
+			else if constexpr (std::is_pointer_v<U>) {
+				return detail::copyRecordArgument(position, end, uintptr_t(arg));
+			}
+			else
+			{
+				static_assert(std::is_integral_v<U>, "Only numbers, pointers and strings can be logged!");
+				return detail::copyRecordArgument(position, end, arg);
+			}
+		}
+	}	// namespace atomic
+}	// namespace modm
+
+#endif	// MODM_ATOMIC_RECORD_ARGUMENT_HPP
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	MODM_ATOMIC_RING_WRITER_HPP
+#define	MODM_ATOMIC_RING_WRITER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace modm
+{
+	namespace atomic
+	{
+		/**
+		 * \ingroup	modm_architecture_atomic
+		 * \brief	Lock-free writing into a ring buffer from multiple writers
+		 *
+		 * Any number of fibers and interrupts can write concurrently: Each
+		 * writer reserves space by advancing the reserved offset with a
+		 * single compare-and-swap and copies its data outside of any
+		 * critical section. The head offset seen by the single reader is
+		 * only advanced by the last writer leaving, so the reader never sees
+		 * incomplete data.
+		 *
+		 * This relies on interrupts preempting each other in a nested
+		 * fashion: An interrupted writer always finishes after the
+		 * interrupting writer and publishes the head offset again if it
+		 * changed in the meantime, so that the head offset only advances.
+		 *
+		 * The ring buffer passed to `write()` must provide:
+		 * - `size`: the buffer size in bytes, one byte remains unused,
+		 * - `getFree(position)`: the free bytes behind a write position,
+		 * - `copy(position, data, length)`: copies data, wrapping at the end,
+		 * - `publish(head)`: makes all data up to `head` visible.
+		 */
+		class RingWriter
+		{
+		public:
+			/**
+			 * Writes data into the ring buffer.
+			 *
+			 * \param	partial	write as many bytes as fit, otherwise all or nothing
+			 * \return	number of bytes written
+			 */
+			template< class Ring >
+			uint32_t
+			write(Ring &ring, const uint8_t *data, uint32_t length, bool partial)
+			{
+				writers.fetch_add(1, std::memory_order_acquire);
+				uint32_t position{reserved.load(std::memory_order_relaxed)};
+				uint32_t count;
+				do
+				{
+					count = ring.size ? std::min<uint32_t>(length, ring.getFree(position)) : 0;
+					if (not count or (not partial and count < length)) {
+						count = 0;
+						break;
+					}
+				}
+				while (not reserved.compare_exchange_weak(position, (position + count) % ring.size,
+														  std::memory_order_relaxed));
+
+				if (count) ring.copy(position, data, count);
+
+				if (writers.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					// A writer preempting us between loading and publishing
+					// the offset publishes its own data first, which our
+					// older offset would hide again.
+					uint32_t published;
+					do
+					{
+						published = reserved.load(std::memory_order_acquire);
+						ring.publish(published);
+					}
+					while (published != reserved.load(std::memory_order_acquire) and
+						   writers.load(std::memory_order_acquire) == 0);
+				}
+				return count;
+			}
+
+			/// Offset behind the last reserved byte
+			uint32_t
+			getReserved() const
+			{ return reserved.load(std::memory_order_relaxed); }
+
+		private:
+			std::atomic<uint32_t> reserved{0};
+			std::atomic<uint32_t> writers{0};
+		};
+	}
+}
+
+#endif	// MODM_ATOMIC_RING_WRITER_HPP
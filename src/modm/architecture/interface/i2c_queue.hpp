@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_INTERFACE_I2C_QUEUE_HPP
+#define MODM_INTERFACE_I2C_QUEUE_HPP
+
+#include "i2c.hpp"
+#include "i2c_master.hpp"
+#include "i2c_transaction.hpp"
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <modm/processing/resumable.hpp>
+#include <span>
+
+namespace modm
+{
+
+/**
+ * Bus-level queue of I2C transactions.
+ *
+ * The queue owns a fixed pool of transaction descriptors, which are shared by
+ * all devices on the bus. A submitted request is passed to `I2cMaster::start()`
+ * as soon as the master accepts it. When a request is detached, the queue
+ * immediately hands the next pending request to the master from within the
+ * interrupt, so that the transfers of several devices follow each other
+ * without waiting for the threads of the devices.
+ *
+ * Masters without a transaction buffer, like the AVR and bit-banged masters,
+ * are still busy while they detach a request and reject the next one. Then
+ * the pending requests are passed on by `update()`, which must be called
+ * periodically. `I2cQueueDevice` calls it while waiting for its request.
+ *
+ * A write consists of up to two segments, which are transferred without a
+ * repeated start. This allows writing a register address and a payload from
+ * separate buffers without copying them into one buffer. The buffers must
+ * remain valid until the request has finished.
+ *
+ * @code
+ * modm::I2cQueue<I2cMaster1, 8> queue;
+ *
+ * const uint8_t reg = 0x3B;
+ * auto *request = queue.writeRead(0x68, {&reg, 1}, data);
+ * // ...
+ * if (request and not request->isBusy()) {
+ *     bool success = request->wasSuccessful();
+ *     queue.release(request);
+ * }
+ * @endcode
+ *
+ * @tparam	I2cMaster	an I2cMaster conforming to the I2cMaster interface.
+ * @tparam	Size		number of transaction descriptors in the pool (< 256).
+ *
+ * @ingroup modm_architecture_i2c_queue
+ */
+template< class I2cMaster, size_t Size = 8 >
+class I2cQueue : public ::modm::I2c
+{
+	static_assert(Size > 0 and Size < 256, "I2cQueue supports between 1 and 255 descriptors!");
+
+public:
+	/// Transaction descriptor of the pool
+	class Request : public I2cTransaction
+	{
+		friend class I2cQueue;
+
+	public:
+		Request() : I2cTransaction(0) {}
+
+		/// @return `true` while the request is pending or being transferred
+		bool
+		isBusy() const
+		{ return busy; }
+
+		/// @return `true` if the request finished without error
+		bool
+		wasSuccessful() const
+		{ return not busy and state != TransactionState::Error; }
+
+	protected:
+		Starting
+		starting() override;
+
+		Writing
+		writing() override;
+
+		Reading
+		reading() override;
+
+		void
+		detaching(DetachCause cause) override;
+
+	private:
+		I2cQueue *queue{nullptr};
+		ConfigurationHandler configuration{nullptr};
+		const uint8_t *segments[2]{};
+		std::size_t lengths[2]{};
+		uint8_t *readBuffer{nullptr};
+		std::size_t readLength{0};
+		uint8_t writeCount{0};
+		uint8_t writeIndex{0};
+		volatile bool busy{false};
+		bool allocated{false};
+	};
+
+public:
+	I2cQueue();
+
+	/**
+	 * Submits a transaction with up to two write segments and a read.
+	 *
+	 * The sequence is start - address - header - payload - restart - address - read - stop.
+	 * Empty segments are omitted, without any segment only the address is sent.
+	 *
+	 * @return	the request or `nullptr` if there is no free descriptor.
+	 */
+	Request*
+	submit(uint8_t address, std::span<const uint8_t> header, std::span<const uint8_t> payload,
+		   std::span<uint8_t> read, ConfigurationHandler handler = nullptr);
+
+	/// Submits a write of a header, for example a register address, and a payload.
+	Request*
+	write(uint8_t address, std::span<const uint8_t> header, std::span<const uint8_t> payload = {},
+		  ConfigurationHandler handler = nullptr)
+	{ return submit(address, header, payload, {}, handler); }
+
+	/// Submits a write followed by a read after a repeated start.
+	Request*
+	writeRead(uint8_t address, std::span<const uint8_t> write, std::span<uint8_t> read,
+			  ConfigurationHandler handler = nullptr)
+	{ return submit(address, write, {}, read, handler); }
+
+	/// Submits a read.
+	Request*
+	read(uint8_t address, std::span<uint8_t> read, ConfigurationHandler handler = nullptr)
+	{ return submit(address, {}, {}, read, handler); }
+
+	/// Submits a transaction which only sends the address.
+	Request*
+	ping(uint8_t address, ConfigurationHandler handler = nullptr)
+	{ return submit(address, {}, {}, {}, handler); }
+
+	/**
+	 * Returns a finished request to the pool.
+	 *
+	 * @return	`false` if the request is still busy and was not released.
+	 */
+	bool
+	release(Request *request);
+
+	/**
+	 * Passes pending requests to the master.
+	 *
+	 * Pending requests are normally passed on when a request is detached.
+	 * Call this function periodically, if the master may reject a request
+	 * while it detaches the previous one or after a reset.
+	 *
+	 * @return	`true` if requests are still pending.
+	 */
+	bool
+	update();
+
+	/// Number of requests which have not yet been passed to the master
+	size_t
+	getPending() const
+	{ return pending; }
+
+	/// Number of free descriptors in the pool
+	size_t
+	getFree() const;
+
+private:
+	void
+	dispatch();
+
+	Request requests[Size];
+	Request *ring[Size];
+	uint8_t head{0};
+	volatile uint8_t pending{0};
+	volatile bool dispatching{false};
+	volatile bool redispatch{false};
+};
+
+/**
+ * Base class of an I2C Device, which transfers through a shared `I2cQueue`.
+ *
+ * This class mirrors the resumable functions of `I2cDevice`, however, the
+ * transaction descriptor is taken from the pool of the queue.
+ *
+ * @tparam	Queue			the I2cQueue of the bus
+ * @tparam	NestingLevels	number of nesting levels required for your driver
+ *
+ * @ingroup modm_architecture_i2c_queue
+ */
+template< class Queue, uint8_t NestingLevels = 10 >
+class I2cQueueDevice : protected modm::NestedResumable< NestingLevels + 1 >
+{
+public:
+	///	@param	address	the slave address not yet shifted left (address < 128).
+	I2cQueueDevice(Queue &queue, uint8_t address) :
+		queue(queue), address(address)
+	{}
+
+	/// Sets a new address of the slave device.
+	void
+	setAddress(uint8_t address)
+	{ this->address = address; }
+
+	/// Attaches a configuration handler, which is called before a transaction,
+	/// whenever the configuration has to be changed.
+	void
+	attachConfigurationHandler(I2c::ConfigurationHandler handler)
+	{ configuration = handler; }
+
+	/// @retval true	device responds to address
+	/// @retval false	no device with address found
+	modm::ResumableResult<bool>
+	ping()
+	{
+		RF_BEGIN();
+		RF_END_RETURN_CALL( transfer({}, {}, {}) );
+	}
+
+	/// Writes a header and a payload from separate buffers and waits until finished.
+	modm::ResumableResult<bool>
+	write(std::span<const uint8_t> header, std::span<const uint8_t> payload = {})
+	{
+		RF_BEGIN();
+		RF_END_RETURN_CALL( transfer(header, payload, {}) );
+	}
+
+	/// Writes and reads after a repeated start and waits until finished.
+	modm::ResumableResult<bool>
+	writeRead(std::span<const uint8_t> write, std::span<uint8_t> read)
+	{
+		RF_BEGIN();
+		RF_END_RETURN_CALL( transfer(write, {}, read) );
+	}
+
+	/// Reads and waits until finished.
+	modm::ResumableResult<bool>
+	read(std::span<uint8_t> read)
+	{
+		RF_BEGIN();
+		RF_END_RETURN_CALL( transfer({}, {}, read) );
+	}
+
+protected:
+	/// Submits a request to the queue and waits until finished.
+	modm::ResumableResult<bool>
+	transfer(std::span<const uint8_t> header, std::span<const uint8_t> payload, std::span<uint8_t> read);
+
+protected:
+	Queue &queue;
+
+private:
+	typename Queue::Request *request{nullptr};
+	I2c::ConfigurationHandler configuration{nullptr};
+	uint8_t address;
+	bool success{false};
+};
+
+}	// namespace modm
+
+#include "i2c_queue_impl.hpp"
+
+#endif // MODM_INTERFACE_I2C_QUEUE_HPP
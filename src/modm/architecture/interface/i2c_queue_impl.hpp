@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_INTERFACE_I2C_QUEUE_HPP
+#	error	"Don't include this file directly, use 'i2c_queue.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template< class I2cMaster, size_t Size >
+modm::I2cTransaction::Starting
+modm::I2cQueue<I2cMaster, Size>::Request::starting()
+{
+	Starting starting(address, OperationAfterStart::Stop);
+	if (writeIndex < writeCount) starting.next = OperationAfterStart::Write;
+	else if (readLength) starting.next = OperationAfterStart::Read;
+	return starting;
+}
+
+template< class I2cMaster, size_t Size >
+modm::I2cTransaction::Writing
+modm::I2cQueue<I2cMaster, Size>::Request::writing()
+{
+	const uint8_t index = writeIndex++;
+	// continue with the next segment without a repeated start
+	OperationAfterWrite next = OperationAfterWrite::Stop;
+	if (writeIndex < writeCount) next = OperationAfterWrite::Write;
+	else if (readLength) next = OperationAfterWrite::Restart;
+	return Writing(segments[index], lengths[index], next);
+}
+
+template< class I2cMaster, size_t Size >
+modm::I2cTransaction::Reading
+modm::I2cQueue<I2cMaster, Size>::Request::reading()
+{
+	return Reading(readBuffer, readLength, OperationAfterRead::Stop);
+}
+
+template< class I2cMaster, size_t Size >
+void
+modm::I2cQueue<I2cMaster, Size>::Request::detaching(DetachCause cause)
+{
+	// the request stays pending and is passed to the master again
+	if (cause == DetachCause::FailedToAttach) return;
+
+	I2cTransaction::detaching(cause);
+	busy = false;
+	// Chain the next pending request while still in the interrupt.
+	// Masters which only clear their transaction after detaching reject it,
+	// then it remains pending until the next update() or submit().
+	queue->dispatch();
+}
+
+// ----------------------------------------------------------------------------
+template< class I2cMaster, size_t Size >
+modm::I2cQueue<I2cMaster, Size>::I2cQueue()
+{
+	for (Request &request : requests)
+		request.queue = this;
+}
+
+template< class I2cMaster, size_t Size >
+typename modm::I2cQueue<I2cMaster, Size>::Request*
+modm::I2cQueue<I2cMaster, Size>::submit(uint8_t address,
+		std::span<const uint8_t> header, std::span<const uint8_t> payload,
+		std::span<uint8_t> read, ConfigurationHandler handler)
+{
+	Request *request{nullptr};
+	{
+		modm::atomic::Lock lock;
+		for (Request &candidate : requests)
+		{
+			if (not candidate.allocated)
+			{
+				request = &candidate;
+				request->allocated = true;
+				break;
+			}
+		}
+	}
+	if (not request) return nullptr;
+
+	request->setAddress(address);
+	request->configuration = handler;
+	request->writeCount = 0;
+	request->writeIndex = 0;
+	for (std::span<const uint8_t> segment : {header, payload})
+	{
+		if (segment.empty()) continue;
+		request->segments[request->writeCount] = segment.data();
+		request->lengths[request->writeCount] = segment.size();
+		request->writeCount++;
+	}
+	request->readBuffer = read.data();
+	request->readLength = read.size();
+	request->busy = true;
+	{
+		modm::atomic::Lock lock;
+		ring[(head + pending) % Size] = request;
+		pending = pending + 1;
+	}
+	dispatch();
+	return request;
+}
+
+template< class I2cMaster, size_t Size >
+bool
+modm::I2cQueue<I2cMaster, Size>::release(Request *request)
+{
+	if (not request or request->busy) return false;
+	modm::atomic::Lock lock;
+	request->allocated = false;
+	return true;
+}
+
+template< class I2cMaster, size_t Size >
+bool
+modm::I2cQueue<I2cMaster, Size>::update()
+{
+	dispatch();
+	return pending;
+}
+
+template< class I2cMaster, size_t Size >
+size_t
+modm::I2cQueue<I2cMaster, Size>::getFree() const
+{
+	size_t count{0};
+	for (const Request &request : requests)
+		if (not request.allocated) count++;
+	return count;
+}
+
+template< class I2cMaster, size_t Size >
+void
+modm::I2cQueue<I2cMaster, Size>::dispatch()
+{
+	{
+		modm::atomic::Lock lock;
+		// A detaching request interrupted the dispatch or the master called
+		// the detaching synchronously from within start().
+		// The running dispatch continues with the pending requests.
+		if (dispatching) { redispatch = true; return; }
+		dispatching = true;
+	}
+	while (true)
+	{
+		Request *request{nullptr};
+		{
+			modm::atomic::Lock lock;
+			redispatch = false;
+			if (pending) request = ring[head];
+		}
+		if (request and I2cMaster::start(request, request->configuration))
+		{
+			modm::atomic::Lock lock;
+			head = (head + 1) % Size;
+			pending = pending - 1;
+			continue;
+		}
+		modm::atomic::Lock lock;
+		if (not redispatch)
+		{
+			dispatching = false;
+			return;
+		}
+	}
+}
+
+// ----------------------------------------------------------------------------
+template< class Queue, uint8_t NestingLevels >
+modm::ResumableResult<bool>
+modm::I2cQueueDevice<Queue, NestingLevels>::transfer(std::span<const uint8_t> header,
+		std::span<const uint8_t> payload, std::span<uint8_t> read)
+{
+	RF_BEGIN();
+
+	RF_WAIT_UNTIL( (request = queue.submit(address, header, payload, read, configuration)) );
+
+	// Masters without a transaction buffer reject the next request while
+	// the previous one is detaching, so the pending requests are retried.
+	RF_WAIT_UNTIL( (queue.update(), not request->isBusy()) );
+
+	success = request->wasSuccessful();
+	queue.release(request);
+	request = nullptr;
+
+	RF_END_RETURN( success );
+}
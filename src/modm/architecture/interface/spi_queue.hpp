@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_INTERFACE_SPI_QUEUE_HPP
+#define MODM_INTERFACE_SPI_QUEUE_HPP
+
+#include "spi.hpp"
+#include "spi_master.hpp"
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <modm/processing/resumable.hpp>
+#include <span>
+
+namespace modm
+{
+
+/**
+ * Queued scheduler of SPI transfers for several devices on one bus.
+ *
+ * Devices submit requests from a fixed pool of descriptors. Each request
+ * refers to the `Target` of its device, which contains the chip select, the
+ * configuration handler and the priority of the device. A single resumable
+ * function `update()` performs the pending requests back to back:
+ *
+ * - The request with the highest priority is transferred first, requests
+ *   of the same priority are transferred in the order of submission.
+ * - The chip select is asserted and deasserted around each request.
+ * - A request consists of a header, for example a command and address, and
+ *   a data transfer, which are sent from separate buffers with one
+ *   `SpiMaster::transfer()` each, so DMA masters transfer them without
+ *   copying.
+ * - The master is acquired once for consecutive requests with the same
+ *   configuration handler. It is only released and acquired with the new
+ *   handler when the configuration changes, so the master does not need to
+ *   be reconfigured between requests of devices sharing a configuration.
+ *
+ * While requests are pending the master is held by the queue, so other
+ * `SpiDevice`s on the same bus wait until the queue is empty.
+ *
+ * @code
+ * modm::SpiQueue<SpiMaster1_Dma, 8> queue;
+ * const decltype(queue)::Target imu{&decltype(queue)::chipSelect<ImuCs>, imuConfiguration, 1};
+ *
+ * // in a fiber or protothread
+ * while (true) RF_CALL(queue.update());
+ * @endcode
+ *
+ * @tparam	SpiMaster	an SpiMaster conforming to the SpiMaster interface.
+ * @tparam	Size		number of transfer descriptors in the pool (< 256).
+ *
+ * @ingroup modm_architecture_spi_queue
+ */
+template< class SpiMaster, size_t Size = 8 >
+class SpiQueue : public ::modm::Spi, protected modm::NestedResumable<1>
+{
+	static_assert(Size > 0 and Size < 256, "SpiQueue supports between 1 and 255 descriptors!");
+
+public:
+	/// Bus configuration of a device
+	struct Target
+	{
+		/// Asserts the chip select if `select` is true, otherwise deasserts it
+		void (*chipSelect)(bool select);
+		/// Configures data mode and baudrate of the master for the device
+		ConfigurationHandler configuration{nullptr};
+		/// Requests of devices with higher priority are transferred first
+		uint8_t priority{0};
+	};
+
+	/// Chip select with an active low GPIO
+	template< class Cs >
+	static void
+	chipSelect(bool select)
+	{
+		if (select) Cs::reset();
+		else Cs::set();
+	}
+
+	/// Transfer descriptor of the pool
+	class Request
+	{
+		friend class SpiQueue;
+
+	public:
+		/// @return `true` while the request is pending or being transferred
+		bool
+		isBusy() const
+		{ return busy; }
+
+	private:
+		const Target *target{nullptr};
+		const uint8_t *header{nullptr};
+		std::size_t headerLength{0};
+		const uint8_t *tx{nullptr};
+		uint8_t *rx{nullptr};
+		std::size_t length{0};
+		uint32_t sequence{0};
+		volatile bool busy{false};
+		bool allocated{false};
+	};
+
+public:
+	/**
+	 * Submits a transfer of a header followed by a data transfer.
+	 *
+	 * The header is written while the received bytes are discarded. If `tx`
+	 * is `nullptr`, zeros are sent during the data transfer, if `rx` is
+	 * `nullptr`, the received data is discarded. The target and the buffers
+	 * must remain valid until the request has finished.
+	 *
+	 * @return	the request or `nullptr` if there is no free descriptor.
+	 */
+	Request*
+	submit(const Target &target, std::span<const uint8_t> header,
+		   const uint8_t *tx, uint8_t *rx, std::size_t length);
+
+	/// Submits a write of a header and a payload.
+	Request*
+	write(const Target &target, std::span<const uint8_t> header, std::span<const uint8_t> payload = {})
+	{ return submit(target, header, payload.data(), nullptr, payload.size()); }
+
+	/// Submits a write of a header followed by a read.
+	Request*
+	read(const Target &target, std::span<const uint8_t> header, std::span<uint8_t> data)
+	{ return submit(target, header, nullptr, data.data(), data.size()); }
+
+	/**
+	 * Returns a finished request to the pool.
+	 *
+	 * @return	`false` if the request is still busy and was not released.
+	 */
+	bool
+	release(Request *request);
+
+	/// Performs all pending requests and releases the master when the queue is empty.
+	modm::ResumableResult<void>
+	update();
+
+	/// Number of requests which have not yet been transferred
+	size_t
+	getPending() const;
+
+	/// Number of free descriptors in the pool
+	size_t
+	getFree() const;
+
+private:
+	/// Selects the pending request with the highest priority.
+	Request*
+	next();
+
+	Request requests[Size];
+	Request *active{nullptr};
+	ConfigurationHandler configuration{nullptr};
+	uint32_t sequence{0};
+	bool acquired{false};
+};
+
+/**
+ * Base class of an SPI Device, which transfers through a shared `SpiQueue`.
+ *
+ * @tparam	Queue			the SpiQueue of the bus
+ * @tparam	NestingLevels	number of nesting levels required for your driver
+ *
+ * @ingroup modm_architecture_spi_queue
+ */
+template< class Queue, uint8_t NestingLevels = 10 >
+class SpiQueueDevice : protected modm::NestedResumable< NestingLevels + 1 >
+{
+public:
+	SpiQueueDevice(Queue &queue, const typename Queue::Target &target) :
+		queue(queue), target(target)
+	{}
+
+	/// Writes a header and a payload and waits until finished.
+	modm::ResumableResult<void>
+	write(std::span<const uint8_t> header, std::span<const uint8_t> payload = {})
+	{
+		RF_BEGIN();
+		RF_CALL( transfer(header, payload.data(), nullptr, payload.size()) );
+		RF_END();
+	}
+
+	/// Writes a header, reads the data and waits until finished.
+	modm::ResumableResult<void>
+	read(std::span<const uint8_t> header, std::span<uint8_t> data)
+	{
+		RF_BEGIN();
+		RF_CALL( transfer(header, nullptr, data.data(), data.size()) );
+		RF_END();
+	}
+
+protected:
+	/// Submits a request to the queue and waits until finished.
+	modm::ResumableResult<void>
+	transfer(std::span<const uint8_t> header, const uint8_t *tx, uint8_t *rx, std::size_t length);
+
+protected:
+	Queue &queue;
+	typename Queue::Target target;
+
+private:
+	typename Queue::Request *request{nullptr};
+};
+
+}	// namespace modm
+
+#include "spi_queue_impl.hpp"
+
+#endif // MODM_INTERFACE_SPI_QUEUE_HPP
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_INTERFACE_SPI_QUEUE_HPP
+#	error	"Don't include this file directly, use 'spi_queue.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template< class SpiMaster, size_t Size >
+typename modm::SpiQueue<SpiMaster, Size>::Request*
+modm::SpiQueue<SpiMaster, Size>::submit(const Target &target, std::span<const uint8_t> header,
+		const uint8_t *tx, uint8_t *rx, std::size_t length)
+{
+	modm::atomic::Lock lock;
+	for (Request &request : requests)
+	{
+		if (request.allocated) continue;
+
+		request.allocated = true;
+		request.target = &target;
+		request.header = header.data();
+		request.headerLength = header.size();
+		request.tx = tx;
+		request.rx = rx;
+		request.length = length;
+		request.sequence = sequence++;
+		request.busy = true;
+		return &request;
+	}
+	return nullptr;
+}
+
+template< class SpiMaster, size_t Size >
+bool
+modm::SpiQueue<SpiMaster, Size>::release(Request *request)
+{
+	if (not request or request->busy) return false;
+	modm::atomic::Lock lock;
+	request->allocated = false;
+	return true;
+}
+
+template< class SpiMaster, size_t Size >
+size_t
+modm::SpiQueue<SpiMaster, Size>::getPending() const
+{
+	size_t count{0};
+	for (const Request &request : requests)
+		if (request.busy and &request != active) count++;
+	return count;
+}
+
+template< class SpiMaster, size_t Size >
+size_t
+modm::SpiQueue<SpiMaster, Size>::getFree() const
+{
+	size_t count{0};
+	for (const Request &request : requests)
+		if (not request.allocated) count++;
+	return count;
+}
+
+template< class SpiMaster, size_t Size >
+typename modm::SpiQueue<SpiMaster, Size>::Request*
+modm::SpiQueue<SpiMaster, Size>::next()
+{
+	modm::atomic::Lock lock;
+	Request *selected{nullptr};
+	for (Request &request : requests)
+	{
+		if (not request.busy) continue;
+		if (not selected or request.target->priority > selected->target->priority or
+			(request.target->priority == selected->target->priority and
+			 // wrap-around safe comparison of the submission order
+			 int32_t(request.sequence - selected->sequence) < 0))
+		{
+			selected = &request;
+		}
+	}
+	return selected;
+}
+
+template< class SpiMaster, size_t Size >
+modm::ResumableResult<void>
+modm::SpiQueue<SpiMaster, Size>::update()
+{
+	RF_BEGIN();
+
+	while ((active = next()))
+	{
+		// the master keeps the configuration as long as the queue holds it
+		if (acquired and active->target->configuration != configuration)
+		{
+			SpiMaster::release(this);
+			acquired = false;
+		}
+		if (not acquired)
+		{
+			RF_WAIT_UNTIL( SpiMaster::acquire(this, active->target->configuration) );
+			configuration = active->target->configuration;
+			acquired = true;
+		}
+
+		active->target->chipSelect(true);
+		if (active->headerLength)
+			RF_CALL( SpiMaster::transfer(active->header, nullptr, active->headerLength) );
+		if (active->length)
+			RF_CALL( SpiMaster::transfer(active->tx, active->rx, active->length) );
+		active->target->chipSelect(false);
+
+		active->busy = false;
+	}
+	active = nullptr;
+
+	if (acquired)
+	{
+		SpiMaster::release(this);
+		acquired = false;
+	}
+
+	RF_END();
+}
+
+// ----------------------------------------------------------------------------
+template< class Queue, uint8_t NestingLevels >
+modm::ResumableResult<void>
+modm::SpiQueueDevice<Queue, NestingLevels>::transfer(std::span<const uint8_t> header,
+		const uint8_t *tx, uint8_t *rx, std::size_t length)
+{
+	RF_BEGIN();
+
+	RF_WAIT_UNTIL( (request = queue.submit(target, header, tx, rx, length)) );
+
+	RF_WAIT_WHILE( request->isBusy() );
+
+	queue.release(request);
+	request = nullptr;
+
+	RF_END();
+}
@@ -5,6 +5,7 @@
  * Copyright (c) 2012-2015, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -24,6 +25,7 @@
 
 #include <map>
 #include <functional>
+#include <memory_resource>
 
 namespace xpcc
 {
@@ -36,13 +38,17 @@ namespace xpcc
  *
  * On hosted however, this class allows for much easier registering of callbacks.
  *
+ * The callback tables are allocated from the given memory resource, for
+ * example a `modm::MemoryResource` over a `modm::PoolAllocator`. Delivering
+ * packets does not allocate.
+ *
  * @ingroup	modm_communication_xpcc
  * @author	Niklas Hauser
  */
 class DynamicPostman : public Postman
 {
 public:
-	DynamicPostman();
+	DynamicPostman(std::pmr::memory_resource *resource = std::pmr::get_default_resource());
 
 	DeliverInfo
 	deliverPacket(const Header &header, const modm::SmartPointer& payload) override;
@@ -107,12 +113,12 @@ private:
 	};
 
 	/// packetIdentifier -> callback
-	typedef std::multimap<uint8_t, EventListener> EventMap;
+	typedef std::pmr::multimap<uint8_t, EventListener> EventMap;
 
 	/// packetIdentifier -> callback
-	typedef std::map<uint8_t, ActionHandler > CallbackMap;
+	typedef std::pmr::map<uint8_t, ActionHandler > CallbackMap;
 	///< destination -> callbackMap
-	typedef std::map<uint8_t, CallbackMap > ActionMap;
+	typedef std::pmr::map<uint8_t, CallbackMap > ActionMap;
 
 private:
 	EventMap eventMap;
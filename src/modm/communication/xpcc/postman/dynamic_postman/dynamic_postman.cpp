@@ -5,6 +5,7 @@
  * Copyright (c) 2012-2013, 2015, Niklas Hauser
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -17,7 +18,8 @@
 #include "../dynamic_postman.hpp"
 
 // ----------------------------------------------------------------------------
-xpcc::DynamicPostman::DynamicPostman()
+xpcc::DynamicPostman::DynamicPostman(std::pmr::memory_resource *resource) :
+	eventMap(resource), actionMap(resource)
 {
 }
 
@@ -5,6 +5,7 @@
  * Copyright (c) 2013, Sascha Schade
  * Copyright (c) 2014, Daniel Krebs
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -24,7 +25,9 @@ namespace modm
 	/**
 	 * \brief	doubly-linked list
 	 *
-	 * \tparam	T	type of list entries
+	 * \tparam	T			type of list entries
+	 * \tparam	Allocator	standard allocator, for example modm::ResourceAllocator
+	 * 						or std::pmr::polymorphic_allocator
 	 *
 	 * \author	Fabian Greif
 	 * \ingroup	modm_container
@@ -33,8 +36,8 @@ namespace modm
 	class DoublyLinkedList
 	{
 	public:
-		using const_iterator = std::list<T>::const_iterator;
-		using iterator = std::list<T>::iterator;
+		using const_iterator = std::list<T, Allocator>::const_iterator;
+		using iterator = std::list<T, Allocator>::iterator;
 		using Size = std::size_t;
 
 		DoublyLinkedList(const Allocator& allocator = Allocator())
@@ -5,6 +5,7 @@
  * Copyright (c) 2013-2014, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -28,8 +29,8 @@ namespace modm
 	 * \todo	implementation
 	 *
 	 * \tparam	T			Type of list entries
-	 * \tparam	Allocator	Allocator used for memory allocation. See
-	 * 						classes from modm::allocator namespace.
+	 * \tparam	Allocator	Allocator used for memory allocation, for example
+	 * 						modm::ResourceAllocator or std::pmr::polymorphic_allocator.
 	 *
 	 * \author	Fabian Greif
 	 * \ingroup	modm_container
@@ -14,4 +14,6 @@
 // ----------------------------------------------------------------------------
 
 #include "logger/logger.hpp"
-#include "logger/style.hpp"
\ No newline at end of file
+#include "logger/style.hpp"
+#include "logger/deferred.hpp"
+#include "logger/async_sink.hpp"
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_LOG_ASYNC_SINK_HPP
+#define MODM_LOG_ASYNC_SINK_HPP
+
+#include "deferred.hpp"
+#include "level.hpp"
+#include "record_buffer.hpp"
+
+#include <modm/architecture/interface/clock.hpp>
+#include <modm/io/iodevice.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace modm
+{
+	namespace log
+	{
+		/**
+		 * \brief	Non-blocking log sink with overflow accounting
+		 *
+		 * Producers commit whole records into a ring buffer without ever
+		 * waiting for the output device, which is drained separately by a
+		 * background fiber via `drain()` or by DMA via `peek()` and `consume()`.
+		 *
+		 * When the buffer is full, the complete record is dropped instead of
+		 * parts of it. The number of dropped records is reported inline as
+		 * text, for example `<3 log records dropped>`, once the next record
+		 * fits into the buffer again.
+		 *
+		 * Each log level can be rate limited to a number of records per time
+		 * period. Records of the deferred logger carry their level, records
+		 * written via `RecordSink::write()` in other formats are not limited.
+		 * Rate limited records are counted separately from dropped records
+		 * and reported inline as `<2 log records rate limited>`.
+		 *
+		 * \code
+		 * modm::log::AsyncSink<2048> log_sink;
+		 * modm::log::DeferredLogger modm::log::deferred(log_sink);
+		 *
+		 * // Text loggers commit every line as one record
+		 * modm::log::LineDevice info_device(log_sink, modm::log::INFO);
+		 * modm::log::Logger modm::log::info(info_device);
+		 *
+		 * log_sink.setRateLimit(modm::log::DEBUG, 10, 100ms);
+		 * // in a background fiber
+		 * log_sink.drain(uart_device);
+		 * \endcode
+		 *
+		 * \tparam	Size	Size of the ring buffer in bytes
+		 * \tparam	Clock	Time source of the rate limit
+		 *
+		 * \ingroup modm_debug
+		 */
+		template < std::size_t Size, class Clock = modm::Clock >
+		class AsyncSink : public RecordSink
+		{
+		public:
+			struct Statistics
+			{
+				uint32_t records;	///< committed records
+				uint32_t overflows;		///< records dropped due to a full buffer
+				uint32_t rateLimited;	///< records rejected by the rate limit
+			};
+
+		public:
+			/// Writes a record of the deferred logger, rate limited by its level
+			bool
+			write(const uint8_t* record, std::size_t length) override
+			{
+				const uint8_t level = length ? record[0] ^ DeferredLogger::RecordSync : DISABLED;
+				return write((length >= DeferredLogger::HeaderSize and level < DISABLED) ? Level(level) : DISABLED,
+							 record, length);
+			}
+
+			/// Writes a record of any format, the DISABLED level is never rate limited
+			bool
+			write(Level level, const uint8_t* record, std::size_t length)
+			{
+				if (not acquire(level))
+				{
+					rateLimited.fetch_add(1, std::memory_order_relaxed);
+					limited.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				if (not report(dropped, " log records dropped>\n") or
+					not report(limited, " log records rate limited>\n") or
+					not buffer.write(record, length))
+				{
+					dropped.fetch_add(1, std::memory_order_relaxed);
+					overflows.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				records.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			/** Limits the number of records of a level
+			 *
+			 * Allows bursts of up to `count` records, which are replenished
+			 * evenly over the `period`. A count of zero removes the limit.
+			 * May be called while logging, records written concurrently are
+			 * limited by either the previous or the new limit.
+			 */
+			void
+			setRateLimit(Level level, uint16_t count, typename Clock::duration period)
+			{
+				if (level >= DISABLED) return;
+				Limit& limit = limits[level];
+				// disable the limit while it is updated
+				limit.burst.store(0, std::memory_order_release);
+				limit.interval.store(count ? std::max<uint32_t>(period.count() / count, 1) : 0,
+									 std::memory_order_relaxed);
+				limit.last.store(Clock::now().time_since_epoch().count(), std::memory_order_relaxed);
+				limit.tokens.store(count, std::memory_order_relaxed);
+				limit.burst.store(count, std::memory_order_release);
+			}
+
+			Statistics
+			getStatistics() const
+			{
+				return {records.load(std::memory_order_relaxed),
+						overflows.load(std::memory_order_relaxed),
+						rateLimited.load(std::memory_order_relaxed)};
+			}
+
+			/// Number of dropped records that have not been reported yet
+			uint32_t
+			getDropped() const
+			{ return dropped.load(std::memory_order_relaxed); }
+
+			/// Number of rate limited records that have not been reported yet
+			uint32_t
+			getLimited() const
+			{ return limited.load(std::memory_order_relaxed); }
+
+		public:
+			/// Copies up to `length` committed bytes out of the buffer
+			std::size_t
+			read(uint8_t* data, std::size_t length)
+			{ return buffer.read(data, length); }
+
+			/// Contiguous committed bytes, for example as source of a DMA transfer
+			std::span<const uint8_t>
+			peek() const
+			{ return buffer.peek(); }
+
+			/// Releases the first `count` bytes returned by `peek()`
+			void
+			consume(std::size_t count)
+			{ buffer.consume(count); }
+
+			/// Writes all committed bytes to a device
+			void
+			drain(IODevice& device)
+			{ buffer.drain(device); }
+
+			bool
+			isEmpty() const
+			{ return buffer.isEmpty(); }
+
+		private:
+			struct Limit
+			{
+				std::atomic<uint16_t> burst{0};
+				std::atomic<uint32_t> interval{0};
+				std::atomic<uint16_t> tokens{0};
+				std::atomic<uint32_t> last{0};
+			};
+
+			bool
+			acquire(Level level)
+			{
+				if (level >= DISABLED) return true;
+				Limit& limit = limits[level];
+				const uint16_t burst = limit.burst.load(std::memory_order_acquire);
+				const uint32_t interval = limit.interval.load(std::memory_order_relaxed);
+				if (not burst or not interval) return true;
+
+				// only the writer that advances the refill time adds the tokens
+				const uint32_t now = Clock::now().time_since_epoch().count();
+				uint32_t last = limit.last.load(std::memory_order_relaxed);
+				const uint32_t refill = (now - last) / interval;
+				if (refill and limit.last.compare_exchange_strong(last, last + refill * interval,
+																  std::memory_order_relaxed))
+				{
+					uint16_t tokens = limit.tokens.load(std::memory_order_relaxed);
+					while (not limit.tokens.compare_exchange_weak(tokens,
+							std::min<uint32_t>(tokens + refill, burst), std::memory_order_relaxed));
+				}
+
+				uint16_t tokens = limit.tokens.load(std::memory_order_relaxed);
+				do {
+					if (not tokens) return false;
+				}
+				while (not limit.tokens.compare_exchange_weak(tokens, tokens - 1, std::memory_order_relaxed));
+				return true;
+			}
+
+			/// Reports a pending count inline, which is restored if the report does not fit
+			bool
+			report(std::atomic<uint32_t>& pending, const char* message)
+			{
+				uint32_t count = pending.exchange(0, std::memory_order_relaxed);
+				if (not count) return true;
+				const uint32_t reported{count};
+
+				char text[40] = "<";
+				char digits[10];
+				std::size_t length{1}, ii{0};
+				do digits[ii++] = '0' + count % 10; while (count /= 10);
+				while (ii) text[length++] = digits[--ii];
+				while (*message) text[length++] = *message++;
+				if (buffer.write(reinterpret_cast<const uint8_t*>(text), length)) return true;
+
+				pending.fetch_add(reported, std::memory_order_relaxed);
+				return false;
+			}
+
+			RecordBuffer<Size> buffer;
+			Limit limits[DISABLED];
+			// not yet reported records
+			std::atomic<uint32_t> dropped{0};
+			std::atomic<uint32_t> limited{0};
+			// statistics
+			std::atomic<uint32_t> records{0};
+			std::atomic<uint32_t> overflows{0};
+			std::atomic<uint32_t> rateLimited{0};
+		};
+
+		/**
+		 * \brief	Commits every line written by a text logger as one record
+		 *
+		 * Lines longer than `LineSize` are split into several records.
+		 * Each producer context needs its own device and logger, since the
+		 * line is assembled in the device.
+		 *
+		 * \ingroup modm_debug
+		 */
+		template < class Sink, std::size_t LineSize = 128 >
+		class LineDevice : public IODevice
+		{
+		public:
+			LineDevice(Sink& sink, Level level = INFO) :
+				sink(sink), level(level)
+			{
+			}
+
+			using IODevice::write;
+
+			void
+			write(char c) override
+			{
+				line[length++] = c;
+				if (c == '\n' or length == LineSize) flush();
+			}
+
+			void
+			flush() override
+			{
+				if (length) sink.write(level, reinterpret_cast<const uint8_t*>(line), length);
+				length = 0;
+			}
+
+			bool
+			read(char&) override
+			{ return false; }
+
+		private:
+			Sink& sink;
+			const Level level;
+			std::size_t length{0};
+			char line[LineSize];
+		};
+	}
+}
+
+#endif // MODM_LOG_ASYNC_SINK_HPP
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_LOG_CATEGORY_HPP
+#define MODM_LOG_CATEGORY_HPP
+
+#include "level.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace modm
+{
+	namespace log
+	{
+		/// @cond
+		namespace detail
+		{
+			constexpr uint8_t
+			levelMask(Level minimum)
+			{ return uint8_t(0x0f << minimum) & 0x0f; }
+		}
+		/// @endcond
+
+		/**
+		 * \brief	Root of all log categories
+		 *
+		 * Disabling a level of the root at runtime disables it for all
+		 * categories.
+		 *
+		 * \ingroup modm_debug
+		 */
+		struct Root
+		{
+			static constexpr Level threshold = DEBUG;
+			/// Runtime enabled levels, one bit per level
+			static inline std::atomic<uint8_t> levels{detail::levelMask(DEBUG)};
+
+			static bool
+			isEnabled(Level level)
+			{ return levels.load(std::memory_order_relaxed) & (1u << level); }
+		};
+
+		/**
+		 * \brief	Hierarchical log category
+		 *
+		 * Categories are declared as types deriving from this class. Log
+		 * statements below the compile-time threshold of their category or
+		 * of any parent category are removed completely, including the
+		 * evaluation of their arguments and their string literals.
+		 *
+		 * The remaining levels can be disabled at runtime per category with
+		 * `setLevel()`, which also affects all child categories. The runtime
+		 * state is a single byte per category.
+		 *
+		 * \code
+		 * struct Sensors : modm::log::Category<Sensors, modm::log::Root, modm::log::INFO> {};
+		 * struct Imu : modm::log::Category<Imu, Sensors> {};
+		 *
+		 * MODM_LOG_DEBUG_IN(Imu) << "removed at compile time" << modm::endl;
+		 * MODM_LOG_INFO_IN(Imu) << "fifo=" << count << modm::endl;
+		 * modm::log::setLevel<Sensors>(modm::log::WARNING);
+		 * \endcode
+		 *
+		 * \tparam	Self		The declared category (CRTP)
+		 * \tparam	Parent		Parent category
+		 * \tparam	Threshold	Lowest level compiled into the program,
+		 *						at least the threshold of the parent.
+		 *
+		 * \ingroup modm_debug
+		 */
+		template < class Self, class Parent = Root, Level Threshold = Parent::threshold >
+		struct Category
+		{
+			using parent = Parent;
+			static constexpr Level threshold = std::max(Threshold, Parent::threshold);
+			/// Runtime enabled levels, one bit per level
+			static inline std::atomic<uint8_t> levels{detail::levelMask(DEBUG)};
+
+			static bool
+			isEnabled(Level level)
+			{ return (levels.load(std::memory_order_relaxed) & (1u << level)) and Parent::isEnabled(level); }
+		};
+
+		/// @return true if a level of a category is compiled into the program
+		/// \ingroup modm_debug
+		template < class Category >
+		constexpr bool
+		isCompiled(Level level)
+		{ return level >= Category::threshold and level < DISABLED; }
+
+		/// @return true if a level of a category and all its parents is enabled
+		/// \ingroup modm_debug
+		template < class Category >
+		bool
+		isEnabled(Level level)
+		{ return isCompiled<Category>(level) and Category::isEnabled(level); }
+
+		/// Enables all levels from `minimum` at runtime, use DISABLED to mute the category
+		/// \ingroup modm_debug
+		template < class Category >
+		void
+		setLevel(Level minimum)
+		{ Category::levels.store(detail::levelMask(minimum), std::memory_order_relaxed); }
+	}
+}
+
+/**
+ * \brief	Filters a log statement by the level of a category
+ *
+ * The compile-time check uses `if constexpr`, so disabled statements do not
+ * generate any code, even without optimization.
+ *
+ * \ingroup modm_debug
+ */
+#define MODM_LOG_IF_ENABLED(category, level) \
+	if constexpr (MODM_LOG_LEVEL > (level) or not modm::log::isCompiled<category>(level)){} \
+	else if (not category::isEnabled(level)){} \
+	else
+
+#endif // MODM_LOG_CATEGORY_HPP
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_LOG_DEFERRED_HPP
+#define MODM_LOG_DEFERRED_HPP
+
+#include "category.hpp"
+#include "level.hpp"
+#include "record_buffer.hpp"
+
+#include <modm/architecture/driver/atomic/record_argument.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+/// Reference point of all format string IDs, resolved by the host decoder
+extern "C" const char modm_log_anchor[];
+
+namespace modm
+{
+	namespace log
+	{
+		/**
+		 * \brief	Logger with deferred formatting
+		 *
+		 * Instead of formatting text on the target, every log statement writes
+		 * a binary record with the ID of its format string and the raw
+		 * arguments to a record sink. The host formats the text using the
+		 * strings in the ELF file via `python3 -m modm_tools.log`.
+		 *
+		 * A record consists of:
+		 *
+		 * - a sync byte `0xA0 | level`,
+		 * - the size of the arguments in bytes,
+		 * - the format string ID as `int32_t` (offset to `modm_log_anchor`),
+		 * - the arguments in native (little endian) byte order.
+		 *
+		 * Arguments are promoted like for `printf`: integers to at least 32
+		 * bits and floating point numbers to `double`. Strings are copied
+		 * including their null terminator.
+		 *
+		 * Don't use this class directly! Prefer an access through the
+		 * MODM_DLOG_DEBUG, MODM_DLOG_INFO, MODM_DLOG_WARNING and
+		 * MODM_DLOG_ERROR macros.
+		 *
+		 * \ingroup modm_debug
+		 */
+		class DeferredLogger
+		{
+		public:
+			static constexpr uint8_t RecordSync = 0xA0;
+			static constexpr std::size_t HeaderSize = 2 + sizeof(int32_t);
+			static constexpr std::size_t ArgumentsMax = 255;
+
+		public:
+			DeferredLogger(RecordSink& sink) :
+				sink(sink)
+			{
+			}
+
+			/// @return false if the record did not fit or was dropped by the sink
+			template < typename... Args >
+			bool
+			log(Level level, const char* format, const Args&... args)
+			{
+				uint8_t record[HeaderSize + ArgumentsMax];
+				uint8_t* position{record + HeaderSize};
+				if (not (atomic::packRecordArgument(position, record + sizeof(record), args) and ...))
+					return false;
+
+				record[0] = RecordSync | uint8_t(level);
+				record[1] = position - record - HeaderSize;
+				const int32_t id = getId(format);
+				std::memcpy(record + 2, &id, sizeof(id));
+				return sink.write(record, position - record);
+			}
+
+			/// Offset of a format string to the anchor, independent of the load address
+			static int32_t
+			getId(const char* format)
+			{ return int32_t(intptr_t(format) - intptr_t(modm_log_anchor)); }
+
+		private:
+			RecordSink& sink;
+		};
+
+		/// Don't use this instance directly! Prefer the MODM_DLOG_* macros.
+		/// \ingroup modm_debug
+		extern DeferredLogger deferred;
+
+		/// @cond
+		namespace detail
+		{
+			// Only used to let the compiler check the format string
+			[[gnu::format(printf, 1, 2)]] int
+			checkFormat(const char* format, ...);
+		}
+		/// @endcond
+	}
+}
+
+/**
+ * \brief	Write a deferred log record with a printf format string
+ *
+ * The format string and arguments are checked like for `printf`.
+ * Like the stream loggers, records below MODM_LOG_LEVEL are removed.
+ *
+ * \code
+ * MODM_DLOG_INFO("adc=%u temperature=%.1f\n", adc, temperature);
+ * \endcode
+ *
+ * \ingroup modm_debug
+ */
+#define MODM_DLOG(level, format, ...) \
+	if constexpr (MODM_LOG_LEVEL > (level)){} \
+	else MODM_DLOG_WRITE(level, format __VA_OPT__(,) __VA_ARGS__)
+
+/// Write a deferred log record of a log category
+/// \ingroup modm_debug
+#define MODM_DLOG_IN(category, level, format, ...) \
+	MODM_LOG_IF_ENABLED(category, level) MODM_DLOG_WRITE(level, format __VA_OPT__(,) __VA_ARGS__)
+
+/// @cond
+#define MODM_DLOG_WRITE(level, format, ...) \
+	modm::log::deferred.log( \
+		((void) sizeof(modm::log::detail::checkFormat(format __VA_OPT__(,) __VA_ARGS__)), (level)), \
+		format __VA_OPT__(,) __VA_ARGS__)
+/// @endcond
+
+/// \ingroup modm_debug
+#define MODM_DLOG_DEBUG(format, ...) MODM_DLOG(modm::log::DEBUG, format __VA_OPT__(,) __VA_ARGS__)
+/// \ingroup modm_debug
+#define MODM_DLOG_INFO(format, ...) MODM_DLOG(modm::log::INFO, format __VA_OPT__(,) __VA_ARGS__)
+/// \ingroup modm_debug
+#define MODM_DLOG_WARNING(format, ...) MODM_DLOG(modm::log::WARNING, format __VA_OPT__(,) __VA_ARGS__)
+/// \ingroup modm_debug
+#define MODM_DLOG_ERROR(format, ...) MODM_DLOG(modm::log::ERROR, format __VA_OPT__(,) __VA_ARGS__)
+
+#endif // MODM_LOG_DEFERRED_HPP
@@ -20,6 +20,7 @@
 #include <modm/architecture/utils.hpp>
 #include <modm/io/iostream.hpp>
 
+#include "category.hpp"
 #include "level.hpp"
 #include "style.hpp"
 #include "style_wrapper.hpp"
@@ -95,7 +96,7 @@ namespace modm
  * \ingroup modm_debug
  */
 #define MODM_LOG_DEBUG \
-	if (MODM_LOG_LEVEL > modm::log::DEBUG){} \
+	if constexpr (MODM_LOG_LEVEL > modm::log::DEBUG){} \
 	else modm::log::debug
 
 /**
@@ -103,7 +104,7 @@ namespace modm
  * \ingroup modm_debug
  */
 #define MODM_LOG_INFO \
-	if (MODM_LOG_LEVEL > modm::log::INFO){}	\
+	if constexpr (MODM_LOG_LEVEL > modm::log::INFO){}	\
 	else modm::log::info
 
 /**
@@ -111,7 +112,7 @@ namespace modm
  * \ingroup modm_debug
  */
 #define MODM_LOG_WARNING \
-	if (MODM_LOG_LEVEL > modm::log::WARNING){}	\
+	if constexpr (MODM_LOG_LEVEL > modm::log::WARNING){}	\
 	else modm::log::warning
 
 /**
@@ -119,9 +120,37 @@ namespace modm
  * \ingroup modm_debug
  */
 #define MODM_LOG_ERROR \
-	if (MODM_LOG_LEVEL > modm::log::ERROR){}	\
+	if constexpr (MODM_LOG_LEVEL > modm::log::ERROR){}	\
 	else modm::log::error
 
+/**
+ * \brief	Output stream for debug messages of a log category
+ * \ingroup modm_debug
+ */
+#define MODM_LOG_DEBUG_IN(category) \
+	MODM_LOG_IF_ENABLED(category, modm::log::DEBUG) modm::log::debug
+
+/**
+ * \brief	Output stream for info messages of a log category
+ * \ingroup modm_debug
+ */
+#define MODM_LOG_INFO_IN(category) \
+	MODM_LOG_IF_ENABLED(category, modm::log::INFO) modm::log::info
+
+/**
+ * \brief	Output stream for warnings of a log category
+ * \ingroup modm_debug
+ */
+#define MODM_LOG_WARNING_IN(category) \
+	MODM_LOG_IF_ENABLED(category, modm::log::WARNING) modm::log::warning
+
+/**
+ * \brief	Output stream for error messages of a log category
+ * \ingroup modm_debug
+ */
+#define MODM_LOG_ERROR_IN(category) \
+	MODM_LOG_IF_ENABLED(category, modm::log::ERROR) modm::log::error
+
 #ifdef __DOXYGEN__
 
 /**
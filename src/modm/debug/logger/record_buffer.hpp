@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_LOG_RECORD_BUFFER_HPP
+#define MODM_LOG_RECORD_BUFFER_HPP
+
+#include <modm/architecture/driver/atomic/ring_writer.hpp>
+#include <modm/io/iodevice.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+namespace modm
+{
+	namespace log
+	{
+		/**
+		 * \brief	Destination of binary log records
+		 *
+		 * \ingroup modm_debug
+		 */
+		class RecordSink
+		{
+		public:
+			virtual
+			~RecordSink() = default;
+
+			/// Writes the whole record or nothing.
+			/// @return false if the record was dropped
+			virtual bool
+			write(const uint8_t* record, std::size_t length) = 0;
+		};
+
+		/**
+		 * \brief	Wrapper to use any device with a `writeRecord()` function,
+		 *			like `modm::platform::Rtt`, as record sink
+		 *
+		 * \ingroup modm_debug
+		 */
+		template < class Device >
+		class RecordSinkObjectWrapper : public RecordSink
+		{
+		public:
+			RecordSinkObjectWrapper(Device& device) :
+				device(device)
+			{
+			}
+
+			bool
+			write(const uint8_t* record, std::size_t length) override
+			{ return device.writeRecord(record, length); }
+
+		private:
+			Device& device;
+		};
+
+		/**
+		 * \brief	Lock-free ring buffer for log records
+		 *
+		 * Any number of fibers and interrupts can write records concurrently
+		 * using `modm::atomic::RingWriter`. The records only become visible to
+		 * the reader once the last concurrent writer has finished.
+		 *
+		 * A single reader drains the buffer, for example from a fiber or a
+		 * DMA completion interrupt.
+		 *
+		 * \tparam	Size	Size of the buffer in bytes, one byte remains unused
+		 *
+		 * \ingroup modm_debug
+		 */
+		template < std::size_t Size >
+		class RecordBuffer : public RecordSink
+		{
+			static_assert(Size >= 2 and Size <= UINT32_MAX, "Invalid buffer size!");
+
+		public:
+			bool
+			write(const uint8_t* record, std::size_t length) override
+			{ return length and length < Size and writer.write(*this, record, length, false); }
+
+			/// Copies up to `length` committed bytes out of the buffer
+			std::size_t
+			read(uint8_t* data, std::size_t length)
+			{
+				const std::span<const uint8_t> committed{peek()};
+				const std::size_t count{std::min(length, committed.size())};
+				std::memcpy(data, committed.data(), count);
+				consume(count);
+				return count;
+			}
+
+			/// Contiguous committed bytes, for example as source of a DMA transfer.
+			/// Call `consume()` once they have been transmitted.
+			std::span<const uint8_t>
+			peek() const
+			{
+				const uint32_t rhead{head.load(std::memory_order_acquire)};
+				const uint32_t rtail{tail.load(std::memory_order_relaxed)};
+				return {buffer + rtail, (rhead >= rtail) ? rhead - rtail : Size - rtail};
+			}
+
+			/// Releases the first `count` bytes returned by `peek()`
+			void
+			consume(std::size_t count)
+			{
+				tail.store((tail.load(std::memory_order_relaxed) + count) % Size, std::memory_order_release);
+			}
+
+			/// Writes all committed bytes to a device
+			void
+			drain(IODevice& device)
+			{
+				uint8_t block[32];
+				while (std::size_t count = read(block, sizeof(block))) {
+					for (std::size_t ii = 0; ii < count; ii++) device.write(char(block[ii]));
+				}
+			}
+
+			bool
+			isEmpty() const
+			{ return head.load(std::memory_order_relaxed) == tail.load(std::memory_order_relaxed); }
+
+			/// Size of the largest record that currently fits
+			std::size_t
+			getFree() const
+			{ return getFree(writer.getReserved()); }
+
+		private:
+			friend class modm::atomic::RingWriter;
+			static constexpr uint32_t size{Size};
+
+			uint32_t
+			getFree(uint32_t position) const
+			{ return (tail.load(std::memory_order_acquire) + Size - position - 1) % Size; }
+
+			void
+			copy(uint32_t position, const uint8_t* record, uint32_t length)
+			{
+				// copy in at most two blocks if the record wraps around the end
+				const uint32_t first{std::min<uint32_t>(length, Size - position)};
+				std::memcpy(buffer + position, record, first);
+				std::memcpy(buffer, record + first, length - first);
+			}
+
+			void
+			publish(uint32_t position)
+			{ head.store(position, std::memory_order_release); }
+
+			uint8_t buffer[Size];
+			std::atomic<uint32_t> head{0};
+			std::atomic<uint32_t> tail{0};
+			modm::atomic::RingWriter writer;
+		};
+	}
+}
+
+#endif // MODM_LOG_RECORD_BUFFER_HPP
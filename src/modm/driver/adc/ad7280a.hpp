@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2012, Fabian Greif
  * Copyright (c) 2013-2014, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,7 @@
 #define MODM_AD7280A_HPP
 
 #include <stdint.h>
+#include <array>
 
 #include <modm/architecture/interface/gpio.hpp>
 #include <modm/architecture/interface/delay.hpp>
@@ -135,6 +137,25 @@ namespace modm
 			AVERAGE_BY_8 = (3 << 1),	///< Average over 8 samples
 		};
 		/// @}
+
+#ifndef __AVR__
+		/// @cond
+		/// CRC-8 of every byte value, P(x) = x^8 + x^5 + x^3 + x^2 + x^1 + x^0
+		inline constexpr auto crcTable = []
+		{
+			std::array<uint8_t, 256> table{};
+			for (size_t value = 0; value < 256; value++)
+			{
+				uint8_t data = value;
+				for (uint_fast8_t i = 0; i < 8; i++) {
+					data = (data & 0x80) ? ((data << 1) ^ 0x2F) : (data << 1);
+				}
+				table[value] = data;
+			}
+			return table;
+		}();
+		/// @endcond
+#endif
 	}
 
 	/**
@@ -182,11 +203,36 @@ namespace modm
 		/**
 		 * Perform a conversion and read the results back.
 		 *
-		 * \param[out]	values		Array containing the results
+		 * \param[out]	values		Array containing the 6*N results
 		 */
 		static bool
 		readAllChannels(uint16_t *values);
 
+		/**
+		 * Start a conversion of the cell voltages on all devices.
+		 *
+		 * The results must be read with readConversions() after the
+		 * conversion time of the chain has passed.
+		 */
+		static void
+		startConversion();
+
+		/**
+		 * Read the cell voltages of all devices back from the chain.
+		 *
+		 * The results are clocked out in 6*N consecutive 32-bit frames
+		 * without any further register access. If `restart` is set, the
+		 * last frame writes the control register to start the next
+		 * conversion, so the chain converts while the results are being
+		 * processed and the next call can read back immediately.
+		 *
+		 * \param[out]	values		Array containing the 6*N results,
+		 * 							ordered by device and cell
+		 * \param		restart		Start the next conversion with the last frame
+		 */
+		static bool
+		readConversions(uint16_t *values, bool restart = true);
+
 	private:
 		/**
 		 * Calculate the CRC for one byte
@@ -209,6 +255,18 @@ namespace modm
 		static uint8_t
 		calculateCrc(uint32_t data);
 
+		/// Build a write command including its CRC
+		static uint32_t
+		command(uint8_t device, ad7280a::Register reg, bool addressAll, uint8_t value);
+
+		/// Check the CRC of a frame read from the chain
+		static bool
+		checkCrc(uint32_t value);
+
+		/// Transfer one 32-bit frame framed by the chip select
+		static uint32_t
+		transfer(uint32_t command);
+
 		static bool
 		write(uint8_t device, ad7280a::Register reg, bool addressAll, uint8_t value);
 
@@ -2,6 +2,7 @@
  * Copyright (c) 2012, Fabian Greif
  * Copyright (c) 2012, 2014, 2016, Sascha Schade
  * Copyright (c) 2013, 2015, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -139,7 +140,7 @@ template <typename Spi, typename Cs, typename Cnvst, int N>
 void
 modm::Ad7280a<Spi, Cs, Cnvst, N>::initialize(ad7280a::Average average)
 {
-	static_assert(N == 1, "Daisy chain length is currently limited to 1!");
+	static_assert(N >= 1 and N <= AD7280A_MAX_CHAIN, "Daisy chain length is limited to 8 devices!");
 
 	controlHighByte = average;
 
@@ -186,12 +187,12 @@ modm::Ad7280a<Spi, Cs, Cnvst, N>::chainSetup()
 	// register data has been read back from all devices in the
 	// daisy chain.
 	bool success = true;
-	for (uint_fast8_t i = 0; i < 1; ++i)
+	for (uint_fast8_t i = 0; i < N; ++i)
 	{
 		ad7280a::RegisterValue reg;
-		readRegister(&reg);
-
-		// TODO check result
+		if (not readRegister(&reg) or reg.registerAddress != ad7280a::CTRL_LB) {
+			success = false;
+		}
 	}
 	// -> 11 c2 65 dc
 	// -> f9 c2 61 84
@@ -311,6 +312,19 @@ modm::Ad7280a<Spi, Cs, Cnvst, N>::readChannel(uint8_t device,
 template <typename Spi, typename Cs, typename Cnvst, int N>
 bool
 modm::Ad7280a<Spi, Cs, Cnvst, N>::readAllChannels(uint16_t *values)
+{
+	startConversion();
+
+	// Allow sufficient time for all conversions to be completed plus tWAIT.
+	modm::delay_ms(5);
+
+	return readConversions(values, false);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Cnvst, int N>
+void
+modm::Ad7280a<Spi, Cs, Cnvst, N>::startConversion()
 {
 	// Write Register Address 0x00 to the read register on all
 	// parts. A device address of 0x00 is used when computing
@@ -321,29 +335,49 @@ modm::Ad7280a<Spi, Cs, Cnvst, N>::readAllChannels(uint16_t *values)
 			AD7280A_CTRL_HB_CONV_INPUT_6CELL |
 			AD7280A_CTRL_HB_CONV_RES_READ_6CELL |
 			AD7280A_CTRL_HB_CONV_START_CS);
+}
 
-	// Allow sufficient time for all conversions to be completed plus tWAIT.
-	modm::delay_ms(5);
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Cnvst, int N>
+bool
+modm::Ad7280a<Spi, Cs, Cnvst, N>::readConversions(uint16_t *values, bool restart)
+{
+	constexpr uint_fast8_t frames = AD7280A_CELLS_PER_DEV * N;
+
+	// The read register still points to the first cell, so the conversion
+	// is restarted with the same command as in startConversion().
+	const uint32_t restartCommand = command(0, ad7280a::CTRL_HB, true,
+			AD7280A_CTRL_HB_CONV_INPUT_6CELL |
+			AD7280A_CTRL_HB_CONV_RES_READ_6CELL |
+			AD7280A_CTRL_HB_CONV_START_CS);
+
+	for (uint_fast8_t i = 0; i < frames; ++i) {
+		values[i] = 0;
+	}
 
 	// Apply a CS low pulse that frames 32 SCLKs to read back
 	// the desired voltage. This frame should simultaneously
 	// write the 32-bit command 0xF800030A, as described in
 	// the Serial Interface section (see Table 29, Write 6).
-	bool success = true;
-	for (uint_fast8_t i = 0; i < 6; ++i)
+	uint64_t received = 0;
+	for (uint_fast8_t i = 0; i < frames; ++i)
 	{
-		ad7280a::ConversionValue result;
-		if (readConversionResult(&result)) {
-			*values = result.value;
-		}
-		else {
-			success = false;
-			*values = 0;
+		const bool last = restart and (i == frames - 1);
+		const uint32_t value = transfer(last ? restartCommand : AD7280A_READ_TXVAL);
+
+		// The results are sorted by the device address and channel of the frame
+		const uint8_t device = bitReverse(static_cast<uint8_t>(value >> 24)) & 0x1f;
+		const uint8_t channel = (value >> 23) & 0x0f;
+		if (checkCrc(value) and device < N and channel < AD7280A_CELLS_PER_DEV)
+		{
+			const uint_fast8_t index = device * AD7280A_CELLS_PER_DEV + channel;
+			values[index] = (value >> 11) & 0xfff;
+			received |= uint64_t(1) << index;
 		}
-		values++;
 	}
 
-	return success;
+	// Every cell of every device must have been received once
+	return (received == (uint64_t(1) << frames) - 1);
 }
 
 // ----------------------------------------------------------------------------
@@ -354,15 +388,15 @@ template <typename Spi, typename Cs, typename Cnvst, int N>
 uint8_t
 modm::Ad7280a<Spi, Cs, Cnvst, N>::updateCrc(uint8_t data)
 {
+#ifdef __AVR__
+	// the lookup table would be copied into RAM on AVRs
 	for (uint_fast8_t i = 0; i < 8; i++) {
-		uint8_t bit = data & 0x80;
-		data <<= 1;
-		if (bit) {
-			data ^= 0x2F;
-		}
+		data = (data & 0x80) ? ((data << 1) ^ 0x2F) : (data << 1);
 	}
-
 	return data;
+#else
+	return ad7280a::crcTable[data];
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -380,8 +414,8 @@ modm::Ad7280a<Spi, Cs, Cnvst, N>::calculateCrc(uint32_t data)
 
 // ----------------------------------------------------------------------------
 template <typename Spi, typename Cs, typename Cnvst, int N>
-bool
-modm::Ad7280a<Spi, Cs, Cnvst, N>::write(uint8_t device, ad7280a::Register reg,
+uint32_t
+modm::Ad7280a<Spi, Cs, Cnvst, N>::command(uint8_t device, ad7280a::Register reg,
 		bool addressAll, uint8_t value)
 {
 	// The device address is send with LSB first
@@ -392,14 +426,45 @@ modm::Ad7280a<Spi, Cs, Cnvst, N>::write(uint8_t device, ad7280a::Register reg,
 			 addressAll << 12);
 
 	t |= calculateCrc(t >> 11) << 3 | 0x2;
+	return t;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Cnvst, int N>
+bool
+modm::Ad7280a<Spi, Cs, Cnvst, N>::checkCrc(uint32_t value)
+{
+	uint8_t crc = calculateCrc(value >> 10);
+	//MODM_LOG_DEBUG << "expected=" << crc << ", got=" << ((value >> 2) & 0xff) << modm::endl;
+	return (crc == ((value >> 2) & 0xff));
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Cnvst, int N>
+uint32_t
+modm::Ad7280a<Spi, Cs, Cnvst, N>::transfer(uint32_t command)
+{
+	uint32_t value;
 
 	Cs::reset();
-	Spi::write((t >> 24) & 0xff);
-	Spi::write((t >> 16) & 0xff);
-	Spi::write((t >> 8) & 0xff);
-	Spi::write((t >> 0) & 0xff);
+	value  = static_cast<uint32_t>(Spi::write((command >> 24) & 0xff)) << 24;
+	value |= static_cast<uint32_t>(Spi::write((command >> 16) & 0xff)) << 16;
+	value |= static_cast<uint32_t>(Spi::write((command >> 8) & 0xff)) << 8;
+	value |= static_cast<uint32_t>(Spi::write((command >> 0) & 0xff));
 	Cs::set();
 
+	//MODM_LOG_DEBUG << "read = " << modm::hex << value << modm::ascii << modm::endl;
+	return value;
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs, typename Cnvst, int N>
+bool
+modm::Ad7280a<Spi, Cs, Cnvst, N>::write(uint8_t device, ad7280a::Register reg,
+		bool addressAll, uint8_t value)
+{
+	transfer(command(device, reg, addressAll, value));
+
 	// TODO remove this
 	modm::delay_us(1);
 	return true;
@@ -410,23 +475,8 @@ template <typename Spi, typename Cs, typename Cnvst, int N>
 bool
 modm::Ad7280a<Spi, Cs, Cnvst, N>::read(uint32_t *value)
 {
-	Cs::reset();
-	*value  = static_cast<uint32_t>(Spi::write(0xF8)) << 24;
-	*value |= static_cast<uint32_t>(Spi::write(0x00)) << 16;
-	*value |= static_cast<uint32_t>(Spi::write(0x03)) << 8;
-	*value |= static_cast<uint32_t>(Spi::write(0x0A));
-	Cs::set();
-
-	//MODM_LOG_DEBUG << "read = " << modm::hex << *value << modm::ascii << modm::endl;
-
-	uint8_t crc = calculateCrc(*value >> 10);
-	if (crc == ((*value >> 2) & 0xff)) {
-		return true;
-	}
-	else {
-		//MODM_LOG_DEBUG << "expected=" << crc << ", got=" << ((*value >> 2) & 0xff) << modm::endl;
-		return false;
-	}
+	*value = transfer(AD7280A_READ_TXVAL);
+	return checkCrc(*value);
 }
 
 // ----------------------------------------------------------------------------
@@ -3,6 +3,7 @@
 /*
  * Copyright (c) 2017, Christopher Durand
  * Copyright (c) 2018, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -20,6 +21,7 @@
 #include <modm/architecture/interface/gpio.hpp>
 #include <modm/architecture/interface/delay.hpp>
 #include <modm/processing/resumable.hpp>
+#include "adc_stream.hpp"
 
 namespace modm
 {
@@ -179,6 +181,19 @@ public:
 	modm::ResumableResult<Data>
 	nextSequenceConversion();
 
+	/// Start a sequence for scans with readScan().
+	/// The channels are stored in ascending channel order in the blocks of the ring.
+	modm::ResumableResult<void>
+	startScan(SequenceChannels_t channels);
+
+	/// Perform one conversion of every channel of the scan into the next block of the ring.
+	/// The SPI master is acquired once for all conversions, the sequencer of the
+	/// device selects the channels, the results are sorted by their channel id.
+	/// @return false if the ring is full and the scan was skipped
+	template<class Ring>
+	modm::ResumableResult<bool>
+	readScan(Ring& ring);
+
 	/// Enable extended range mode (0V < input < 2*Vref)
 	/// The configuration will be applied after the next conversion
 	/// Default mode: (0V < input < Vref)
@@ -217,6 +232,11 @@ private:
 	Data data;
 
 	PowerMode currentPowerMode;
+
+	uint8_t scanChannels{0};
+	uint8_t scanLength{0};
+	uint8_t scanIndex{0};
+	int32_t* scanValues{nullptr};
 };
 
 #if __has_include(<modm/io/iostream.hpp>)
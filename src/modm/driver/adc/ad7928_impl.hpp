@@ -2,6 +2,7 @@
 // ----------------------------------------------------------------------------
 /*
  * Copyright (c) 2017, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -134,6 +135,73 @@ Ad7928<SpiMaster, Cs>::nextSequenceConversion()
 	RF_END_RETURN(data);
 }
 
+// ----------------------------------------------------------------------------
+template <typename SpiMaster, typename Cs>
+ResumableResult<void>
+Ad7928<SpiMaster, Cs>::startScan(ad7928::SequenceChannels_t channels)
+{
+	RF_BEGIN();
+
+	// SequenceChannels::Ch0 is the MSB, bit n of scanChannels is channel n
+	scanChannels = 0;
+	for (uint8_t channel = 0; channel < 8; channel++) {
+		if (channels.value & (0x80 >> channel)) {
+			scanChannels |= 1 << channel;
+		}
+	}
+
+	RF_CALL(startSequence(channels));
+	SequenceMode_t::set(config, SequenceMode::ContinueSequence);
+
+	RF_END();
+}
+
+// ----------------------------------------------------------------------------
+template <typename SpiMaster, typename Cs>
+template <class Ring>
+ResumableResult<bool>
+Ad7928<SpiMaster, Cs>::readScan(Ring& ring)
+{
+	RF_BEGIN();
+
+	if (auto* block = ring.reserve(); block) {
+		block->timestamp = modm::PreciseClock::now();
+		block->count = std::min<std::size_t>(std::popcount(scanChannels), Ring::ValueType::channels);
+		scanLength = block->count;
+		scanValues = block->values;
+	} else {
+		RF_RETURN(false);
+	}
+
+	RF_WAIT_UNTIL(this->acquireMaster());
+	SpiMaster::setDataMode(SpiMaster::DataMode::Mode1);
+
+	outBuffer[0] = (config.value & 0xFF00) >> 8;
+	outBuffer[1] = config.value & 0xFF;
+
+	for (scanIndex = 0; scanIndex < std::popcount(scanChannels); scanIndex++)
+	{
+		// every frame is one conversion, the device needs a rising chip select in between
+		Cs::reset();
+		RF_CALL(SpiMaster::transfer(outBuffer, data.data, 2));
+		Cs::set();
+
+		if (const uint8_t channel = static_cast<uint8_t>(data.channel());
+			scanChannels & (1 << channel))
+		{
+			const uint8_t index = std::popcount(uint8_t(scanChannels & ((1 << channel) - 1)));
+			if (index < scanLength) {
+				scanValues[index] = data.value();
+			}
+		}
+	}
+
+	this->releaseMaster();
+	ring.commit();
+
+	RF_END_RETURN(true);
+}
+
 // ----------------------------------------------------------------------------
 template <typename SpiMaster, typename Cs>
 void
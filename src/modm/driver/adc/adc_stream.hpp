@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_ADC_STREAM_HPP
+#define MODM_ADC_STREAM_HPP
+
+#include <modm/architecture/driver/atomic/block_queue.hpp>
+#include <modm/architecture/interface/clock.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace modm::adc
+{
+
+/**
+ * Results of one multi-channel scan.
+ *
+ * The values are stored in the order of the scan sequence configured in the
+ * driver. The timestamp is taken when the scan is started.
+ *
+ * @tparam	Channels	Maximum number of channels per scan
+ * @ingroup modm_driver_adc_stream
+ */
+template< size_t Channels >
+struct Block
+{
+	static constexpr size_t channels = Channels;
+
+	/// Start of the scan
+	modm::PreciseClock::time_point timestamp;
+	/// Number of valid values
+	uint8_t count{0};
+	/// Raw conversion results in scan order
+	int32_t values[Channels];
+
+	std::span<const int32_t>
+	getValues() const
+	{ return {values, count}; }
+};
+
+/**
+ * Single-producer/single-consumer ring of scan blocks.
+ *
+ * The driver reserves a slot, scans directly into it and commits it. If the
+ * ring is full, the scan is skipped and counted as overrun.
+ *
+ * @tparam	Block	Block type, e.g. `modm::adc::Block<4>`
+ * @tparam	N		Capacity, must be a power of two
+ * @ingroup modm_driver_adc_stream
+ */
+template< class Block, size_t N >
+using BlockRing = modm::atomic::BlockQueue<Block, N>;
+
+}	// namespace modm::adc
+
+#endif	// MODM_ADC_STREAM_HPP
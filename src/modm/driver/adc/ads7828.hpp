@@ -4,6 +4,7 @@
  * Copyright (c) 2022, Jónas Holm Wentzlau
  * Copyright (c) 2022, Jonas Kazem Andersen
  * Copyright (c) 2022, Rasmus Kleist Hørlyck Sørensen
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -17,6 +18,8 @@
 #define MODM_ADS7828_HPP
 
 #include <modm/architecture/interface/i2c_device.hpp>
+#include <span>
+#include "adc_stream.hpp"
 
 namespace modm
 {
@@ -117,6 +120,14 @@ public:
      */
     Ads7828(Data &data, uint8_t address = 0b1001000);
 
+    /// Sets a new address of the device for single conversions and scans
+    void
+    setAddress(uint8_t address)
+    {
+        modm::I2cDevice<I2cMaster, 1>::setAddress(address);
+        scanTransaction.setAddress(address);
+    }
+
     /**
      * @brief Measures the voltage in a single channel
      *
@@ -151,10 +162,63 @@ public:
         return data;
     }
 
+    /**
+     * @brief Sets the channel sequence of a scan, at most 8 channels
+     */
+    void
+    setScan(std::span<const InputChannel> channels);
+
+    /**
+     * @brief Converts all channels of the scan into the next block of the ring
+     *
+     * All conversions are performed in one I2C transaction, in which the command
+     * byte and the result of every channel are chained by repeated starts.
+     *
+     * @return false if the ring is full or the transaction failed
+     */
+    template <class Ring>
+    modm::ResumableResult<bool>
+    readScan(Ring &ring);
+
 private:
+    /// start - write command - restart - read result - restart - ... - stop
+    class ScanTransaction : public modm::I2cTransaction
+    {
+    public:
+        ScanTransaction(uint8_t address) : I2cTransaction(address) {}
+
+        bool
+        configure(const uint8_t *commands, uint8_t *results, uint8_t count);
+
+    protected:
+        Starting
+        starting() override;
+
+        Writing
+        writing() override;
+
+        Reading
+        reading() override;
+
+    private:
+        const uint8_t *commands{nullptr};
+        uint8_t *results{nullptr};
+        uint8_t count{0};
+        uint8_t index{0};
+        bool isReading{false};
+    };
+
     Data &data;
 
     CommandByte_t commandByte;
+
+    ScanTransaction scanTransaction;
+    InputChannel scanChannels[8]{};
+    uint8_t scanCount{0};
+    uint8_t scanLength{0};
+    int32_t *scanValues{nullptr};
+    uint8_t scanCommands[8];
+    uint8_t scanData[16];
 };
 
 } // modm namespace
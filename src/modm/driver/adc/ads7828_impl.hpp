@@ -4,6 +4,7 @@
  * Copyright (c) 2022, Jónas Holm Wentzlau
  * Copyright (c) 2022, Jonas Kazem Andersen
  * Copyright (c) 2022, Rasmus Kleist Hørlyck Sørensen
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -21,7 +22,7 @@ namespace modm
 {
 
 template <typename I2cMaster>
-Ads7828<I2cMaster>::Ads7828(Data &data, uint8_t address) : modm::I2cDevice<I2cMaster, 1>(address), data(data)
+Ads7828<I2cMaster>::Ads7828(Data &data, uint8_t address) : modm::I2cDevice<I2cMaster, 1>(address), data(data), scanTransaction(address)
 {
 }
 
@@ -60,4 +61,101 @@ Ads7828<I2cMaster>::readConversionResult()
     RF_END_RETURN_CALL(this->runTransaction());
 }
 
+// ----------------------------------------------------------------------------
+
+template <typename I2cMaster>
+void
+Ads7828<I2cMaster>::setScan(std::span<const InputChannel> channels)
+{
+    scanCount = std::min<std::size_t>(channels.size(), std::size(scanChannels));
+    std::copy_n(channels.begin(), scanCount, scanChannels);
+}
+
+// ----------------------------------------------------------------------------
+
+template <typename I2cMaster>
+template <class Ring>
+modm::ResumableResult<bool>
+Ads7828<I2cMaster>::readScan(Ring &ring)
+{
+    RF_BEGIN();
+
+    if (auto *block = ring.reserve(); block) {
+        block->timestamp = modm::PreciseClock::now();
+        block->count = std::min<std::size_t>(scanCount, Ring::ValueType::channels);
+        scanLength = block->count;
+        scanValues = block->values;
+    } else {
+        RF_RETURN(false);
+    }
+
+    // the power down selection is kept for every conversion
+    for (uint8_t ii = 0; ii < scanLength; ii++)
+    {
+        CommandByte_t command = commandByte;
+        InputChannel_t::set(command, scanChannels[ii]);
+        scanCommands[ii] = command.value;
+    }
+
+    RF_WAIT_UNTIL(scanTransaction.configure(scanCommands, scanData, scanLength) and
+                  this->startTransaction(&scanTransaction));
+
+    RF_WAIT_WHILE(scanTransaction.isBusy());
+
+    if (scanTransaction.getState() == modm::I2c::TransactionState::Error) {
+        RF_RETURN(false);
+    }
+
+    for (uint8_t ii = 0; ii < scanLength; ii++) {
+        scanValues[ii] = (scanData[2 * ii] << 8) | scanData[2 * ii + 1];
+    }
+    ring.commit();
+
+    RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+
+template <typename I2cMaster>
+bool
+Ads7828<I2cMaster>::ScanTransaction::configure(const uint8_t *commands, uint8_t *results, uint8_t count)
+{
+    if (isBusy()) {
+        return false;
+    }
+    this->commands = commands;
+    this->results = results;
+    this->count = count;
+    index = 0;
+    isReading = false;
+    return true;
+}
+
+template <typename I2cMaster>
+modm::I2cTransaction::Starting
+Ads7828<I2cMaster>::ScanTransaction::starting()
+{
+    if (index >= count) {
+        return Starting(address, OperationAfterStart::Stop);
+    }
+    return Starting(address, isReading ? OperationAfterStart::Read : OperationAfterStart::Write);
+}
+
+template <typename I2cMaster>
+modm::I2cTransaction::Writing
+Ads7828<I2cMaster>::ScanTransaction::writing()
+{
+    isReading = true;
+    return Writing(&commands[index], 1, OperationAfterWrite::Restart);
+}
+
+template <typename I2cMaster>
+modm::I2cTransaction::Reading
+Ads7828<I2cMaster>::ScanTransaction::reading()
+{
+    isReading = false;
+    uint8_t *buffer = &results[2 * index++];
+    return Reading(buffer, 2, (index < count) ? OperationAfterRead::Restart : OperationAfterRead::Stop);
+}
+
 } // modm namespace
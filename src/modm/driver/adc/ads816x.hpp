@@ -2,6 +2,7 @@
 // ----------------------------------------------------------------------------
 /*
  * Copyright (c) 2021, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -19,6 +20,7 @@
 #include <modm/architecture/interface/gpio.hpp>
 #include <modm/processing/resumable.hpp>
 #include <modm/processing/timer/timeout.hpp>
+#include "adc_stream.hpp"
 
 namespace modm
 {
@@ -101,7 +103,7 @@ public:
 	Ads816x() = default;
 
 	/// Call this function before using the device or to change operation mode
-	/// \warning Only Mode::Manual is currently supported!
+	/// \warning Only Mode::Manual and Mode::AutoSequence are currently supported!
 	modm::ResumableResult<void>
 	initialize(Mode mode = Mode::Manual);
 
@@ -112,15 +114,17 @@ public:
 	modm::ResumableResult<uint16_t>
 	manualModeConversion(uint8_t afterNextChannel);
 
-	/*
-	// FIXME: Does not work correctly...
-	/// Start a "auto sequence" conversion.
-	/// The device will automatically cycle through the specified channels in
-	/// the bitmask.
-	template<std::size_t N>
+	/// Configure the channels of the auto sequence, bit n selects AIN n.
+	/// The device must be initialized with Mode::AutoSequence.
 	modm::ResumableResult<void>
-	autoSequenceConversion(uint8_t channelsBitmask, std::span<uint16_t, N> result);
-	*/
+	startScan(uint8_t channelsBitmask);
+
+	/// Start the auto sequence and read the result of every channel into the
+	/// next block of the ring. The results are sorted by their channel id.
+	/// @return false if the ring is full and the scan was skipped
+	template<class Ring>
+	modm::ResumableResult<bool>
+	readScan(Ring& ring);
 
 	/// Set T_CONV (minimal) value.
 	/// According to the datasheet 660ns (-> 1us) for ADS8168, 1200ns (-> 2us)
@@ -141,6 +145,11 @@ private:
 
 	modm::ShortPreciseTimeout timeout;
 	modm::ShortPreciseDuration tConv = std::chrono::microseconds(3);
+
+	uint8_t scanChannels{0};
+	uint8_t scanLength{0};
+	uint8_t scanIndex{0};
+	int32_t* scanValues{nullptr};
 };
 
 } // namespace modm
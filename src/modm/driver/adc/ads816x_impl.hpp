@@ -2,6 +2,7 @@
 // ----------------------------------------------------------------------------
 /*
  * Copyright (c) 2021, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -15,8 +16,7 @@
 #	error "Don't include this file directly! Use 'ads816x.hpp' instead."
 #endif
 
-//#include <bit>
-//#include <span>
+#include <bit>
 
 namespace modm
 {
@@ -73,48 +73,69 @@ Ads816x<SpiMaster, Cs>::manualModeConversion(uint8_t afterNextChannel)
 	RF_END_RETURN( static_cast<uint16_t>((static_cast<uint16_t>(buffer2[0]) << 8) | buffer2[1]) );
 }
 
-/*
-// FIXME: Does not work correctly...
 template <typename SpiMaster, typename Cs>
-template<std::size_t N>
 ResumableResult<void>
-Ads816x<SpiMaster, Cs>::autoSequenceConversion(uint8_t channelsBitmask, std::span<uint16_t, N> result)
+Ads816x<SpiMaster, Cs>::startScan(uint8_t channelsBitmask)
 {
 	RF_BEGIN();
 
-	if (std::popcount(channelsBitmask) > N) {
-		RF_RETURN();
-	}
+	scanChannels = channelsBitmask;
+
+	// Append the channel id to the result to sort the conversions
+	RF_CALL(registerAccess(Command::Write, Register::DATA_CNTL, uint8_t(DataFormat::ResultChannel)));
 
 	// Write channel bitmask config (AUTO_SEQ_CH)
 	RF_CALL(registerAccess(Command::Write, Register::AUTO_SEQ_CFG1, channelsBitmask));
 
-	timeout.restart(tConv);
-	RF_WAIT_UNTIL(timeout.isExpired());
+	RF_END();
+}
+
+template <typename SpiMaster, typename Cs>
+template <class Ring>
+ResumableResult<bool>
+Ads816x<SpiMaster, Cs>::readScan(Ring& ring)
+{
+	RF_BEGIN();
+
+	if (auto* block = ring.reserve(); block) {
+		block->timestamp = modm::PreciseClock::now();
+		block->count = std::min<std::size_t>(std::popcount(scanChannels), Ring::ValueType::channels);
+		scanLength = block->count;
+		scanValues = block->values;
+	} else {
+		RF_RETURN(false);
+	}
 
-	// Set SEQ_START (0b1 << 0) bit
+	// Set SEQ_START (0b1 << 0) bit, the rising chip select starts the first conversion
 	RF_CALL(registerAccess(Command::SetBits, Register::SEQ_START, 0b1));
 
-	// Read conversion results
-	for (buffer2[0] = 0; buffer2[0] < std::popcount(channelsBitmask); buffer2[0]++) {
+	RF_WAIT_UNTIL(this->acquireMaster());
+
+	// Every frame reads the previous conversion and starts the next one
+	for (scanIndex = 0; scanIndex < std::popcount(scanChannels); scanIndex++)
+	{
 		timeout.restart(tConv);
 		RF_WAIT_UNTIL(timeout.isExpired());
 
-		RF_WAIT_UNTIL(this->acquireMaster());
 		Cs::reset();
+		RF_CALL(SpiMaster::transfer(nullptr, buffer2, 3));
+		Cs::set();
 
-		RF_CALL(SpiMaster::transfer(nullptr, buffer, 2));
-
-		if (this->releaseMaster()) {
-			Cs::set();
+		if (const uint8_t channel = buffer2[2] >> 4;
+			channel < 8 and (scanChannels & (1 << channel)))
+		{
+			const uint8_t index = std::popcount(uint8_t(scanChannels & ((1 << channel) - 1)));
+			if (index < scanLength) {
+				scanValues[index] = (uint16_t(buffer2[0]) << 8) | buffer2[1];
+			}
 		}
-
-		result[buffer2[0]] = buffer[0] << 8 | buffer[1];
 	}
 
-	RF_END();
+	this->releaseMaster();
+	ring.commit();
+
+	RF_END_RETURN(true);
 }
-*/
 
 template <typename SpiMaster, typename Cs>
 modm::ResumableResult<uint8_t>
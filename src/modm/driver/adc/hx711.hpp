@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2020, Sascha Schade
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -15,6 +16,8 @@
 #include <modm/architecture/interface/delay.hpp>
 #include <modm/architecture/interface/gpio.hpp>
 #include <modm/processing/resumable.hpp>
+#include <span>
+#include "adc_stream.hpp"
 
 namespace modm
 {
@@ -49,8 +52,32 @@ public:
 	modm::ResumableResult<int32_t>
 	singleConversion();
 
+	/// Set the channel and gain sequence of a scan, at most 4 conversions
+	void
+	setScan(std::span<const InputChannelAndGain> channels);
+
+	/// Perform all conversions of the scan into the next block of the ring.
+	/// The pulses after each conversion already select the channel and gain of
+	/// the next one, so the scan runs without dummy conversions. Only the first
+	/// scan after setScan() or singleConversion() discards one conversion.
+	/// @return false if the ring is full and the scan was skipped
+	template<class Ring>
+	modm::ResumableResult<bool>
+	readScan(Ring& ring);
+
 private:
+	/// Shift in the 24 bit result followed by the pulses selecting the next conversion
+	int32_t
+	shiftIn(uint8_t pulses);
+
 	int32_t data;
+
+	InputChannelAndGain scanChannels[4]{};
+	uint8_t scanCount{0};
+	uint8_t scanLength{0};
+	uint8_t scanIndex{0};
+	bool scanPrimed{false};
+	int32_t* scanValues{nullptr};
 };
 
 } // modm namespace
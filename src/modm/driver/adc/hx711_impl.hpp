@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2020, Sascha Schade
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -24,21 +25,80 @@ Hx711<Cfg>::singleConversion()
 
 	RF_WAIT_UNTIL(Data::read() == modm::Gpio::Low);
 
+	// Additional pulses for mode of next conversion
+	data = shiftIn(static_cast<uint8_t>(Cfg::mode));
+	scanPrimed = false;
+
+	RF_END_RETURN(data);
+}
+
+template <typename Cfg>
+void
+Hx711<Cfg>::setScan(std::span<const InputChannelAndGain> channels)
+{
+	scanCount = std::min<std::size_t>(channels.size(), std::size(scanChannels));
+	std::copy_n(channels.begin(), scanCount, scanChannels);
+	scanPrimed = false;
+}
+
+template <typename Cfg>
+template <class Ring>
+ResumableResult<bool>
+Hx711<Cfg>::readScan(Ring& ring)
+{
+	RF_BEGIN();
+
+	if (scanCount == 0) {
+		RF_RETURN(false);
+	}
+
+	if (auto* block = ring.reserve(); block) {
+		block->timestamp = modm::PreciseClock::now();
+		block->count = std::min<std::size_t>(scanCount, Ring::ValueType::channels);
+		scanLength = block->count;
+		scanValues = block->values;
+	} else {
+		RF_RETURN(false);
+	}
+
+	if (not scanPrimed)
+	{
+		// The running conversion still uses the previous channel and gain
+		RF_WAIT_UNTIL(Data::read() == modm::Gpio::Low);
+		shiftIn(static_cast<uint8_t>(scanChannels[0]));
+		scanPrimed = true;
+	}
+
+	for (scanIndex = 0; scanIndex < scanLength; scanIndex++)
+	{
+		RF_WAIT_UNTIL(Data::read() == modm::Gpio::Low);
+		scanValues[scanIndex] = shiftIn(static_cast<uint8_t>(
+				scanChannels[(scanIndex + 1 < scanLength) ? scanIndex + 1 : 0]));
+	}
+
+	ring.commit();
+
+	RF_END_RETURN(true);
+}
+
+template <typename Cfg>
+int32_t
+Hx711<Cfg>::shiftIn(uint8_t pulses)
+{
 	modm::delay_us(1);
 
-	data = 0;
+	int32_t value = 0;
 	for (uint8_t ii = 0; ii < 24; ++ii)
 	{
 		Sck::set();
 		modm::delay_us(1);
-		data = (data << 1) | Data::read();
+		value = (value << 1) | Data::read();
 		modm::delay_us(1);
 		Sck::reset();
 		modm::delay_us(1);
 	}
 
-	// Additional pulses for mode of next conversion
-	for (uint8_t ii = 0; ii < static_cast<uint8_t>(Cfg::mode); ++ii) {
+	for (uint8_t ii = 0; ii < pulses; ++ii) {
 		Sck::set();
 		modm::delay_us(1);
 		Sck::reset();
@@ -46,11 +106,11 @@ Hx711<Cfg>::singleConversion()
 	}
 
 	// Fill up MSBs for negative numbers
-	if (data & (1 << 23)) {
-		data |= 0xff000000;
+	if (value & (1 << 23)) {
+		value |= 0xff000000;
 	}
 
-	RF_END_RETURN(data);
+	return value;
 }
 
 } // modm namespace
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -13,8 +14,10 @@
 #define MODM_MCP3008_HPP
 
 #include <array>
+#include <span>
 #include <modm/architecture/interface/spi_device.hpp>
 #include <modm/processing/resumable.hpp>
+#include "adc_stream.hpp"
 
 namespace modm
 {
@@ -68,9 +71,30 @@ public:
     modm::ResumableResult<uint16_t>
     read(Channel channel);
 
+    /// Set the channel sequence of a scan, at most 8 channels
+    void setScan(std::span<const Channel> channels);
+
+    /**
+     * Convert all channels of the scan into the next block of the ring.
+     *
+     * The SPI master is acquired once for the whole scan, the chip select
+     * frames every conversion, since the MCP3008 samples on its falling edge.
+     *
+     * @return false if the ring is full and the scan was skipped
+     */
+    template<class Ring>
+    modm::ResumableResult<bool>
+    readScan(Ring& ring);
+
 private:
     uint8_t rxBuffer_[3]{};
     uint8_t txBuffer_[3]{1, 0, 0};
+
+    Channel scanChannels_[8]{};
+    uint8_t scanCount_{0};
+    uint8_t scanLength_{0};
+    uint8_t scanIndex_{0};
+    int32_t* scanValues_{nullptr};
 };
 
 } // namespace modm
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -47,4 +48,46 @@ Mcp3008<SpiMaster, Cs>::read(Channel channel)
     RF_END_RETURN(uint16_t(((rxBuffer_[1] & 0b11) << 8) | rxBuffer_[2]));
 }
 
+template <typename SpiMaster, typename Cs>
+void
+Mcp3008<SpiMaster, Cs>::setScan(std::span<const Channel> channels)
+{
+    scanCount_ = std::min<std::size_t>(channels.size(), std::size(scanChannels_));
+    std::copy_n(channels.begin(), scanCount_, scanChannels_);
+}
+
+template <typename SpiMaster, typename Cs>
+template <class Ring>
+modm::ResumableResult<bool>
+Mcp3008<SpiMaster, Cs>::readScan(Ring& ring)
+{
+    RF_BEGIN();
+
+    if (auto* block = ring.reserve(); block) {
+        block->timestamp = modm::PreciseClock::now();
+        block->count = std::min<std::size_t>(scanCount_, Ring::ValueType::channels);
+        scanLength_ = block->count;
+        scanValues_ = block->values;
+    } else {
+        RF_RETURN(false);
+    }
+
+    RF_WAIT_UNTIL(this->acquireMaster());
+
+    for (scanIndex_ = 0; scanIndex_ < scanLength_; scanIndex_++)
+    {
+        Cs::reset();
+        txBuffer_[1] = static_cast<uint8_t>(scanChannels_[scanIndex_]) << 4;
+        RF_CALL(SpiMaster::transfer(txBuffer_, rxBuffer_, 3));
+        Cs::set();
+
+        scanValues_[scanIndex_] = ((rxBuffer_[1] & 0b11) << 8) | rxBuffer_[2];
+    }
+
+    this->releaseMaster();
+    ring.commit();
+
+    RF_END_RETURN(true);
+}
+
 } // namespace modm
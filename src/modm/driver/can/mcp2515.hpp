@@ -4,6 +4,7 @@
  * Copyright (c) 2010, Thorsten Lajewski
  * Copyright (c) 2012-2015, 2017-2018, Niklas Hauser
  * Copyright (c) 2014, 2017, Sascha Schade
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -20,6 +21,9 @@
 #include <modm/architecture/interface/accessor.hpp>
 #include <modm/architecture/interface/delay.hpp>
 #include <modm/architecture/interface/can.hpp>
+#include <modm/architecture/interface/can_filter.hpp>
+#include <modm/architecture/interface/can_message.hpp>
+#include <modm/architecture/driver/atomic/queue.hpp>
 #include <modm/debug/logger.hpp>
 
 #include "mcp2515_definitions.hpp"
@@ -103,9 +107,28 @@ namespace modm
 	 *
 	 * \brief	Driver for the MPC2515 CAN controller
 	 *
+	 * The controller signals received frames, finished transmissions and
+	 * errors with its INT pin. `update()` services the controller while the
+	 * pin is asserted: Both hardware receive buffers are drained into a
+	 * software queue, each frame with a single READ RX BUFFER transfer, and
+	 * free transmit buffers are refilled from the software transmit queue.
+	 * Call `update()` from the falling edge interrupt of the INT pin, or
+	 * regularly from the main loop. All other functions call it as well, so
+	 * a polling application works without changes.
+	 *
+	 * All three transmit buffers are used. Each frame is loaded together
+	 * with its transmit priority in one transfer, and the priorities are
+	 * chosen so that the controller sends the frames in the order they were
+	 * passed to `sendMessage()`.
+	 *
+	 * The SPI transfers are done with interrupts disabled, so that calls
+	 * from the interrupt and the main loop cannot interleave.
+	 *
 	 * \tparam	SPI		SPI interface
 	 * \tparam	CS		Chip select pin
 	 * \tparam	INT		Interrupt pin
+	 * \tparam	RxBufferSize	Number of messages in the software receive queue
+	 * \tparam	TxBufferSize	Number of messages in the software transmit queue
 	 *
 	 * If you want to activate the internal pull-up for the INT pin you
 	 * need to do this by yourself before calling the initialize method!
@@ -115,9 +138,26 @@ namespace modm
 	 */
 	template < typename SPI,
 			   typename CS,
-			   typename INT >
+			   typename INT,
+			   std::size_t RxBufferSize = 8,
+			   std::size_t TxBufferSize = 4 >
     class Mcp2515 : public ::modm::Can
 	{
+		static_assert(RxBufferSize > 0 and TxBufferSize > 0,
+				"The software queues must hold at least one message!");
+
+	public:
+		/// Counters of lost and rejected messages
+		struct Statistics
+		{
+			/// Frames lost, because both hardware receive buffers were full
+			uint16_t rxHardwareOverflows;
+			/// Frames dropped, because the software receive queue was full
+			uint16_t rxQueueOverflows;
+			/// Messages rejected, because the software transmit queue was full
+			uint16_t txQueueOverflows;
+		};
+
 	public:
 		template<frequency_t ExternalClock, bitrate_t bitrate=kbps(125), percent_t tolerance=pct(1) >
 		static inline bool
@@ -136,9 +176,39 @@ namespace modm
 		static void
 		setFilter(accessor::Flash<uint8_t> filter);
 
+		/**
+		 * Sets one of the six acceptance filters to a standard identifier.
+		 *
+		 * Filters 0 and 1 use mask 0 and receive into buffer 0, filters 2
+		 * to 5 use mask 1 and receive into buffer 1.
+		 *
+		 * \return false if the index is out of range
+		 */
+		static bool
+		setFilter(uint8_t index, can::StandardIdentifier identifier);
+
+		/// Sets one of the six acceptance filters to an extended identifier.
+		static bool
+		setFilter(uint8_t index, can::ExtendedIdentifier identifier);
+
+		/**
+		 * Sets one of the two acceptance masks for standard identifiers.
+		 *
+		 * \return false if the index is out of range
+		 */
+		static bool
+		setMask(uint8_t index, can::StandardMask mask);
+
+		/// Sets one of the two acceptance masks for extended identifiers.
+		static bool
+		setMask(uint8_t index, can::ExtendedMask mask);
+
 		static void
 		setMode(Can::Mode mode);
 
+		/// Services the controller as long as its INT pin is asserted.
+		static void
+		update();
 
 		static inline bool
 		isMessageAvailable();
@@ -162,6 +232,14 @@ namespace modm
 		static bool
 		sendMessage(const can::Message& message);
 
+		static const Statistics&
+		getStatistics()
+		{ return statistics; }
+
+		static void
+		resetStatistics()
+		{ statistics = {}; }
+
     public:
         // Extended Functionality
 
@@ -187,6 +265,10 @@ namespace modm
 			BIT_MODIFY = 0x05
 		};
 
+		/// Size of the identifier and DLC registers of a buffer
+		static constexpr uint8_t HeaderSize = 5;
+		static constexpr uint8_t FrameSize = HeaderSize + 8;
+
 		static void
 		writeRegister(uint8_t address, uint8_t data);
 
@@ -199,16 +281,46 @@ namespace modm
 		static uint8_t
 		readStatus(uint8_t type);
 
-		static inline void
-		writeIdentifier(const uint32_t& identifier, bool isExtendedFrame);
+		/// Writes the four identifier registers of a filter or mask
+		static bool
+		writeAcceptance(uint8_t address, const uint8_t *identifier);
 
-		static inline bool
-		readIdentifier(uint32_t& identifier);
+		/// Changes the operation mode and waits until it is active
+		static void
+		changeMode(uint8_t mode);
+
+		/// Handles all pending interrupt flags once
+		static void
+		serviceInterrupts();
+
+		/// Loads queued messages into free transmit buffers
+		static void
+		transmitQueued();
+
+		static bool
+		loadTransmitBuffer(const can::Message& message);
+
+		static void
+		encodeIdentifier(uint32_t identifier, bool isExtendedFrame, uint8_t *buffer);
+
+		/// Encodes identifier, DLC and data, returns the number of bytes
+		static uint8_t
+		encodeFrame(const can::Message& message, uint8_t *buffer);
+
+		static void
+		decodeFrame(const uint8_t *buffer, can::Message& message);
 
 	protected:
 		static SPI spi;
 		static CS chipSelect;
 		static INT interruptPin;
+
+		static inline modm::atomic::Queue<can::Message, RxBufferSize> rxQueue;
+		static inline modm::atomic::Queue<can::Message, TxBufferSize> txQueue;
+		static inline Statistics statistics{};
+		/// Transmit buffers waiting for transmission and their priorities
+		static inline uint8_t txPending{0};
+		static inline uint8_t txPriority[3]{};
 	};
 }
 
@@ -4,6 +4,7 @@
  * Copyright (c) 2010, Thorsten Lajewski
  * Copyright (c) 2012-2015, 2017-2018, Niklas Hauser
  * Copyright (c) 2014, 2017, Sascha Schade
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -20,26 +21,28 @@
 #include "mcp2515_bit_timings.hpp"
 #include "mcp2515_definitions.hpp"
 #include <modm/architecture/interface/assert.hpp>
+#include <modm/architecture/interface/atomic_lock.hpp>
+#include <algorithm>
 
 
 #undef	MODM_LOG_LEVEL
 #define	MODM_LOG_LEVEL modm::log::DISABLED
 
 // ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename INT>
-SPI modm::Mcp2515<SPI, CS, INT>::spi;
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+SPI modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::spi;
 
-template <typename SPI, typename CS, typename INT>
-CS modm::Mcp2515<SPI, CS, INT>::chipSelect;
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+CS modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::chipSelect;
 
-template <typename SPI, typename CS, typename INT>
-INT modm::Mcp2515<SPI, CS, INT>::interruptPin;
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+INT modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::interruptPin;
 
 // ----------------------------------------------------------------------------
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 bool
-modm::Mcp2515<SPI, CS, INT>::initializeWithPrescaler(
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::initializeWithPrescaler(
 	uint8_t prescaler /* 2 .. 128 */,
 	uint8_t sjw       /* in 1TQ .. 3TQ */,
 	uint8_t prop      /* in 1TQ .. 8TQ */,
@@ -85,9 +88,12 @@ modm::Mcp2515<SPI, CS, INT>::initializeWithPrescaler(
 	spi.transferBlocking(cnf, nullptr, 3);
 
 	// enable interrupts
-	spi.transferBlocking(RX1IE | RX0IE);
+	spi.transferBlocking(ERRIE | TX2IE | TX1IE | TX0IE | RX1IE | RX0IE);
 	chipSelect.set();
 
+	// roll over into buffer 1 if buffer 0 is still full
+	writeRegister(RXB0CTRL, BUKT);
+
 	// set TXnRTS pins as inwrites
 	writeRegister(TXRTSCTRL, 0);
 
@@ -101,6 +107,12 @@ modm::Mcp2515<SPI, CS, INT>::initializeWithPrescaler(
 				"Cannot read the CNF2 register of the MCP2515!", readback))
 		return false;
 
+	// discard the state of the previous session
+	while (rxQueue.isNotEmpty()) rxQueue.pop();
+	while (txQueue.isNotEmpty()) txQueue.pop();
+	txPending = 0;
+	statistics = {};
+
 	// reset device to normal mode and disable the clkout pin and
 	// wait until the new mode is active
 	writeRegister(CANCTRL, 0);
@@ -112,10 +124,10 @@ modm::Mcp2515<SPI, CS, INT>::initializeWithPrescaler(
 }
 
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 template <modm::frequency_t externalClockFrequency, modm::bitrate_t bitrate, modm::percent_t tolerance>
 bool
-modm::Mcp2515<SPI, CS, INT>::initialize()
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::initialize()
 {
 	using Timings = modm::CanBitTimingMcp2515<externalClockFrequency, bitrate>;
 
@@ -128,9 +140,9 @@ modm::Mcp2515<SPI, CS, INT>::initialize()
 }
 
 // ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 void
-modm::Mcp2515<SPI, CS, INT>::setFilter(accessor::Flash<uint8_t> filter)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::setFilter(accessor::Flash<uint8_t> filter)
 {
 	using namespace mcp2515;
 
@@ -163,9 +175,73 @@ modm::Mcp2515<SPI, CS, INT>::setFilter(accessor::Flash<uint8_t> filter)
 }
 
 // ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::setFilter(uint8_t index, can::StandardIdentifier identifier)
+{
+	if (index >= 6) return false;
+	uint8_t buffer[4];
+	encodeIdentifier(identifier.id, false, buffer);
+	return writeAcceptance((index < 3) ? index * 4 : 0x10 + (index - 3) * 4, buffer);
+}
+
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::setFilter(uint8_t index, can::ExtendedIdentifier identifier)
+{
+	if (index >= 6) return false;
+	uint8_t buffer[4];
+	encodeIdentifier(identifier.id, true, buffer);
+	return writeAcceptance((index < 3) ? index * 4 : 0x10 + (index - 3) * 4, buffer);
+}
+
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::setMask(uint8_t index, can::StandardMask mask)
+{
+	if (index >= 2) return false;
+	uint8_t buffer[4];
+	// the data bytes of standard frames are not filtered
+	encodeIdentifier(mask.mask, false, buffer);
+	return writeAcceptance(mcp2515::RXM0SIDH + index * 4, buffer);
+}
+
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::setMask(uint8_t index, can::ExtendedMask mask)
+{
+	if (index >= 2) return false;
+	uint8_t buffer[4];
+	encodeIdentifier(mask.mask, true, buffer);
+	// the mask has no extended identifier bit
+	buffer[1] &= ~mcp2515::EXIDE;
+	return writeAcceptance(mcp2515::RXM0SIDH + index * 4, buffer);
+}
+
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::writeAcceptance(uint8_t address, const uint8_t *identifier)
+{
+	using namespace mcp2515;
+	modm::atomic::Lock lock;
+
+	// filters and masks can only be changed in configuration mode
+	const uint8_t mode = readRegister(CANSTAT) & (OPMOD2 | OPMOD1 | OPMOD0);
+	changeMode(REQOP2);
+
+	uint8_t buffer[6] = {WRITE, address, identifier[0], identifier[1], identifier[2], identifier[3]};
+	chipSelect.reset();
+	spi.transferBlocking(buffer, nullptr, sizeof(buffer));
+	chipSelect.set();
+
+	changeMode(mode);
+	return true;
+}
+
+// ----------------------------------------------------------------------------
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 void
-modm::Mcp2515<SPI, CS, INT>::setMode(Can::Mode mode)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::setMode(Can::Mode mode)
 {
 	using namespace mcp2515;
 
@@ -177,140 +253,202 @@ modm::Mcp2515<SPI, CS, INT>::setMode(Can::Mode mode)
 		reg = REQOP1;
 	}
 
+	modm::atomic::Lock lock;
+	changeMode(reg);
+}
+
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+void
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::changeMode(uint8_t mode)
+{
+	using namespace mcp2515;
+
 	// set the new mode
-	bitModify(CANCTRL, REQOP2 | REQOP1 | REQOP0, reg);
+	bitModify(CANCTRL, REQOP2 | REQOP1 | REQOP0, mode);
 
-	while ((readRegister(CANSTAT) &	(OPMOD2 | OPMOD1 | OPMOD0)) != reg) {
+	while ((readRegister(CANSTAT) &	(OPMOD2 | OPMOD1 | OPMOD0)) != mode) {
 		// wait for the new mode to become active
 	}
 }
 
 // ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename INT>
-bool
-modm::Mcp2515<SPI, CS, INT>::isMessageAvailable()
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+void
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::update()
 {
-	return !interruptPin.read();
+	modm::atomic::Lock lock;
+
+	// bounded, so that a stuck INT pin cannot block forever
+	for (uint8_t ii = 0; ii < 4 and not interruptPin.read(); ii++) {
+		serviceInterrupts();
+	}
 }
 
-// ----------------------------------------------------------------------------
-template <typename SPI, typename CS, typename INT>
-bool
-modm::Mcp2515<SPI, CS, INT>::getMessage(can::Message& message)
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+void
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::serviceInterrupts()
 {
 	using namespace mcp2515;
 
-	uint8_t status = readStatus(RX_STATUS);
-	uint8_t address;
-	if (status & FLAG_RXB0_FULL) {
-		address = READ_RX;			// message in buffer 0
-	}
-	else if (status & FLAG_RXB1_FULL) {
-		address = READ_RX | 0x04;	// message in buffer 1 (RXB1SIDH)
-	}
-	else {
-		return false;				// Error: no message available
-	}
-
+	// read CANINTF and EFLG at once
+	uint8_t flags[4] = {READ, CANINTF, 0xff, 0xff};
 	chipSelect.reset();
-	spi.transferBlocking(address);
+	spi.transferBlocking(flags, flags, sizeof(flags));
+	chipSelect.set();
+	const uint8_t interrupts = flags[2];
+	const uint8_t errors = flags[3];
+
+	// buffer 0 holds the older frame, if both are full
+	for (uint8_t buffer = 0; buffer < 2; buffer++)
+	{
+		if (not (interrupts & (RX0IF << buffer))) continue;
+
+		// rising CS clears the RXnIF flag, see section 12.4 in datasheet.
+		uint8_t frame[1 + FrameSize];
+		frame[0] = READ_RX | (buffer << 2);
+		std::fill(frame + 1, frame + sizeof(frame), 0xff);
+		chipSelect.reset();
+		spi.transferBlocking(frame, frame, sizeof(frame));
+		chipSelect.set();
 
-	message.flags.extended = readIdentifier(message.identifier);
-	if (status & FLAG_RTR) {
-		message.flags.rtr = true;
+		can::Message message;
+		decodeFrame(frame + 1, message);
+		if (not rxQueue.push(message)) statistics.rxQueueOverflows++;
 	}
-	else {
-		message.flags.rtr = false;
+
+	const uint8_t overflows = errors & (RX1OVR | RX0OVR);
+	if (overflows)
+	{
+		if (overflows & RX0OVR) statistics.rxHardwareOverflows++;
+		if (overflows & RX1OVR) statistics.rxHardwareOverflows++;
+		bitModify(EFLG, overflows, 0);
 	}
-	message.length = spi.transferBlocking(0xff) & 0x0f;
 
-	for (uint8_t i = 0; i < message.length; ++i) {
-		message.data[i] = spi.transferBlocking(0xff);
+	const uint8_t handled = interrupts & (ERRIF | TX2IF | TX1IF | TX0IF);
+	if (handled)
+	{
+		bitModify(CANINTF, handled, 0);
+		txPending &= ~((handled >> 2) & 0b111);
 	}
-	chipSelect.set();
 
-	// RX0IF or RX1IF respectivly were already cleared automatically by rising CS.
-	// See section 12.4 in datasheet.
+	transmitQueued();
+}
+
+// ----------------------------------------------------------------------------
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::isMessageAvailable()
+{
+	update();
+	return rxQueue.isNotEmpty();
+}
+
+// ----------------------------------------------------------------------------
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::getMessage(can::Message& message)
+{
+	modm::atomic::Lock lock;
+	update();
 
+	if (rxQueue.isEmpty()) {
+		return false;				// Error: no message available
+	}
+	message = rxQueue.get();
+	rxQueue.pop();
 	return true;
 }
 
 // ----------------------------------------------------------------------------
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 bool
-modm::Mcp2515<SPI, CS, INT>::isReadyToSend()
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::isReadyToSend()
 {
-	using namespace mcp2515;
+	update();
+	return txQueue.isNotFull();
+}
 
-	if ((readStatus(READ_STATUS) & (TXB2CNTRL_TXREQ | TXB1CNTRL_TXREQ | TXB0CNTRL_TXREQ)) ==
-			(TXB2CNTRL_TXREQ | TXB1CNTRL_TXREQ | TXB0CNTRL_TXREQ))
-	{
-		// all buffers currently in use
-		return false;
-	}
-	else {
+// ----------------------------------------------------------------------------
+
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+bool
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::sendMessage(const can::Message& message)
+{
+	modm::atomic::Lock lock;
+	update();
+
+	// queued messages go first to keep the order
+	if (txQueue.isEmpty() and loadTransmitBuffer(message)) {
 		return true;
 	}
+	if (not txQueue.push(message)) {
+		statistics.txQueueOverflows++;
+		return false;
+	}
+	return true;
 }
 
-// ----------------------------------------------------------------------------
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+void
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::transmitQueued()
+{
+	while (txQueue.isNotEmpty() and loadTransmitBuffer(txQueue.get())) {
+		txQueue.pop();
+	}
+}
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 bool
-modm::Mcp2515<SPI, CS, INT>::sendMessage(const can::Message& message)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::loadTransmitBuffer(const can::Message& message)
 {
 	using namespace mcp2515;
 
-	uint8_t status = readStatus(READ_STATUS);
-	uint8_t address;
-	if ((status & TXB0CNTRL_TXREQ) == 0) {
-		address = 0x00;		// TXB0SIDH
-	}
-	else if ((status & TXB1CNTRL_TXREQ) == 0) {
-		address = 0x02;		// TXB1SIDH
-	}
-	else if ((status & TXB2CNTRL_TXREQ) == 0) {
-		address = 0x04;		// TXB2SIDH
+	// The controller sends the pending buffer with the highest priority
+	// first, so a new frame must get a lower priority than all pending ones.
+	uint8_t priority = TXP1 | TXP0;
+	uint8_t buffer = 3;
+	for (uint8_t ii = 0; ii < 3; ii++)
+	{
+		if (txPending & (1 << ii))
+		{
+			if (txPriority[ii] == 0) return false;
+			priority = std::min<uint8_t>(priority, txPriority[ii] - 1);
+		}
+		else if (buffer == 3) {
+			buffer = ii;
+		}
 	}
-	else {
+	if (buffer == 3) {
 		// all buffer are in use => could not send the message
 		return false;
 	}
 
+	// write the priority in TXBnCTRL followed by the frame
+	uint8_t frame[3 + FrameSize];
+	frame[0] = WRITE;
+	frame[1] = TXB0CTRL + buffer * 0x10;
+	frame[2] = priority;
+	const uint8_t length = 3 + encodeFrame(message, frame + 3);
 	chipSelect.reset();
-	spi.transferBlocking(WRITE_TX | address);
-	writeIdentifier(message.identifier, message.flags.extended);
-
-	// if the message is a rtr-frame, is has a length but no attached data
-	if (message.flags.rtr) {
-		spi.transferBlocking(MCP2515_RTR | message.length);
-	}
-	else {
-		spi.transferBlocking(message.length);
-
-		for (uint8_t i = 0; i < message.length; ++i) {
-			spi.transferBlocking(message.data[i]);
-		}
-	}
+	spi.transferBlocking(frame, nullptr, length);
 	chipSelect.set();
 
-	modm::delay_us(1);
-
 	// send message via RTS command
 	chipSelect.reset();
-	address = (address == 0) ? 1 : address;	// 0 2 4 => 1 2 4
-	spi.transferBlocking(RTS | address);
+	spi.transferBlocking(RTS | (1 << buffer));
 	chipSelect.set();
 
-	return address;
+	txPending |= (1 << buffer);
+	txPriority[buffer] = priority;
+	return true;
 }
 
 // ----------------------------------------------------------------------------
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 void
-modm::Mcp2515<SPI, CS, INT>::writeRegister(uint8_t address, uint8_t data)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::writeRegister(uint8_t address, uint8_t data)
 {
 	chipSelect.reset();
 
@@ -321,9 +459,9 @@ modm::Mcp2515<SPI, CS, INT>::writeRegister(uint8_t address, uint8_t data)
 	chipSelect.set();
 }
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 uint8_t
-modm::Mcp2515<SPI, CS, INT>::readRegister(uint8_t address)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::readRegister(uint8_t address)
 {
 	chipSelect.reset();
 
@@ -336,9 +474,9 @@ modm::Mcp2515<SPI, CS, INT>::readRegister(uint8_t address)
 	return data;
 }
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 void
-modm::Mcp2515<SPI, CS, INT>::bitModify(uint8_t address, uint8_t mask, uint8_t data)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::bitModify(uint8_t address, uint8_t mask, uint8_t data)
 {
 	chipSelect.reset();
 
@@ -350,9 +488,9 @@ modm::Mcp2515<SPI, CS, INT>::bitModify(uint8_t address, uint8_t mask, uint8_t da
 	chipSelect.set();
 }
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 uint8_t
-modm::Mcp2515<SPI, CS, INT>::readStatus(uint8_t type)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::readStatus(uint8_t type)
 {
 	chipSelect.reset();
 
@@ -366,74 +504,67 @@ modm::Mcp2515<SPI, CS, INT>::readStatus(uint8_t type)
 
 // ----------------------------------------------------------------------------
 
-template <typename SPI, typename CS, typename INT>
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
 void
-modm::Mcp2515<SPI, CS, INT>::writeIdentifier(const uint32_t& identifier,
-											 bool isExtendedFrame)
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::encodeIdentifier(uint32_t identifier,
+		bool isExtendedFrame, uint8_t *buffer)
 {
 	using namespace mcp2515;
 
-	const uint32_t *ptr = &identifier;
-
 	if (isExtendedFrame)
 	{
-		spi.transferBlocking(*((uint16_t *) ptr + 1) >> 5);
-
-		// calculate the next values
-		uint8_t temp;
-		temp  = (*((uint8_t *) ptr + 2) << 3) & 0xe0;
-		temp |= MCP2515_IDE;
-		temp |= (*((uint8_t *) ptr + 2)) & 0x03;
-
-		spi.transferBlocking(temp);
-		spi.transferBlocking(*((uint8_t *) ptr + 1));
-		spi.transferBlocking(*((uint8_t *) ptr));
+		buffer[0] = identifier >> 21;
+		buffer[1] = ((identifier >> 13) & 0xe0) | EXIDE | ((identifier >> 16) & 0x03);
+		buffer[2] = identifier >> 8;
+		buffer[3] = identifier;
 	}
 	else
 	{
-		spi.transferBlocking(*((uint16_t *) ptr) >> 3);
-		spi.transferBlocking(*((uint8_t *) ptr) << 5);
-		spi.transferBlocking(0);
-		spi.transferBlocking(0);
+		buffer[0] = identifier >> 3;
+		buffer[1] = identifier << 5;
+		buffer[2] = 0;
+		buffer[3] = 0;
 	}
 }
 
-template <typename SPI, typename CS, typename INT>
-bool
-modm::Mcp2515<SPI, CS, INT>::readIdentifier(uint32_t& identifier)
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+uint8_t
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::encodeFrame(const can::Message& message, uint8_t *buffer)
 {
 	using namespace mcp2515;
 
-	uint32_t *ptr = &identifier;
+	encodeIdentifier(message.identifier, message.isExtended(), buffer);
 
-	uint8_t first  = spi.transferBlocking(0xff);
-	uint8_t second = spi.transferBlocking(0xff);
-
-	if (second & MCP2515_IDE)
-	{
-		*((uint16_t *) ptr + 1)  = (uint16_t) first << 5;
-		*((uint8_t *)  ptr + 1)  = spi.transferBlocking(0xff);
-
-		*((uint8_t *)  ptr + 2) |= (second >> 3) & 0x1C;
-		*((uint8_t *)  ptr + 2) |=  second & 0x03;
+	// if the message is a rtr-frame, is has a length but no attached data
+	const uint8_t length = std::min<uint8_t>(message.length, 8);
+	if (message.isRemoteTransmitRequest()) {
+		buffer[4] = MCP2515_RTR | length;
+		return HeaderSize;
+	}
+	buffer[4] = length;
+	std::copy_n(message.data, length, buffer + HeaderSize);
+	return HeaderSize + length;
+}
 
-		*((uint8_t *)  ptr)      = spi.transferBlocking(0xff);
+template <typename SPI, typename CS, typename INT, std::size_t RxBufferSize, std::size_t TxBufferSize>
+void
+modm::Mcp2515<SPI, CS, INT, RxBufferSize, TxBufferSize>::decodeFrame(const uint8_t *buffer, can::Message& message)
+{
+	using namespace mcp2515;
 
-		return true;
+	if (buffer[1] & MCP2515_IDE)
+	{
+		message.identifier = (uint32_t(buffer[0]) << 21) | (uint32_t(buffer[1] & 0xe0) << 13) |
+				(uint32_t(buffer[1] & 0x03) << 16) | (uint16_t(buffer[2]) << 8) | buffer[3];
+		message.setExtended(true);
+		message.setRemoteTransmitRequest(buffer[4] & MCP2515_RTR);
 	}
 	else
 	{
-		spi.transferBlocking(0xff);
-
-		*((uint8_t *)  ptr + 3) = 0;
-		*((uint8_t *)  ptr + 2) = 0;
-
-		*((uint16_t *) ptr) = (uint16_t) first << 3;
-
-		spi.transferBlocking(0xff);
-
-		*((uint8_t *) ptr) |= second >> 5;
-
-		return false;
+		message.identifier = (uint16_t(buffer[0]) << 3) | (buffer[1] >> 5);
+		message.setExtended(false);
+		message.setRemoteTransmitRequest(buffer[1] & MCP2515_SRR);
 	}
+	message.setLength(std::min<uint8_t>(buffer[4] & 0x0f, 8));
+	std::copy_n(buffer + HeaderSize, message.length, message.data);
 }
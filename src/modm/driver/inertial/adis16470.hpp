@@ -1,6 +1,7 @@
 // coding: utf-8
 /*
  * Copyright (c) 2022, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -13,9 +14,12 @@
 #ifndef MODM_ADIS16470_HPP
 #define MODM_ADIS16470_HPP
 
+#include <algorithm>
 #include <array>
+#include <numbers>
 #include <optional>
 #include <span>
+#include <modm/architecture/driver/atomic/block_queue.hpp>
 #include <modm/architecture/interface/spi_device.hpp>
 #include <modm/architecture/interface/register.hpp>
 #include <modm/architecture/interface/gpio.hpp>
@@ -177,6 +181,66 @@ struct adis16470
 		BiasCorrectionUpdate		= Bit0, ///< Triggers a bias correction update
 	};
 	MODM_FLAGS16(GlobCmd);
+
+	/// Size of the burst read response in bytes including the command
+	static constexpr std::size_t BurstSize = 22;
+
+	/// Gyroscope scale of the 16-bit output in rad/s per LSB (0.1 °/s)
+	static constexpr float GyroScale = 0.1f * std::numbers::pi_v<float> / 180.f;
+	/// Accelerometer scale of the 16-bit output in m/s² per LSB (1.25 mg)
+	static constexpr float AccelScale = 1.25e-3f * 9.80665f;
+	/// Temperature scale in °C per LSB
+	static constexpr float TemperatureScale = 0.1f;
+
+	/// Raw output data of a burst read
+	struct Burst
+	{
+		/// Time at which the burst read was started
+		modm::PreciseClock::time_point timestamp;
+		DiagStat_t diagStat;
+		int16_t gyro[3];
+		int16_t accel[3];
+		int16_t temperature;
+		/// DATA_CNTR, or TIME_STAMP in scaled sync mode
+		uint16_t counter;
+	};
+
+	/// Output data of a burst read in SI units
+	struct Sample
+	{
+		modm::PreciseClock::time_point timestamp;
+		DiagStat_t diagStat;
+		/// Angular rate in rad/s
+		float angularRate[3];
+		/// Acceleration in m/s²
+		float acceleration[3];
+		/// Temperature in °C
+		float temperature;
+		uint16_t counter;
+	};
+
+	/**
+	 * @brief Verify the checksum of a burst read response and decode it.
+	 *
+	 * The timestamp of the burst is not modified.
+	 *
+	 * @return False in case of a checksum mismatch.
+	 */
+	static bool
+	decodeBurst(std::span<const uint8_t, BurstSize> response, Burst& burst);
+
+	/**
+	 * @brief Scale a block of bursts to SI units.
+	 *
+	 * @return The number of converted bursts, which is the smaller size of
+	 * both spans.
+	 */
+	static std::size_t
+	convert(std::span<const Burst> bursts, std::span<Sample> samples);
+
+	/// Lock-free queue of bursts, into which `readBurst()` reads directly
+	template< std::size_t N >
+	using BurstQueue = modm::atomic::BlockQueue<Burst, N>;
 };
 
 /**
@@ -305,9 +369,43 @@ public:
 	modm::ResumableResult<bool>
 	readRegisterBurst(std::array<uint16_t, 11>& data);
 
+	/**
+	 * @brief Read all output data registers using burst mode.
+	 *
+	 * The response is received into an internal buffer, where the checksum
+	 * is verified before the data is decoded into `burst`. The burst is
+	 * timestamped with `modm::PreciseClock` when the read is started.
+	 *
+	 * @warning The SPI frequency must not exceed 1 MHz for this mode.
+	 *
+	 * @return False in case of a checksum mismatch.
+	 */
+	modm::ResumableResult<bool>
+	readBurst(Burst& burst);
+
+	/**
+	 * @brief Wait for new data and read it into a queue using burst mode.
+	 *
+	 * Waits for the rising edge of the data ready signal and reads the burst
+	 * directly into the next free slot of the queue. Call this continuously,
+	 * e.g. from a dedicated fiber, to stream all samples into the queue,
+	 * while other fibers consume them in blocks.
+	 *
+	 * @warning The SPI frequency must not exceed 1 MHz for this mode.
+	 *
+	 * @tparam DataReady Data ready input, which is active high with the
+	 * default MSC_CTRL DrPolarity bit. Use `modm::GpioInverted` otherwise.
+	 * @return False if the queue was full or in case of a checksum mismatch.
+	 */
+	template<class DataReady, std::size_t N>
+	modm::ResumableResult<bool>
+	readBurst(BurstQueue<N>& queue);
+
 private:
 	static constexpr std::size_t bufferSize = 22;
 	std::array<uint8_t, bufferSize> buffer;
+	std::array<uint8_t, BurstSize> burstBuffer;
+	Burst* burstSlot;
 	std::size_t i;
 	uint16_t checksum;
 	std::optional<uint16_t> tmp;
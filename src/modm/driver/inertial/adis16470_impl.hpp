@@ -1,6 +1,7 @@
 // coding: utf-8
 /*
  * Copyright (c) 2022, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -19,6 +20,52 @@
 namespace modm
 {
 
+inline bool
+adis16470::decodeBurst(std::span<const uint8_t, BurstSize> response, Burst& burst)
+{
+	// The response to the command is followed by ten 16-bit words in big endian
+	const auto word = [&response](std::size_t index) -> uint16_t {
+		return (static_cast<uint16_t>(response[2 + 2*index]) << 8) | response[3 + 2*index];
+	};
+
+	uint16_t checksum = 0;
+	for (std::size_t index = 2; index < BurstSize - 2; index++) {
+		checksum += response[index];
+	}
+	if (checksum != word(9)) {
+		return false;
+	}
+
+	burst.diagStat = DiagStat_t(word(0));
+	for (std::size_t axis = 0; axis < 3; axis++) {
+		burst.gyro[axis] = static_cast<int16_t>(word(1 + axis));
+		burst.accel[axis] = static_cast<int16_t>(word(4 + axis));
+	}
+	burst.temperature = static_cast<int16_t>(word(7));
+	burst.counter = word(8);
+	return true;
+}
+
+inline std::size_t
+adis16470::convert(std::span<const Burst> bursts, std::span<Sample> samples)
+{
+	const std::size_t count = std::min(bursts.size(), samples.size());
+	for (std::size_t index = 0; index < count; index++)
+	{
+		const Burst& burst = bursts[index];
+		Sample& sample = samples[index];
+		sample.timestamp = burst.timestamp;
+		sample.diagStat = burst.diagStat;
+		for (std::size_t axis = 0; axis < 3; axis++) {
+			sample.angularRate[axis] = burst.gyro[axis] * GyroScale;
+			sample.acceleration[axis] = burst.accel[axis] * AccelScale;
+		}
+		sample.temperature = burst.temperature * TemperatureScale;
+		sample.counter = burst.counter;
+	}
+	return count;
+}
+
 template<class SpiMaster, class Cs>
 modm::ResumableResult<void>
 Adis16470<SpiMaster, Cs>::initialize()
@@ -268,4 +315,55 @@ Adis16470<SpiMaster, Cs>::readRegisterBurst(std::array<uint16_t, 11>& data)
 	RF_END_RETURN(checksum == data[10]);
 }
 
+template<class SpiMaster, class Cs>
+modm::ResumableResult<bool>
+Adis16470<SpiMaster, Cs>::readBurst(Burst& burst)
+{
+	RF_BEGIN();
+
+	burst.timestamp = modm::PreciseClock::now();
+
+	buffer.fill(0);
+	buffer[0] = 0x68;
+
+	// Ensure CS was not asserted for T_stall
+	RF_WAIT_UNTIL(timeout.isExpired());
+
+	RF_WAIT_UNTIL(this->acquireMaster());
+	Cs::reset();
+
+	RF_CALL(SpiMaster::transfer(buffer.data(), burstBuffer.data(), BurstSize));
+
+	if (this->releaseMaster()) {
+		Cs::set();
+	}
+	timeout.restart(tStall);
+
+	RF_END_RETURN(decodeBurst(burstBuffer, burst));
+}
+
+template<class SpiMaster, class Cs>
+template<class DataReady, std::size_t N>
+modm::ResumableResult<bool>
+Adis16470<SpiMaster, Cs>::readBurst(BurstQueue<N>& queue)
+{
+	RF_BEGIN();
+
+	// Wait for the rising edge of the data ready signal
+	RF_WAIT_WHILE(DataReady::read());
+	RF_WAIT_UNTIL(DataReady::read());
+
+	burstSlot = queue.reserve();
+	if (burstSlot == nullptr) {
+		RF_RETURN(false);
+	}
+
+	if (RF_CALL(readBurst(*burstSlot))) {
+		queue.commit();
+		RF_RETURN(true);
+	}
+
+	RF_END_RETURN(false);
+}
+
 } // namespace modm
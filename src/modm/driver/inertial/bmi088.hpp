@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -23,6 +24,7 @@
 #include <modm/processing/timer/timeout.hpp>
 #include <modm/math/geometry/vector3.hpp>
 #include "bmi088_transport.hpp"
+#include "imu_stream.hpp"
 
 namespace modm
 {
@@ -195,6 +197,111 @@ struct bmi088
 		DataReady = Bit7
 	};
 	MODM_FLAGS8(GyroInterruptControl);
+
+	/**
+	 * Decodes the accelerometer FIFO in header mode for `modm::imu::FifoStream`.
+	 *
+	 * Acceleration frames are placed one sample `period` apart. The sensortime
+	 * frame, which follows the last frame of a burst, counts in units of
+	 * 39.0625 µs and corrects the time of the samples of the burst decoded in
+	 * the same batch, assuming the last sample was taken at the sensortime.
+	 */
+	class AccFifoDecoder
+	{
+	public:
+		/// @param period Sample period in microseconds
+		constexpr explicit AccFifoDecoder(uint32_t period = 625) :
+			timeline(24, 625, 16, period)
+		{}
+
+		imu::Timeline&
+		getTimeline()
+		{ return timeline; }
+
+		template<class Batch>
+		std::size_t
+		decode(std::span<const uint8_t> data, Batch& batch)
+		{
+			const std::size_t first = batch.size;
+			std::size_t index = 0;
+			while (index < data.size())
+			{
+				const uint8_t header = data[index];
+				std::size_t size;
+				if ((header & 0xFC) == FrameAcc) { size = 7; }
+				else if (header == FrameSensorTime) { size = 4; }
+				else if (header == FrameSkip or header == FrameConfig or header == FrameDrop) { size = 2; }
+				// overread or unknown frame, the rest of the burst is invalid
+				else { return data.size(); }
+				if (index + size > data.size()) { break; }
+
+				const uint8_t* frame = &data[index + 1];
+				if (size == 7)
+				{
+					if (batch.isFull()) { break; }
+					const std::size_t sample = batch.append(timeline.next());
+					for (uint8_t axis = 0; axis < 3; axis++) {
+						batch.accel[axis][sample] = int16_t(frame[2*axis] | frame[2*axis+1] << 8);
+					}
+				}
+				else if (header == FrameSensorTime)
+				{
+					const uint32_t time = timeline.update(frame[0] | frame[1] << 8 | frame[2] << 16);
+					for (std::size_t sample = first; sample < batch.size; sample++) {
+						batch.timestamp[sample] = time - (batch.size - 1 - sample) * timeline.getPeriod();
+					}
+				}
+				index += size;
+			}
+			return index;
+		}
+
+	private:
+		static constexpr uint8_t FrameAcc{0x84};
+		static constexpr uint8_t FrameSkip{0x40};
+		static constexpr uint8_t FrameSensorTime{0x44};
+		static constexpr uint8_t FrameConfig{0x48};
+		static constexpr uint8_t FrameDrop{0x50};
+
+		imu::Timeline timeline;
+	};
+
+	/**
+	 * Decodes the gyroscope FIFO for `modm::imu::FifoStream`.
+	 *
+	 * The gyroscope FIFO contains no timestamps, the samples are placed one
+	 * sample `period` apart.
+	 */
+	class GyroFifoDecoder
+	{
+	public:
+		/// @param period Sample period in microseconds
+		constexpr explicit GyroFifoDecoder(uint32_t period = 500) :
+			timeline(32, 1, 1, period)
+		{}
+
+		imu::Timeline&
+		getTimeline()
+		{ return timeline; }
+
+		template<class Batch>
+		std::size_t
+		decode(std::span<const uint8_t> data, Batch& batch)
+		{
+			std::size_t index = 0;
+			for (; index + 6 <= data.size() and not batch.isFull(); index += 6)
+			{
+				const std::size_t sample = batch.append(timeline.next());
+				for (uint8_t axis = 0; axis < 3; axis++) {
+					batch.gyro[axis][sample] = int16_t(data[index+2*axis] | data[index+2*axis+1] << 8);
+				}
+			}
+			return index;
+		}
+
+	private:
+		imu::Timeline timeline;
+	};
 };
 
 /**
@@ -258,6 +365,18 @@ public:
 	bool
 	setAccGpioMap(AccGpioMap_t map);
 
+	/**
+	 * Read the accelerometer FIFO into the next burst of a stream.
+	 *
+	 * The FIFO content and the sensortime frame are read in a single transfer
+	 * into the free burst buffer, decode it with @ref AccFifoDecoder.
+	 * @return false if no burst was read, e.g. if the FIFO is empty or both
+	 * burst buffers are still filled
+	 */
+	template<class Stream>
+	bool
+	readAccFifo(Stream& stream);
+
 	// Gyroscope functions
 
 	std::optional<GyroData>
@@ -287,6 +406,18 @@ public:
 	bool
 	setGyroGpioMap(GyroGpioMap_t map);
 
+	/**
+	 * Read the gyroscope FIFO into the next burst of a stream.
+	 *
+	 * All frames which fit into the free burst buffer are read in a single
+	 * transfer, decode them with @ref GyroFifoDecoder.
+	 * @return false if no burst was read, e.g. if the FIFO is empty or both
+	 * burst buffers are still filled
+	 */
+	template<class Stream>
+	bool
+	readGyroFifo(Stream& stream);
+
 private:
 	using AccRegister = Transport::AccRegister;
 	using GyroRegister = Transport::GyroRegister;
@@ -299,6 +430,9 @@ private:
 	static constexpr uint8_t AccChipId{0x1E};
 	static constexpr uint8_t GyroChipId{0x0F};
 
+	static constexpr std::size_t AccSensorTimeFrameSize{4};
+	static constexpr std::size_t GyroFrameSize{6};
+
 	bool
 	checkChipId();
 
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,7 @@
 #error "Don't include this file directly, use 'bmi088.hpp' instead!"
 #endif
 
+#include <algorithm>
 #include <modm/math/utils.hpp>
 
 namespace modm
@@ -137,6 +139,35 @@ Bmi088<Transport>::setAccGpioMap(AccGpioMap_t map)
 	return ok;
 }
 
+template<Bmi088Transport Transport>
+template<class Stream>
+bool
+Bmi088<Transport>::readAccFifo(Stream& stream)
+{
+	const std::span<uint8_t> burst = stream.beginBurst();
+	if (burst.empty()) {
+		return false;
+	}
+
+	const auto length = this->readRegisters(AccRegister::FifoLength0, 2);
+	if (length.empty()) {
+		return false;
+	}
+	const std::size_t fifoLength = length[0] | (length[1] & 0x3F) << 8;
+	if (fifoLength == 0) {
+		return false;
+	}
+
+	// read past the last frame to receive the sensortime frame,
+	// a frame which is cut off is repeated in the next read
+	const std::size_t count = std::min(fifoLength + AccSensorTimeFrameSize, burst.size());
+	if (!this->readRegisters(AccRegister::FifoData, burst.first(count))) {
+		return false;
+	}
+	stream.endBurst(count);
+	return true;
+}
+
 template<Bmi088Transport Transport>
 std::optional<bmi088::GyroData>
 Bmi088<Transport>::readGyroData()
@@ -209,6 +240,33 @@ Bmi088<Transport>::setGyroGpioMap(GyroGpioMap_t map)
 	return ok;
 }
 
+template<Bmi088Transport Transport>
+template<class Stream>
+bool
+Bmi088<Transport>::readGyroFifo(Stream& stream)
+{
+	const std::span<uint8_t> burst = stream.beginBurst();
+	if (burst.empty()) {
+		return false;
+	}
+
+	const auto status = readRegister(GyroRegister::FifoStatus);
+	if (!status) {
+		return false;
+	}
+	const std::size_t frames = *status & 0x7F;
+	const std::size_t count = std::min(frames * GyroFrameSize, burst.size() / GyroFrameSize * GyroFrameSize);
+	if (count == 0) {
+		return false;
+	}
+
+	if (!this->readRegisters(GyroRegister::FifoData, burst.first(count))) {
+		return false;
+	}
+	stream.endBurst(count);
+	return true;
+}
+
 template<Bmi088Transport Transport>
 bool
 Bmi088<Transport>::checkChipId()
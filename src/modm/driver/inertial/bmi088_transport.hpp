@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -158,6 +159,14 @@ public:
 	std::span<uint8_t>
 	readRegisters(GyroRegister startReg, uint8_t count);
 
+	/// Read consecutive registers directly into data, e.g. to read the FIFO
+	bool
+	readRegisters(AccRegister startReg, std::span<uint8_t> data);
+
+	/// Read consecutive registers directly into data, e.g. to read the FIFO
+	bool
+	readRegisters(GyroRegister startReg, std::span<uint8_t> data);
+
 	bool
 	writeRegister(AccRegister reg, uint8_t data);
 
@@ -169,6 +178,10 @@ private:
 	std::span<uint8_t>
 	readRegisters(uint8_t reg, uint8_t count, bool dummyByte);
 
+	template<typename Cs>
+	bool
+	readRegisters(uint8_t reg, std::span<uint8_t> data, bool dummyByte);
+
 	template<typename Cs>
 	bool
 	writeRegister(uint8_t reg, uint8_t data);
@@ -207,6 +220,14 @@ public:
 	std::span<uint8_t>
 	readRegisters(GyroRegister startReg, uint8_t count);
 
+	/// Read consecutive registers directly into data, e.g. to read the FIFO
+	bool
+	readRegisters(AccRegister startReg, std::span<uint8_t> data);
+
+	/// Read consecutive registers directly into data, e.g. to read the FIFO
+	bool
+	readRegisters(GyroRegister startReg, std::span<uint8_t> data);
+
 	bool
 	writeRegister(AccRegister reg, uint8_t data);
 
@@ -217,6 +238,9 @@ private:
 	std::span<uint8_t>
 	readRegisters(uint8_t reg, uint8_t count);
 
+	bool
+	readRegisters(uint8_t reg, std::span<uint8_t> data);
+
 	bool
 	writeRegister(uint8_t reg, uint8_t data);
 
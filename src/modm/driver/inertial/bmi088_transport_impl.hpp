@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Christopher Durand
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -75,6 +76,47 @@ Bmi088SpiTransport<SpiMaster, AccCs, GyroCs>::readRegisters(uint8_t startReg,
 	return std::span{&rxBuffer_[dataOffset], count};
 }
 
+template<typename SpiMaster, typename AccCs, typename GyroCs>
+bool
+Bmi088SpiTransport<SpiMaster, AccCs, GyroCs>::readRegisters(AccRegister startReg,
+										std::span<uint8_t> data)
+{
+	return readRegisters<AccCs>(static_cast<uint8_t>(startReg), data, true);
+}
+
+template<typename SpiMaster, typename AccCs, typename GyroCs>
+bool
+Bmi088SpiTransport<SpiMaster, AccCs, GyroCs>::readRegisters(GyroRegister startReg,
+										std::span<uint8_t> data)
+{
+	return readRegisters<GyroCs>(static_cast<uint8_t>(startReg), data, false);
+}
+
+template<typename SpiMaster, typename AccCs, typename GyroCs>
+template<typename Cs>
+bool
+Bmi088SpiTransport<SpiMaster, AccCs, GyroCs>::readRegisters(uint8_t startReg,
+										std::span<uint8_t> data, bool dummyByte)
+{
+	while (!this->acquireMaster()) {
+		modm::this_fiber::yield();
+	}
+	Cs::reset();
+
+	txBuffer_[0] = startReg | ReadFlag;
+	txBuffer_[1] = 0;
+
+	SpiMaster::transfer(&txBuffer_[0], &rxBuffer_[0], dummyByte ? 2 : 1);
+	// the data is transferred without copying, with DMA if supported by SpiMaster
+	SpiMaster::transfer(nullptr, data.data(), data.size());
+
+	if (this->releaseMaster()) {
+		Cs::set();
+	}
+
+	return true;
+}
+
 template<typename SpiMaster, typename AccCs, typename GyroCs>
 bool
 Bmi088SpiTransport<SpiMaster, AccCs, GyroCs>::writeRegister(AccRegister reg, uint8_t data)
@@ -158,6 +200,30 @@ Bmi088I2cTransport<I2cMaster>::readRegisters(uint8_t startReg, uint8_t count)
 	}
 }
 
+template<typename I2cMaster>
+bool
+Bmi088I2cTransport<I2cMaster>::readRegisters(AccRegister startReg, std::span<uint8_t> data)
+{
+	this->transaction.setAddress(accAddress_);
+	return readRegisters(static_cast<uint8_t>(startReg), data);
+}
+
+template<typename I2cMaster>
+bool
+Bmi088I2cTransport<I2cMaster>::readRegisters(GyroRegister startReg, std::span<uint8_t> data)
+{
+	this->transaction.setAddress(gyroAddress_);
+	return readRegisters(static_cast<uint8_t>(startReg), data);
+}
+
+template<typename I2cMaster>
+bool
+Bmi088I2cTransport<I2cMaster>::readRegisters(uint8_t startReg, std::span<uint8_t> data)
+{
+	this->transaction.configureWriteRead(&startReg, 1, data.data(), data.size());
+	return this->runTransaction();
+}
+
 template<typename I2cMaster>
 bool
 Bmi088I2cTransport<I2cMaster>::writeRegister(AccRegister reg, uint8_t data)
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_IMU_STREAM_HPP
+#define MODM_IMU_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace modm::imu
+{
+
+/**
+ * Batch of IMU samples stored as structure of arrays.
+ *
+ * Every axis is stored in its own contiguous array, so that filters can
+ * process a batch without gathering the values of interleaved samples.
+ * Channels which are missing in a sample are set to zero.
+ *
+ * @tparam Capacity	Maximum number of samples in the batch
+ * @ingroup modm_driver_imu_stream
+ */
+template< size_t Capacity >
+struct SampleBatch
+{
+	static constexpr size_t capacity = Capacity;
+
+	/// Number of valid samples
+	size_t size{0};
+	/// Reconstructed sample time in microseconds
+	uint32_t timestamp[Capacity];
+	/// Raw acceleration per axis x, y, z
+	int32_t accel[3][Capacity];
+	/// Raw angular rate per axis x, y, z
+	int32_t gyro[3][Capacity];
+	/// Raw temperature
+	int16_t temperature[Capacity];
+
+	bool
+	isFull() const
+	{ return size >= Capacity; }
+
+	void
+	clear()
+	{ size = 0; }
+
+	/// Appends a sample with all channels cleared and returns its index.
+	size_t
+	append(uint32_t time)
+	{
+		const size_t index = size++;
+		timestamp[index] = time;
+		for (uint8_t axis = 0; axis < 3; axis++) {
+			accel[axis][index] = 0;
+			gyro[axis][index] = 0;
+		}
+		temperature[index] = 0;
+		return index;
+	}
+
+	std::span<const uint32_t>
+	getTimestamps() const
+	{ return {timestamp, size}; }
+
+	std::span<const int32_t>
+	getAccel(uint8_t axis) const
+	{ return {accel[axis], size}; }
+
+	std::span<const int32_t>
+	getGyro(uint8_t axis) const
+	{ return {gyro[axis], size}; }
+
+	std::span<const int16_t>
+	getTemperature() const
+	{ return {temperature, size}; }
+};
+
+/**
+ * Reconstructs a continuous time base from the wrapping timestamp counter of
+ * a sensor FIFO.
+ *
+ * One counter tick is `numerator / denominator` microseconds. The time starts
+ * at the first counter value and keeps increasing when the counter wraps.
+ * Samples without a timestamp are placed one sample period after the
+ * previous sample.
+ *
+ * @ingroup modm_driver_imu_stream
+ */
+class Timeline
+{
+public:
+	/// @param	bits		Width of the timestamp counter
+	/// @param	numerator	Tick period in microseconds times `denominator`
+	/// @param	period		Nominal sample period in microseconds
+	constexpr Timeline(uint8_t bits, uint32_t numerator, uint32_t denominator, uint32_t period) :
+		mask((bits >= 32) ? 0xffff'ffff : ((1ul << bits) - 1)),
+		numerator(numerator), denominator(denominator), period(period)
+	{}
+
+	/// Time of a sample with a raw timestamp in microseconds
+	uint32_t
+	update(uint32_t raw)
+	{
+		raw &= mask;
+		if (valid) ticks += (raw - last) & mask;
+		valid = true;
+		last = raw;
+		time = ticks * numerator / denominator;
+		return time;
+	}
+
+	/// Time of a sample without timestamp in microseconds
+	uint32_t
+	next()
+	{
+		time += period;
+		return time;
+	}
+
+	uint32_t
+	getTime() const
+	{ return time; }
+
+	uint32_t
+	getPeriod() const
+	{ return period; }
+
+	void
+	setPeriod(uint32_t period)
+	{ this->period = period; }
+
+	/// Forgets the counter state, the next timestamp starts at the current time.
+	void
+	reset()
+	{
+		valid = false;
+		ticks = uint64_t(time) * denominator / numerator;
+	}
+
+private:
+	uint32_t mask;
+	uint32_t numerator;
+	uint32_t denominator;
+	uint32_t period;
+	uint64_t ticks{0};
+	uint32_t last{0};
+	uint32_t time{0};
+	bool valid{true};
+};
+
+/**
+ * Double buffered stream of FIFO bursts decoded into sample batches.
+ *
+ * The driver reads the FIFO after a watermark interrupt into a free burst
+ * buffer with `beginBurst()` and `endBurst()`. Since there are two buffers,
+ * the next burst can be read, for example with DMA, while the previous one
+ * is decoded. If both buffers are still filled, the burst is not read and
+ * counted as overrun, so the sensor FIFO keeps the data until the consumer
+ * catches up.
+ *
+ * The consumer calls `read()`, which decodes the oldest burst with the
+ * `Decoder` of the sensor into a batch. The batch is returned by reference
+ * and stays valid until the next call to `read()`. A burst with more samples
+ * than the batch capacity is returned in several batches.
+ *
+ * The producer and the consumer may run in different contexts, for example
+ * an interrupt and the main loop, but each side must only be used from one
+ * context.
+ *
+ * @tparam	Decoder		Decoder with `size_t decode(std::span<const uint8_t>, Batch&)`,
+ * 						which returns the number of consumed bytes.
+ * @tparam	BurstSize	Size of one burst buffer in bytes
+ * @tparam	BatchSize	Number of samples per batch
+ *
+ * @ingroup modm_driver_imu_stream
+ */
+template< class Decoder, size_t BurstSize, size_t BatchSize >
+class FifoStream
+{
+public:
+	using Batch = SampleBatch<BatchSize>;
+	static constexpr size_t burstSize = BurstSize;
+
+	template< typename... Args >
+	explicit FifoStream(Args&&... args) :
+		decoder(std::forward<Args>(args)...)
+	{}
+
+	Decoder&
+	getDecoder()
+	{ return decoder; }
+
+	// Producer
+	/// @return the free burst buffer or an empty span if both are filled.
+	std::span<uint8_t>
+	beginBurst()
+	{
+		if (uint8_t(written - consumed) >= 2)
+		{
+			overruns++;
+			return {};
+		}
+		return {bursts[written & 1], BurstSize};
+	}
+
+	/// Passes `length` bytes of the burst buffer to the consumer.
+	void
+	endBurst(size_t length)
+	{
+		if (length == 0) return;
+		lengths[written & 1] = (length < BurstSize) ? length : BurstSize;
+		written = written + 1;
+	}
+
+	// Consumer
+	bool
+	isEmpty() const
+	{ return written == consumed; }
+
+	/// @return the next batch of decoded samples or `nullptr` if there is none.
+	const Batch*
+	read()
+	{
+		while (not isEmpty())
+		{
+			const uint8_t slot = consumed & 1;
+			const std::span<const uint8_t> burst{bursts[slot] + offset, lengths[slot] - offset};
+			batch.clear();
+			const size_t length = decoder.decode(burst, batch);
+			offset += length;
+			if (length == 0 or offset >= lengths[slot])
+			{
+				// release the burst buffer to the producer
+				offset = 0;
+				consumed = consumed + 1;
+			}
+			if (batch.size) return &batch;
+		}
+		return nullptr;
+	}
+
+	/// Number of bursts that could not be read, because both buffers were filled.
+	uint32_t
+	getOverruns() const
+	{ return overruns; }
+
+private:
+	Decoder decoder;
+	uint8_t bursts[2][BurstSize];
+	size_t lengths[2]{};
+	size_t offset{0};
+	volatile uint8_t written{0};
+	volatile uint8_t consumed{0};
+	uint32_t overruns{0};
+	Batch batch;
+};
+
+}	// namespace modm::imu
+
+#endif	// MODM_IMU_STREAM_HPP
@@ -2,6 +2,7 @@
 // ----------------------------------------------------------------------------
 /*
  * Copyright (c) 2023, Rasmus Kleist Hørlyck Sørensen
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -107,6 +108,22 @@ public:
     modm::ResumableResult<bool>
     readFifoData();
 
+    /**
+     * @brief Read the FIFO data from the device into the next burst of a stream
+     *
+     * Call this after the FIFO watermark interrupt. The content of the FIFO is
+     * read in a single transfer into the free burst buffer of the stream,
+     * which is decoded by the consumer with a `ixm42xxxdata::FifoDecoder`.
+     * The burst buffer should be larger than the watermark, since a packet
+     * which is cut off at the end of the buffer is dropped.
+     *
+     * @return False if no burst was read, e.g. if both burst buffers are still
+     * filled or if some register access is not permitted.
+     */
+    template < class Stream >
+    modm::ResumableResult<bool>
+    readFifo(Stream &stream);
+
     /**
      * @brief Set the FIFO watermark used to generate FIFO_WM_GT interrupt
      * @warning The FIFO watermarkl should be set, before choosing this interrupt source.
@@ -182,6 +199,8 @@ private:
     Data &data;
     uint8_t readByte;
     uint8_t prevBank;
+    std::span<uint8_t> fifoBurst;
+    uint16_t fifoBurstCount;
 };
 
 } // namespace modm
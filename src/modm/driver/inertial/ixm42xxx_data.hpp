@@ -2,6 +2,7 @@
 // ----------------------------------------------------------------------------
 /*
  * Copyright (c) 2023, Rasmus Kleist Hørlyck Sørensen
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -18,6 +19,8 @@
 
 #include <modm/math.hpp>
 
+#include "imu_stream.hpp"
+
 namespace modm
 {
 
@@ -120,6 +123,8 @@ private:
 struct
 FifoPacket
 {
+    friend class FifoDecoder;
+
     FifoPacket() : header(0), accel(0), gyro(0), temp(0), timestamp(0), extension(0) {}
 
     // DATA ACCESS
@@ -192,6 +197,19 @@ public:
     static uint16_t
     parse(std::span<const uint8_t> fifoData, FifoPacket &fifoPacket, uint16_t fifoIndex = 0);
 
+    /// Size of a packet in bytes including the header
+    static constexpr uint8_t
+    getSize(uint8_t header)
+    {
+        uint8_t size = 1;
+        if (header & HEADER_ACCEL) size += 6;
+        if (header & HEADER_GYRO) size += 6;
+        if (header & (HEADER_ACCEL | HEADER_GYRO)) size += (header & HEADER_20) ? 2 : 1;
+        if (header & (HEADER_TIMESTAMP_ODR | HEADER_TIMESTAMP_FSYNC)) size += 2;
+        if (header & HEADER_20) size += 3;
+        return size;
+    }
+
 private:
 
     int header;
@@ -217,6 +235,71 @@ public:
     constexpr bool operator==(const FifoPacket& rhs) const;
 };
 
+/**
+ * Decodes FIFO packets for `modm::imu::FifoStream`.
+ *
+ * The sample time is reconstructed from the ODR timestamp of the packets,
+ * which counts in units of `resolution` microseconds. Packets without ODR
+ * timestamp are placed one sample `period` after the previous packet.
+ *
+ * @ingroup modm_driver_ixm42xxx
+ */
+class
+FifoDecoder
+{
+public:
+    /// @param resolution Timestamp resolution in microseconds (TMST_RES)
+    /// @param period Sample period in microseconds
+    constexpr FifoDecoder(uint32_t resolution = 1, uint32_t period = 1000) :
+        timeline(16, resolution, 1, period)
+    {}
+
+    imu::Timeline&
+    getTimeline()
+    { return timeline; }
+
+    template < class Batch >
+    size_t
+    decode(std::span<const uint8_t> fifoData, Batch &batch)
+    {
+        size_t index = 0;
+        while (index < fifoData.size() and not batch.isFull())
+        {
+            const uint8_t header = fifoData[index];
+            // An empty FIFO is read as 0xFF
+            if (header & FifoPacket::HEADER_MSG) return fifoData.size();
+            // Never parse an incomplete packet
+            if (index + FifoPacket::getSize(header) > fifoData.size()) break;
+
+            FifoPacket packet;
+            index = FifoPacket::parse(fifoData, packet, index);
+
+            const bool hasOdrTimestamp = packet.containsOdrTimestamp() and not packet.containsFsyncTimestamp();
+            const size_t sample = batch.append(hasOdrTimestamp ?
+                    timeline.update(packet.getTimestamp()) : timeline.next());
+            if (packet.containsAccelData())
+            {
+                const Vector3li accel = packet.getAccel();
+                batch.accel[0][sample] = accel.x;
+                batch.accel[1][sample] = accel.y;
+                batch.accel[2][sample] = accel.z;
+            }
+            if (packet.containsGyroData())
+            {
+                const Vector3li gyro = packet.getGyro();
+                batch.gyro[0][sample] = gyro.x;
+                batch.gyro[1][sample] = gyro.y;
+                batch.gyro[2][sample] = gyro.z;
+            }
+            batch.temperature[sample] = packet.getTemp();
+        }
+        return index;
+    }
+
+private:
+    imu::Timeline timeline;
+};
+
 /// @ingroup modm_driver_ixm42xxx
 template <size_t FifoBufferSize>
 struct
@@ -2,6 +2,7 @@
 // ----------------------------------------------------------------------------
 /*
  * Copyright (c) 2023, Rasmus Kleist Hørlyck Sørensen
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -148,6 +149,29 @@ Ixm42xxx< Transport >::readFifoData()
 
 // -----------------------------------------------------------------------------
 
+template < class Transport >
+template < class Stream >
+modm::ResumableResult<bool>
+Ixm42xxx< Transport >::readFifo(Stream &stream)
+{
+    RF_BEGIN();
+
+    fifoBurst = stream.beginBurst();
+    if (!fifoBurst.empty() && RF_CALL(readFifoCount(&fifoBurstCount)))
+    {
+        fifoBurstCount = std::min<size_t>(fifoBurstCount, fifoBurst.size());
+        if (fifoBurstCount > 0 && RF_CALL(readRegister(Register::FIFO_DATA, fifoBurst.data(), fifoBurstCount)))
+        {
+            stream.endBurst(fifoBurstCount);
+            RF_RETURN(true);
+        }
+    }
+
+    RF_END_RETURN(false);
+}
+
+// -----------------------------------------------------------------------------
+
 template < class Transport >
 modm::ResumableResult<bool>
 Ixm42xxx< Transport >::writeFifoWatermark(uint16_t watermark)
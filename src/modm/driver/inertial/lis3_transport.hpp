@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2014-2016, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -56,7 +57,7 @@ protected:
 
 	/// read multiple 8bit values from a start register
 	modm::ResumableResult<bool>
-	read(uint8_t reg, uint8_t *buffer, uint8_t length);
+	read(uint8_t reg, uint8_t *buffer, std::size_t length);
 
 	// increment address or not?
 	/// @cond
@@ -107,7 +108,7 @@ protected:
 
 	/// read multiple 8bit values from a start register
 	modm::ResumableResult<bool>
-	read(uint8_t reg, uint8_t *buffer, uint8_t length);
+	read(uint8_t reg, uint8_t *buffer, std::size_t length);
 
 	// increment address or not?
 	/// @cond
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2014-2016, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -40,7 +41,7 @@ modm::Lis3TransportI2c<I2cMaster>::write(uint8_t reg, uint8_t value)
 // MARK: read register
 template < class I2cMaster >
 modm::ResumableResult<bool>
-modm::Lis3TransportI2c<I2cMaster>::read(uint8_t reg, uint8_t *buffer, uint8_t length)
+modm::Lis3TransportI2c<I2cMaster>::read(uint8_t reg, uint8_t *buffer, std::size_t length)
 {
 	RF_BEGIN();
 
@@ -96,7 +97,7 @@ modm::Lis3TransportSpi<SpiMaster, Cs>::write(uint8_t reg, uint8_t value)
 // MARK: read register
 template < class SpiMaster, class Cs >
 modm::ResumableResult<bool>
-modm::Lis3TransportSpi<SpiMaster, Cs>::read(uint8_t reg, uint8_t *buffer, uint8_t length)
+modm::Lis3TransportSpi<SpiMaster, Cs>::read(uint8_t reg, uint8_t *buffer, std::size_t length)
 {
 	RF_BEGIN();
 
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2022-2023, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -11,6 +12,7 @@
 
 #define MODM_LSM6DSO_HPP
 
+#include <algorithm>
 #include <array>
 #include <optional>
 #include <span>
@@ -18,6 +20,8 @@
 #include <modm/processing/resumable.hpp>
 #include <modm/math/units.hpp>
 
+#include "imu_stream.hpp"
+
 // LSM6DSO uses same I2C/SPI transport as the older LIS3 sensors
 #include "lis3_transport.hpp"
 
@@ -135,6 +139,83 @@ struct lsm6dso
 		dps2000 = (0b110 << 1),
 	};
 
+	/// Size of a tagged FIFO word in bytes
+	static constexpr std::size_t FifoWordSize = 7;
+
+	/**
+	 * Decodes tagged FIFO words for `modm::imu::FifoStream`.
+	 *
+	 * Words with the same TAG_CNT belong to the same time slot and are merged
+	 * into one sample. The timestamp word, which is batched if
+	 * `FIFO_CTRL4.DEC_TS_BATCH` is enabled, sets the time of its slot in units
+	 * of 25 µs. Slots without timestamp are placed one sample `period` after
+	 * the previous slot. Other words, like the compressed data, are skipped.
+	 */
+	class FifoDecoder
+	{
+	public:
+		/// @param period Sample period in microseconds
+		constexpr explicit FifoDecoder(uint32_t period = 1000) :
+			timeline(32, 25, 1, period)
+		{}
+
+		imu::Timeline&
+		getTimeline()
+		{ return timeline; }
+
+		template< class Batch >
+		std::size_t
+		decode(std::span<const uint8_t> data, Batch &batch)
+		{
+			std::size_t index = 0;
+			int32_t sample = -1;
+			for (; index + FifoWordSize <= data.size(); index += FifoWordSize)
+			{
+				const uint8_t tag = data[index] >> 3;
+				const uint8_t count = (data[index] >> 1) & 0b11;
+				const uint8_t *word = &data[index + 1];
+				if (tag < TagGyroscope or tag > TagTimestamp) continue;
+
+				if (sample < 0 or count != slot)
+				{
+					if (batch.isFull()) break;
+					// a slot which continues from the previous batch keeps its time
+					sample = batch.append((sample < 0 and count == slot) ?
+							timeline.getTime() : timeline.next());
+					slot = count;
+				}
+				switch (tag)
+				{
+					case TagGyroscope:
+						for (uint8_t axis = 0; axis < 3; axis++)
+							batch.gyro[axis][sample] = int16_t(word[2*axis] | word[2*axis+1] << 8);
+						break;
+					case TagAccelerometer:
+						for (uint8_t axis = 0; axis < 3; axis++)
+							batch.accel[axis][sample] = int16_t(word[2*axis] | word[2*axis+1] << 8);
+						break;
+					case TagTemperature:
+						batch.temperature[sample] = int16_t(word[0] | word[1] << 8);
+						break;
+					case TagTimestamp:
+						batch.timestamp[sample] = timeline.update(
+								word[0] | word[1] << 8 | word[2] << 16 | uint32_t(word[3]) << 24);
+						break;
+				}
+			}
+			return index;
+		}
+
+	private:
+		static constexpr uint8_t TagGyroscope = 0x01;
+		static constexpr uint8_t TagAccelerometer = 0x02;
+		static constexpr uint8_t TagTemperature = 0x03;
+		static constexpr uint8_t TagTimestamp = 0x04;
+
+		imu::Timeline timeline;
+		uint8_t slot{0xff};
+	};
+
 protected:
 	/// @cond
 	static constexpr uint8_t Ctrl1XlOutputDataRateMask = (0b1111 << 4);
@@ -278,9 +359,25 @@ public:
 	modm::ResumableResult<bool>
 	setOutputDataRateAndRange(LinearRange lr, AngularRange ar);
 
+	/**
+	 * @brief Read the FIFO into the next burst of a stream
+	 *
+	 * Call this after the FIFO watermark interrupt. All complete words, which
+	 * fit into the free burst buffer of the stream, are read in a single
+	 * transfer and decoded by the consumer with a `lsm6dso::FifoDecoder`.
+	 *
+	 * @return False if no burst was read, e.g. if the FIFO is empty, both
+	 * burst buffers are still filled or in case of any error
+	 */
+	template<class Stream>
+	modm::ResumableResult<bool>
+	readFifo(Stream &stream);
+
 private:
 	static constexpr std::size_t bufferSize = 2;
 	std::array<uint8_t, bufferSize> buffer;
+	std::span<uint8_t> fifoBurst;
+	std::size_t fifoBurstSize;
 };
 
 } // namespace modm
@@ -1,6 +1,7 @@
 /*
  * Copyright (c) 2014-2015, Niklas Hauser
  * Copyright (c) 2022-2023, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -58,6 +59,29 @@ Lsm6dso<Transport>::writeRegister(Register reg, uint8_t value)
 	return this->write(i(reg), value);
 }
 
+template<class Transport>
+template<class Stream>
+modm::ResumableResult<bool>
+Lsm6dso<Transport>::readFifo(Stream &stream)
+{
+	RF_BEGIN();
+	fifoBurst = stream.beginBurst();
+	if (fifoBurst.empty() or !RF_CALL(this->read(i(Register::FIFO_STATUS1), buffer.data(), 2)))
+	{
+		RF_RETURN(false);
+	}
+	// DIFF_FIFO is the number of unread words
+	fifoBurstSize = std::min<std::size_t>(((buffer[1] & 0b11) << 8 | buffer[0]) * FifoWordSize,
+			fifoBurst.size() / FifoWordSize * FifoWordSize);
+	// The address rolls over from FIFO_DATA_OUT_Z_H to FIFO_DATA_OUT_TAG
+	if (fifoBurstSize == 0 or !RF_CALL(this->read(i(Register::FIFO_DATA_OUT_TAG), fifoBurst.data(), fifoBurstSize)))
+	{
+		RF_RETURN(false);
+	}
+	stream.endBurst(fifoBurstSize);
+	RF_END_RETURN(true);
+}
+
 template<class Transport>
 template<frequency_t outputDataRate, percent_t tolerance>
 modm::ResumableResult<bool>
@@ -19,9 +19,6 @@
 #ifndef MODM_BME280_DATA_HPP
 #define MODM_BME280_DATA_HPP
 
-#undef  MODM_LOG_LEVEL
-#define MODM_LOG_LEVEL modm::log::DISABLED
-
 // Forward declaration the test class
 class Bme280Test;
 
@@ -34,6 +31,10 @@ class Bme280;
 namespace bme280data
 {
 
+/// Log category of the driver. The debug output is removed at compile time,
+/// lower the threshold to DEBUG to trace the compensation of the raw values.
+struct Log : modm::log::Category<Log, modm::log::Root, modm::log::DISABLED> {};
+
 /**
  * Holds the calibration data from the sensor.
  * Values are used for calculation of calibrated
@@ -19,9 +19,6 @@
 #	error  "Don't include this file directly, use 'bme280_data.hpp' instead!"
 #endif
 
-#undef  MODM_LOG_LEVEL
-#define MODM_LOG_LEVEL modm::log::DISABLED
-
 namespace modm
 {
 namespace bme280data
@@ -57,7 +54,7 @@ DataDouble::calculateCalibratedTemperature()
 
 	calibratedTemperatureDouble = (var1 + var2) / double(5120.0);
 
-	MODM_LOG_DEBUG.printf("T dp = %4.2f\n", calibratedTemperatureDouble);
+	MODM_LOG_DEBUG_IN(modm::bme280data::Log).printf("T dp = %4.2f\n", calibratedTemperatureDouble);
 
 	meta |= TEMPERATURE_CALCULATED;
 }
@@ -21,9 +21,6 @@
 #	error  "Don't include this file directly, use 'bme280_data.hpp' instead!"
 #endif
 
-#undef  MODM_LOG_LEVEL
-#define MODM_LOG_LEVEL modm::log::DISABLED
-
 namespace modm
 {
 namespace bme280data
@@ -43,7 +40,7 @@ Data::calculateCalibratedTemperature()
 	int32_t adc = (((int32_t(raw[3])) << 16) | (raw[4] << 8) | (raw[5] << 0));
 	adc >>= 4;
 
-	MODM_LOG_DEBUG.printf("adc = 0x%05" PRIx32 "\n", adc);
+	MODM_LOG_DEBUG_IN(modm::bme280data::Log).printf("adc = 0x%05" PRIx32 "\n", adc);
 
 	int32_t T1 = calibration.T1;
 	int32_t T2 = calibration.T2;
@@ -17,9 +17,6 @@
 #include <modm/math/utils/bit_operation.hpp>
 #include <modm/math/utils/endianness.hpp>
 
-#undef  MODM_LOG_LEVEL
-#define MODM_LOG_LEVEL modm::log::DISABLED
-
 // ----------------------------------------------------------------------------
 template < typename I2cMaster >
 modm::Bme280<I2cMaster>::Bme280(Data &data, uint8_t address) :
@@ -44,9 +41,9 @@ modm::Bme280<I2cMaster>::initialize(Mode mode, Oversampling pressure, Oversampli
 
 		if (RF_CALL( this->runTransaction() ))
 		{
-			MODM_LOG_DEBUG.printf("BME280 Chip Id check. Read %02x, expected %02x\n", chid, ChipId);
+			MODM_LOG_DEBUG_IN(modm::bme280data::Log).printf("BME280 Chip Id check. Read %02x, expected %02x\n", chid, ChipId);
 			if (chid != ChipId) {
-				MODM_LOG_ERROR.printf("BME280 Chip Id mismatch. Read %02x, expected %02x\n", chid, ChipId);
+				MODM_LOG_ERROR_IN(modm::bme280data::Log).printf("BME280 Chip Id mismatch. Read %02x, expected %02x\n", chid, ChipId);
 				RF_RETURN(false);
 			}
 		} else {
@@ -105,12 +102,12 @@ modm::Bme280<I2cMaster>::initialize(Mode mode, Oversampling pressure, Oversampli
 	if (RF_CALL( this->runTransaction() ))
 	{
 		{
-			MODM_LOG_DEBUG << "Raw calibration data: ";
+			MODM_LOG_DEBUG_IN(modm::bme280data::Log) << "Raw calibration data: ";
 			uint8_t *rr = reinterpret_cast<uint8_t*>(&data.calibration);
 			for (uint8_t ii = 0; ii < 26; ++ii) {
-				MODM_LOG_DEBUG.printf("%x ", rr[ii]);
+				MODM_LOG_DEBUG_IN(modm::bme280data::Log).printf("%x ", rr[ii]);
 			}
-			MODM_LOG_DEBUG << modm::endl;
+			MODM_LOG_DEBUG_IN(modm::bme280data::Log) << modm::endl;
 		}
 
 		uint16_t* element = reinterpret_cast<uint16_t*>(&data.calibration);
@@ -173,7 +170,7 @@ modm::Bme280<I2cMaster>::readout()
 	buffer[0] = i(Register::PRESS_MSB);
 	this->transaction.configureWriteRead(buffer, 1, data.raw, 8);
 
-	MODM_LOG_DEBUG.printf("RAW: %02x %02x %02x %02x %02x %02x %02x %02x\n",
+	MODM_LOG_DEBUG_IN(modm::bme280data::Log).printf("RAW: %02x %02x %02x %02x %02x %02x %02x %02x\n",
 		data.raw[0], data.raw[1], data.raw[2], data.raw[3],
 		data.raw[4], data.raw[5], data.raw[6], data.raw[7]);
 
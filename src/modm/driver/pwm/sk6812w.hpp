@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -10,38 +11,34 @@
 // ----------------------------------------------------------------------------
 
 #pragma once
-#include <modm/math/units.hpp>
-#include <modm/architecture/interface/spi_master.hpp>
-#include <modm/architecture/interface/unaligned.hpp>
-#include <modm/ui/color.hpp>
+#include "ws2812b.hpp"
 
 namespace modm
 {
 
-/// @ingroup modm_driver_sk6812
+/**
+ * SK6812 RGBW LED strip driven by the MOSI signal of an SPI master.
+ *
+ * Uses the same double buffered, table driven encoding as `modm::Ws2812b`.
+ *
+ * @ingroup modm_driver_sk6812
+ */
 template< class SpiMaster, class Output, size_t LEDs >
-class Sk6812w
+class Sk6812w : protected modm::NestedResumable<1>
 {
-protected:								  // 7654 3210 7654 3210 7654 3210
-	static constexpr uint32_t base_mask  = 0b0010'0100'1001'0010'0100'1001;
-	static constexpr uint32_t clear_mask = base_mask << 1;
-
+protected:
 	static constexpr size_t length = LEDs * 12;
-	uint8_t data[length + 1]; // +1 for zero byte for reset
+	uint8_t frames[2][length + 1]; // +1 for zero byte for reset
+	/// Index of the frame buffer that is composed
+	uint8_t back{0};
 
-	static constexpr uint16_t
-	spread(uint8_t nibble)
-	{
-		return ((nibble & 0b0001) << 10) | ((nibble & 0b0010) << 6) |
-			   ((nibble & 0b0100) <<  5) | ((nibble & 0b1000) << 1);
-	}
+	uint8_t*
+	data()
+	{ return frames[back]; }
 
-	static constexpr uint8_t
-	gather(uint32_t pattern)
-	{
-		return ((pattern >> 10) & 0b0001) | ((pattern >> 6) & 0b0010) |
-			   ((pattern >> 5) & 0b0100) | ((pattern >> 1) & 0b1000);
-	}
+	const uint8_t*
+	data() const
+	{ return frames[back]; }
 
 public:
 	static constexpr size_t size = LEDs;
@@ -66,9 +63,9 @@ public:
 	{
 		for (size_t ii=0; ii < length; ii += 3)
 		{
-			*modm::asUnaligned<uint32_t*>(data + ii) = base_mask;
+			std::memcpy(data() + ii, ws2812::encoding[0].data(), 3);
 		}
-		data[length] = 0;
+		data()[length] = 0;
 	}
 
 	void
@@ -76,13 +73,8 @@ public:
 	{
 		if (index >= LEDs) return;
 
-		const uint8_t colors[] = {color.green, color.red, color.blue, brightness};
-		for (size_t ii = 0; ii < 4; ii++)
-		{
-			const uint32_t c = (spread(colors[ii]) << 12) | spread(colors[ii] >> 4);
-			auto *value = modm::asUnaligned<uint32_t*>(data + index * 12 + ii*3);
-			*value = (uint32_t(*value) & ~clear_mask) | c;
-		}
+		setColor(index, color);
+		setBrightness(index, brightness);
 	}
 
 	void
@@ -90,13 +82,10 @@ public:
 	{
 		if (index >= LEDs) return;
 
-		const uint8_t colors[] = {color.green, color.red, color.blue};
-		for (size_t ii = 0; ii < 3; ii++)
-		{
-			const uint32_t c = (spread(colors[ii]) << 12) | spread(colors[ii] >> 4);
-			auto *value = modm::asUnaligned<uint32_t*>(data + index * 12 + ii*3);
-			*value = (uint32_t(*value) & ~clear_mask) | c;
-		}
+		uint8_t *led = data() + index * 12;
+		std::memcpy(led + 0, ws2812::encoding[color.green].data(), 3);
+		std::memcpy(led + 3, ws2812::encoding[color.red].data(), 3);
+		std::memcpy(led + 6, ws2812::encoding[color.blue].data(), 3);
 	}
 
 	color::Rgb
@@ -104,14 +93,8 @@ public:
 	{
 		if (index >= LEDs) return {};
 
-		uint8_t color[3];
-		for (size_t ii = 0; ii < 3; ii++)
-		{
-			const auto value = *modm::asUnaligned<const uint32_t*>(data + index * 12 + ii*3);
-			const uint8_t c = (gather(value) << 4) | gather(value >> 12);
-			color[ii] = c;
-		}
-		return {color[1], color[0], color[2]};
+		const uint8_t *led = data() + index * 12;
+		return {ws2812::decode(led + 3), ws2812::decode(led), ws2812::decode(led + 6)};
 	}
 
 	void
@@ -119,9 +102,7 @@ public:
 	{
 		if (index >= LEDs) return;
 
-		const uint32_t c = (spread(brightness) << 12) | spread(brightness >> 4);
-		auto *value = modm::asUnaligned<uint32_t*>(data + index * 12 + 3*3);
-		*value = (uint32_t(*value) & ~clear_mask) | c;
+		std::memcpy(data() + index * 12 + 9, ws2812::encoding[brightness].data(), 3);
 	}
 
 	uint8_t
@@ -129,17 +110,21 @@ public:
 	{
 		if (index >= LEDs) return {};
 
-		const auto value = *modm::asUnaligned<const uint32_t*>(data + index * 12 + 3*3);
-		return (gather(value) << 4) | gather(value >> 12);
+		return ws2812::decode(data() + index * 12 + 9);
 	}
 
-	void
+	/// Transmits the composed frame, see `modm::Ws2812b::write()`.
+	modm::ResumableResult<void>
 	write()
 	{
-		for (const auto value : data) {
-			while (not SpiMaster::Hal::isTransmitRegisterEmpty()) ;
-			SpiMaster::Hal::write(value);
-		}
+		RF_BEGIN();
+
+		back ^= 1;
+		std::memcpy(data(), frames[back ^ 1], length + 1);
+
+		RF_CALL(SpiMaster::transfer(frames[back ^ 1], nullptr, length + 1));
+
+		RF_END();
 	}
 };
 
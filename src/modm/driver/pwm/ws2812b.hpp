@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -12,36 +13,90 @@
 #pragma once
 #include <modm/math/units.hpp>
 #include <modm/architecture/interface/spi_master.hpp>
-#include <modm/architecture/interface/unaligned.hpp>
+#include <modm/processing/resumable.hpp>
 #include <modm/ui/color.hpp>
+#include <array>
+#include <cstring>
 
 namespace modm
 {
 
-/// @ingroup modm_driver_ws2812
-template< class SpiMaster, class Output, size_t LEDs >
-class Ws2812b
+/// @cond
+namespace ws2812
 {
-protected:								  // 7654 3210 7654 3210 7654 3210
-	static constexpr uint32_t base_mask  = 0b0010'0100'1001'0010'0100'1001;
-	static constexpr uint32_t clear_mask = base_mask << 1;
+/// Leading high bit of every 3-bit symbol, the data bit follows it
+constexpr uint32_t base_mask = 0b0010'0100'1001'0010'0100'1001;
 
-	static constexpr size_t length = LEDs * 9;
-	uint8_t data[length + 1]; // +1 for zero byte for reset
+/// Spreads the bits of a byte MSB first onto the data bits of the symbols
+constexpr uint32_t
+spread(uint8_t value)
+{
+	uint32_t pattern = base_mask;
+	for (uint8_t bit = 0; bit < 8; bit++)
+	{
+		if (value & (0x80 >> bit)) pattern |= 1ul << (bit * 3 + 1);
+	}
+	return pattern;
+}
 
-	static constexpr uint16_t
-	spread(uint8_t nibble)
+constexpr uint8_t
+gather(uint32_t pattern)
+{
+	uint8_t value = 0;
+	for (uint8_t bit = 0; bit < 8; bit++)
 	{
-		return ((nibble & 0b0001) << 10) | ((nibble & 0b0010) << 6) |
-			   ((nibble & 0b0100) <<  5) | ((nibble & 0b1000) << 1);
+		if (pattern & (1ul << (bit * 3 + 1))) value |= 0x80 >> bit;
 	}
+	return value;
+}
 
-	static constexpr uint8_t
-	gather(uint32_t pattern)
+/// 3-bit SPI encoding of every byte value in transmission order
+inline constexpr auto encoding = []
+{
+	std::array<std::array<uint8_t, 3>, 256> table{};
+	for (size_t value = 0; value < 256; value++)
 	{
-		return ((pattern >> 10) & 0b0001) | ((pattern >> 6) & 0b0010) |
-			   ((pattern >> 5) & 0b0100) | ((pattern >> 1) & 0b1000);
+		const uint32_t c = spread(value);
+		table[value] = {uint8_t(c), uint8_t(c >> 8), uint8_t(c >> 16)};
 	}
+	return table;
+}();
+
+constexpr uint8_t
+decode(const uint8_t *bits)
+{
+	return gather(bits[0] | (bits[1] << 8) | (uint32_t(bits[2]) << 16));
+}
+}
+/// @endcond
+
+/**
+ * WS2812B LED strip driven by the MOSI signal of an SPI master.
+ *
+ * The colors are encoded with a lookup table into one of two frame buffers.
+ * `write()` transmits the composed frame with a single
+ * `SpiMaster::transfer(tx, rx, len)` and continues composing into the other
+ * buffer, so the next frame can be prepared while the current one is sent.
+ * Use an SPI master with DMA to keep the CPU free during the transmission.
+ *
+ * @ingroup modm_driver_ws2812
+ */
+template< class SpiMaster, class Output, size_t LEDs >
+class Ws2812b : protected modm::NestedResumable<1>
+{
+protected:
+	static constexpr size_t length = LEDs * 9;
+	uint8_t frames[2][length + 1]; // +1 for zero byte for reset
+	/// Index of the frame buffer that is composed
+	uint8_t back{0};
+
+	uint8_t*
+	data()
+	{ return frames[back]; }
+
+	const uint8_t*
+	data() const
+	{ return frames[back]; }
 
 public:
 	static constexpr size_t size = LEDs;
@@ -66,9 +121,9 @@ public:
 	{
 		for (size_t ii=0; ii < length; ii += 3)
 		{
-			*modm::asUnaligned<uint32_t*>(data + ii) = base_mask;
+			std::memcpy(data() + ii, ws2812::encoding[0].data(), 3);
 		}
-		data[length] = 0;
+		data()[length] = 0;
 	}
 
 	void
@@ -76,13 +131,10 @@ public:
 	{
 		if (index >= LEDs) return;
 
-		const uint8_t colors[3] = {color.green, color.red, color.blue};
-		for (size_t ii = 0; ii < 3; ii++)
-		{
-			const uint32_t c = (spread(colors[ii]) << 12) | spread(colors[ii] >> 4);
-			auto *value = modm::asUnaligned<uint32_t*>(data + index * 9 + ii*3);
-			*value = (uint32_t(*value) & ~clear_mask) | c;
-		}
+		uint8_t *led = data() + index * 9;
+		std::memcpy(led + 0, ws2812::encoding[color.green].data(), 3);
+		std::memcpy(led + 3, ws2812::encoding[color.red].data(), 3);
+		std::memcpy(led + 6, ws2812::encoding[color.blue].data(), 3);
 	}
 
 	color::Rgb
@@ -90,23 +142,31 @@ public:
 	{
 		if (index >= LEDs) return {};
 
-		uint8_t color[3];
-		for (size_t ii = 0; ii < 3; ii++)
-		{
-			const auto value = *modm::asUnaligned<const uint32_t*>(data + index * 9 + ii*3);
-			const uint8_t c = (gather(value) << 4) | gather(value >> 12);
-			color[ii] = c;
-		}
-		return {color[1], color[0], color[2]};
+		const uint8_t *led = data() + index * 9;
+		return {ws2812::decode(led + 3), ws2812::decode(led), ws2812::decode(led + 6)};
 	}
 
-	void
+	/**
+	 * Transmits the composed frame.
+	 *
+	 * The frame buffers are swapped and the new back buffer is initialized
+	 * with the transmitted colors, so that the colors can be changed while
+	 * the transmission is running.
+	 *
+	 * There is no enforced reset period of at least 50µs after the write is
+	 * finished.
+	 */
+	modm::ResumableResult<void>
 	write()
 	{
-		for (const auto value : data) {
-			while (not SpiMaster::Hal::isTransmitRegisterEmpty()) ;
-			SpiMaster::Hal::write(value);
-		}
+		RF_BEGIN();
+
+		back ^= 1;
+		std::memcpy(data(), frames[back ^ 1], length + 1);
+
+		RF_CALL(SpiMaster::transfer(frames[back ^ 1], nullptr, length + 1));
+
+		RF_END();
 	}
 };
 
@@ -67,10 +67,18 @@ public:
 	void
 	free(void *ptr);
 
+	/// Size of an allocated block including the management data
+	std::size_t
+	getSize(const void *ptr) const;
+
 public:
 	std::size_t
 	getAvailableSize() const;
 
+	/// Size of the largest continuous free block
+	std::size_t
+	getLargestAvailableSize() const;
+
 private:
 	// Align the pointer to a multiple of MODM_ALIGNMENT
 	T *
@@ -206,6 +206,36 @@ modm::BlockAllocator<T, BLOCK_SIZE>::getAvailableSize() const
 	return size;
 }
 
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getLargestAvailableSize() const
+{
+	T *p = start;
+	std::size_t size = 0;
+
+	do {
+		SignedType slots = *p;
+
+		if (slots < 0)
+		{
+			slots = -slots;
+			size = std::max<std::size_t>(size, slots * BLOCK_SIZE * sizeof(T));
+		}
+
+		p += slots * BLOCK_SIZE;
+	}
+	while (p < end);
+
+	return size;
+}
+
+template <typename T, unsigned int BLOCK_SIZE >
+std::size_t
+modm::BlockAllocator<T, BLOCK_SIZE>::getSize(const void *ptr) const
+{
+	return *((const T *) ptr - 1) * BLOCK_SIZE * sizeof(T);
+}
+
 // ----------------------------------------------------------------------------
 template<typename T, unsigned int BLOCK_SIZE >
 T *
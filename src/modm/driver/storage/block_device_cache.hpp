@@ -0,0 +1,238 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_CACHE_HPP
+#define MODM_BLOCK_DEVICE_CACHE_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+#include <algorithm>
+#include <iterator>
+
+namespace modm
+{
+
+/**
+ * \brief	Virtual block device caching another block device in RAM
+ *
+ * Reads are served from a small, fully associative cache with
+ * least-recently-used replacement. When a miss directly follows the
+ * previously missed line, the next line is read ahead as well. The read-ahead
+ * is performed synchronously within the same `read()` call, so it does not
+ * hide the latency of the device: a sequential scan still waits for every
+ * line, it only misses on every other line.
+ *
+ * Programmed data is buffered in the cache and only written back when a
+ * line is evicted or on `flush()`. Small programs of the same line are
+ * thereby coalesced into as few programs of the underlying device as
+ * possible, so the cache accepts programs of any size. Only the write blocks
+ * of the underlying device that contain programmed data are written back,
+ * consecutive ones in a single program. A partially programmed write block
+ * is written back whole, with the rest of it programmed again with the data
+ * read from the device. Call `flush()` or `deinitialize()` before removing
+ * power!
+ *
+ * `erase()` discards the buffered data of the erased lines and is forwarded
+ * immediately, the erase block size of the underlying device applies.
+ *
+ * \tparam CachedDevice	Cached block device
+ * \tparam Lines			Number of cache lines
+ * \tparam LineSize		Size of a cache line, multiple of the read and write block size
+ *
+ * \ingroup	modm_driver_block_device_cache
+ */
+template <typename CachedDevice, size_t Lines = 8,
+		  size_t LineSize = std::max<size_t>({CachedDevice::BlockSizeRead, CachedDevice::BlockSizeWrite, 512})>
+class BdCache : public modm::BlockDevice, protected NestedResumable<4>
+{
+	static_assert(requires { CachedDevice::DeviceSize; },
+			"The cached device must have a compile-time DeviceSize!");
+
+public:
+	/// Initializes the storage hardware
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Writes back all buffered data and deinitializes the storage hardware
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Any block has to be erased prior to being programmed.
+	 *  The data is buffered until the line is evicted or flushed.
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  The state of an erased block is undefined until it has been programmed
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of erase block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/// Writes back all buffered data to the underlying block device
+	modm::ResumableResult<bool>
+	flush();
+
+	/// Writes back and drops all cached lines
+	modm::ResumableResult<bool>
+	invalidate();
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 1;
+	static constexpr bd_size_t BlockSizeErase = CachedDevice::BlockSizeErase;
+	static constexpr bd_size_t DeviceSize = CachedDevice::DeviceSize;
+
+	struct Statistics
+	{
+		uint32_t hits;
+		uint32_t misses;
+		uint32_t readAheads;
+		uint32_t writeBacks;
+	};
+
+public:
+	/// Access counters since initialization or the last reset
+	const Statistics&
+	getStatistics() const
+	{ return statistics; }
+
+	void
+	resetStatistics()
+	{ statistics = {}; }
+
+	/** Direct access to the cached block device
+	*
+	*  @warning	Bypassing the cache may return stale data!
+	*  @return	BlockDevice
+	*/
+	CachedDevice&
+	getBlockDevice()
+	{ return blockDevice; }
+
+protected:
+	static constexpr bd_address_t Invalid = bd_address_t(-1);
+
+	static constexpr size_t WriteBlocks = LineSize / CachedDevice::BlockSizeWrite;
+
+	struct Line
+	{
+		bd_address_t address;
+		uint32_t lastUse;
+		// one bit per write block with buffered, not yet programmed data
+		uint32_t dirty[(WriteBlocks + 31) / 32];
+		uint8_t data[LineSize];
+
+		bool
+		isDirty() const
+		{ return std::any_of(std::begin(dirty), std::end(dirty), [](uint32_t word) { return word; }); }
+
+		bool
+		isDirty(size_t block) const
+		{ return dirty[block / 32] & (1ul << (block % 32)); }
+
+		/// Marks all write blocks overlapping the byte range as dirty
+		void
+		markDirty(size_t begin, size_t end)
+		{
+			for (size_t block = begin / CachedDevice::BlockSizeWrite;
+				 block * CachedDevice::BlockSizeWrite < end; block++) {
+				dirty[block / 32] |= (1ul << (block % 32));
+			}
+		}
+
+		void
+		clean()
+		{ std::fill(std::begin(dirty), std::end(dirty), 0); }
+	};
+
+	static_assert(LineSize % CachedDevice::BlockSizeRead == 0,
+			"LineSize must be a multiple of the read block size!");
+	static_assert(LineSize % CachedDevice::BlockSizeWrite == 0,
+			"LineSize must be a multiple of the write block size!");
+	static_assert(DeviceSize % LineSize == 0,
+			"DeviceSize must be a multiple of LineSize!");
+	static_assert(LineSize <= 0x8000, "LineSize is limited to 32kB!");
+	static_assert(Lines >= 2, "The cache requires at least two lines!");
+
+	Line*
+	find(bd_address_t address);
+
+	Line*
+	leastRecentlyUsed();
+
+	/// Load a line into the cache, optionally without reading its content
+	modm::ResumableResult<Line*>
+	fetch(bd_address_t address, bool load);
+
+	modm::ResumableResult<bool>
+	writeBack(Line* line);
+
+private:
+	CachedDevice blockDevice;
+	Line lines[Lines];
+	Statistics statistics;
+
+	uint32_t useCounter;
+	bd_address_t lastMiss;
+
+	// state of the resumable functions
+	bd_size_t index;
+	bd_size_t chunk;
+	bd_address_t lineAddress;
+	Line* line;
+	Line* fetchLine;
+	size_t lineIndex;
+	uint16_t writeBlock;
+	uint16_t writeEnd;
+	bool result;
+};
+
+}
+
+#include "block_device_cache_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_CACHE_HPP
@@ -0,0 +1,291 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_CACHE_HPP
+	#error	"Don't include this file directly, use 'block_device_cache.hpp' instead!"
+#endif
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::initialize()
+{
+	RF_BEGIN();
+
+	for (Line& line : lines) {
+		line.address = Invalid;
+		line.clean();
+	}
+	statistics = {};
+	useCounter = 0;
+	lastMiss = Invalid;
+
+	RF_END_RETURN_CALL(blockDevice.initialize());
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::deinitialize()
+{
+	RF_BEGIN();
+
+	result = RF_CALL(flush());
+	result &= RF_CALL(blockDevice.deinitialize());
+
+	RF_END_RETURN(result);
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	for (index = 0; index < size; index += chunk)
+	{
+		lineAddress = (address + index) / LineSize * LineSize;
+		chunk = std::min<bd_size_t>(size - index, lineAddress + LineSize - (address + index));
+
+		if ((line = find(lineAddress))) {
+			statistics.hits++;
+		}
+		else
+		{
+			statistics.misses++;
+			if (not (line = RF_CALL(fetch(lineAddress, true)))) {
+				RF_RETURN(false);
+			}
+			// Two consecutive misses indicate a sequential scan
+			if (lineAddress == lastMiss + LineSize and lineAddress + LineSize < DeviceSize and
+				not find(lineAddress + LineSize))
+			{
+				// the least recently used line is never the one just fetched
+				if (RF_CALL(fetch(lineAddress + LineSize, true))) {
+					statistics.readAheads++;
+				}
+				lastMiss = lineAddress + LineSize;
+			}
+			else lastMiss = lineAddress;
+		}
+
+		line->lastUse = ++useCounter;
+		std::memcpy(&buffer[index], &line->data[address + index - lineAddress], chunk);
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	for (index = 0; index < size; index += chunk)
+	{
+		lineAddress = (address + index) / LineSize * LineSize;
+		chunk = std::min<bd_size_t>(size - index, lineAddress + LineSize - (address + index));
+
+		if (not (line = find(lineAddress)))
+		{
+			// lines that are completely overwritten do not need to be read
+			if (not (line = RF_CALL(fetch(lineAddress, chunk != LineSize)))) {
+				RF_RETURN(false);
+			}
+		}
+
+		std::memcpy(&line->data[address + index - lineAddress], &buffer[index], chunk);
+		line->markDirty(address + index - lineAddress, address + index - lineAddress + chunk);
+		line->lastUse = ++useCounter;
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	for (lineIndex = 0; lineIndex < Lines; lineIndex++)
+	{
+		line = &lines[lineIndex];
+		if (line->address == Invalid or line->address >= address + size or
+			line->address + LineSize <= address) continue;
+
+		// keep buffered data outside of the erased range
+		if (line->isDirty() and (line->address < address or line->address + LineSize > address + size))
+		{
+			if (not RF_CALL(writeBack(line))) {
+				RF_RETURN(false);
+			}
+		}
+		line->address = Invalid;
+		line->clean();
+	}
+
+	RF_END_RETURN_CALL(blockDevice.erase(address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::flush()
+{
+	RF_BEGIN();
+
+	// write back in ascending address order for sequential programming
+	while (true)
+	{
+		line = nullptr;
+		for (Line& candidate : lines)
+		{
+			if (candidate.isDirty() and (not line or candidate.address < line->address)) {
+				line = &candidate;
+			}
+		}
+		if (not line) break;
+		if (not RF_CALL(writeBack(line))) {
+			RF_RETURN(false);
+		}
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::invalidate()
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(flush())) {
+		RF_RETURN(false);
+	}
+	for (Line& line : lines) {
+		line.address = Invalid;
+	}
+	lastMiss = Invalid;
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+typename modm::BdCache<CachedDevice, Lines, LineSize>::Line*
+modm::BdCache<CachedDevice, Lines, LineSize>::find(bd_address_t address)
+{
+	for (Line& line : lines) {
+		if (line.address == address) return &line;
+	}
+	return nullptr;
+}
+
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+typename modm::BdCache<CachedDevice, Lines, LineSize>::Line*
+modm::BdCache<CachedDevice, Lines, LineSize>::leastRecentlyUsed()
+{
+	Line* oldest = &lines[0];
+	for (Line& line : lines)
+	{
+		if (line.address == Invalid) return &line;
+		if (line.lastUse < oldest->lastUse) oldest = &line;
+	}
+	return oldest;
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<typename modm::BdCache<CachedDevice, Lines, LineSize>::Line*>
+modm::BdCache<CachedDevice, Lines, LineSize>::fetch(bd_address_t address, bool load)
+{
+	RF_BEGIN();
+
+	fetchLine = leastRecentlyUsed();
+	if (fetchLine->isDirty() and not RF_CALL(writeBack(fetchLine))) {
+		RF_RETURN(nullptr);
+	}
+	fetchLine->address = Invalid;
+
+	if (load and not RF_CALL(blockDevice.read(fetchLine->data, address, LineSize))) {
+		RF_RETURN(nullptr);
+	}
+	fetchLine->address = address;
+	fetchLine->lastUse = ++useCounter;
+
+	RF_END_RETURN(fetchLine);
+}
+
+// ----------------------------------------------------------------------------
+template <typename CachedDevice, size_t Lines, size_t LineSize>
+modm::ResumableResult<bool>
+modm::BdCache<CachedDevice, Lines, LineSize>::writeBack(Line* victim)
+{
+	RF_BEGIN();
+
+	// program consecutive dirty write blocks together, skip the clean ones
+	for (writeBlock = 0; writeBlock < WriteBlocks; writeBlock = writeEnd)
+	{
+		writeEnd = writeBlock + 1;
+		if (not victim->isDirty(writeBlock)) continue;
+		while (writeEnd < WriteBlocks and victim->isDirty(writeEnd)) writeEnd++;
+
+		if (not RF_CALL(blockDevice.program(
+				&victim->data[writeBlock * CachedDevice::BlockSizeWrite],
+				victim->address + writeBlock * CachedDevice::BlockSizeWrite,
+				(writeEnd - writeBlock) * CachedDevice::BlockSizeWrite)))
+		{
+			RF_RETURN(false);
+		}
+	}
+	victim->clean();
+	statistics.writeBacks++;
+
+	RF_END_RETURN(true);
+}
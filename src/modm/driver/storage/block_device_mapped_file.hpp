@@ -0,0 +1,169 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_MAPPED_FILE_HPP
+#define MODM_BLOCK_DEVICE_MAPPED_FILE_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+
+#include <sys/mman.h>
+
+namespace modm
+{
+
+/// When a memory mapped block device writes its changes back to the file
+enum class
+BdSync : uint8_t
+{
+	Never,			///< Leave write back to the operating system
+	OnWrite,		///< After every `program()`, `erase()` and `write()`
+	OnDeinitialize,	///< Once in `deinitialize()`
+};
+
+/**
+ * \brief	Block device using a memory mapped file
+ *
+ * Faster alternative to `modm::BdFile` for hosted simulations: The file is
+ * mapped into memory once, so reads and programs are plain copies without
+ * any system call. `getMemory()` gives direct access to the device content.
+ *
+ * With `NorEraseSize` set, the device behaves like NOR flash: Programming
+ * can only clear bits and erasing sets whole erase blocks to 0xFF, so
+ * storage code that forgets to erase fails the same way as on hardware.
+ *
+ * \tparam Filename		Class with a static `name` member of the file
+ * \tparam DeviceSize_	Size of the file in bytes
+ * \tparam Sync			When changes are synchronized to the file
+ * \tparam NorEraseSize	Erase block size of the simulated NOR flash, 0 disables the simulation
+ *
+ * \ingroup	modm_driver_block_device_mapped_file
+ */
+template <class Filename, size_t DeviceSize_, BdSync Sync = BdSync::OnDeinitialize, size_t NorEraseSize = 0>
+class BdMappedFile : public modm::BlockDevice, protected modm::NestedResumable<3>
+{
+public:
+	/// Access pattern hints for the operating system
+	enum class
+	Advice : int
+	{
+		Normal = MADV_NORMAL,
+		Sequential = MADV_SEQUENTIAL,
+		Random = MADV_RANDOM,
+		WillNeed = MADV_WILLNEED,
+	};
+
+public:
+	BdMappedFile() = default;
+	~BdMappedFile();
+
+	// owns the file descriptor and the mapping
+	BdMappedFile(const BdMappedFile&) = delete;
+
+	BdMappedFile&
+	operator=(const BdMappedFile&) = delete;
+
+	/// Maps the file into memory and creates it if it is empty
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Unmaps the file
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  Any block has to be erased prior to being programmed
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  The state of an erased block is undefined until it has been programmed
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks after erasing them
+	*
+	*  The blocks are erased prior to being programmed
+	*
+	*  @param buffer	Buffer of data to write to blocks
+	*  @param address	Address of first block to begin writing to
+	*  @param size		Size to write in bytes (multiple of erase block size)
+	*  @return			True on success
+	*/
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+public:
+	/// Synchronously writes all changes back to the file
+	bool
+	sync();
+
+	/// Hints the operating system how a range of the device will be accessed
+	bool
+	advise(Advice advice, bd_address_t address = 0, bd_size_t size = DeviceSize_);
+
+	/// @return the mapped device content or `nullptr` if not initialized
+	const uint8_t*
+	getMemory() const
+	{ return memory; }
+
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 1;
+	static constexpr bd_size_t BlockSizeErase = NorEraseSize ? NorEraseSize : 1;
+	static constexpr bd_size_t DeviceSize = DeviceSize_;
+
+	static_assert(DeviceSize % BlockSizeErase == 0,
+			"DeviceSize must be a multiple of the erase block size!");
+
+private:
+	bool
+	map();
+
+	bool
+	unmap();
+
+	bool
+	syncRange(bd_address_t address, bd_size_t size);
+
+	uint8_t* memory{nullptr};
+	int fd{-1};
+};
+
+}
+
+#include "block_device_mapped_file_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_MAPPED_FILE_HPP
@@ -0,0 +1,211 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_MAPPED_FILE_HPP
+	#error	"Don't include this file directly, use 'block_device_mapped_file.hpp' instead!"
+#endif
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::~BdMappedFile()
+{
+	unmap();
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::ResumableResult<bool>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::initialize()
+{
+	RF_BEGIN();
+	RF_END_RETURN(memory or map());
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::ResumableResult<bool>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::deinitialize()
+{
+	RF_BEGIN();
+	RF_END_RETURN(unmap());
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::ResumableResult<bool>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if(not memory or (size == 0) || (size % BlockSizeRead != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	std::memcpy(buffer, memory + address, size);
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::ResumableResult<bool>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if(not memory or (size == 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	if constexpr (NorEraseSize) {
+		// programming can only clear bits
+		for (bd_size_t ii = 0; ii < size; ii++) {
+			memory[address + ii] &= buffer[ii];
+		}
+	}
+	else std::memcpy(memory + address, buffer, size);
+
+	if constexpr (Sync == BdSync::OnWrite) {
+		RF_RETURN(syncRange(address, size));
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::ResumableResult<bool>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if(not memory or (size == 0) || (size % BlockSizeErase != 0) || (address % BlockSizeErase != 0) ||
+	   (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	if constexpr (NorEraseSize)
+	{
+		std::memset(memory + address, 0xff, size);
+		if constexpr (Sync == BdSync::OnWrite) {
+			RF_RETURN(syncRange(address, size));
+		}
+	}
+	// otherwise erasing does nothing, memory is undefined after erase and has to be programed first
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+modm::ResumableResult<bool>
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+		RF_RETURN(false);
+	}
+
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+bool
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::sync()
+{
+	return syncRange(0, DeviceSize);
+}
+
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+bool
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::syncRange(bd_address_t address, bd_size_t size)
+{
+	if (not memory) return false;
+	// msync and madvise require page aligned addresses
+	static const bd_address_t pageMask = ~bd_address_t(sysconf(_SC_PAGESIZE) - 1);
+	const bd_address_t begin = address & pageMask;
+	return msync(memory + begin, address + size - begin, MS_SYNC) == 0;
+}
+
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+bool
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::advise(Advice advice, bd_address_t address, bd_size_t size)
+{
+	if (not memory or address + size > DeviceSize) return false;
+	static const bd_address_t pageMask = ~bd_address_t(sysconf(_SC_PAGESIZE) - 1);
+	const bd_address_t begin = address & pageMask;
+	return madvise(memory + begin, address + size - begin, int(advice)) == 0;
+}
+
+// ----------------------------------------------------------------------------
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+bool
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::map()
+{
+	fd = open(Filename::name, O_RDWR | O_CREAT, 0644);
+	if (fd < 0) return false;
+
+	struct stat status{};
+	const bool created = (fstat(fd, &status) == 0) and (status.st_size == 0);
+	if (created) {
+		// create empty file with size of DeviceSize
+		if (ftruncate(fd, DeviceSize) != 0) status.st_size = 0;
+		else status.st_size = DeviceSize;
+	}
+	void* mapping = MAP_FAILED;
+	if (size_t(status.st_size) == DeviceSize) {
+		mapping = mmap(nullptr, DeviceSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	}
+	if (mapping == MAP_FAILED)
+	{
+		close(fd);
+		fd = -1;
+		return false;
+	}
+
+	memory = static_cast<uint8_t*>(mapping);
+	// a new flash device starts out erased
+	if (NorEraseSize and created) {
+		std::memset(memory, 0xff, DeviceSize);
+	}
+	return true;
+}
+
+template <class Filename, size_t DeviceSize, modm::BdSync Sync, size_t NorEraseSize>
+bool
+modm::BdMappedFile<Filename, DeviceSize, Sync, NorEraseSize>::unmap()
+{
+	bool result{true};
+	if (memory)
+	{
+		if constexpr (Sync == BdSync::OnDeinitialize) result = sync();
+		munmap(memory, DeviceSize);
+		memory = nullptr;
+	}
+	if (fd >= 0)
+	{
+		close(fd);
+		fd = -1;
+	}
+	return result;
+}
@@ -1,6 +1,7 @@
 // coding: utf-8
 /*
  * Copyright (c) 2018, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -24,8 +25,11 @@ namespace modm
  * \brief	Virtual block device consists of two mirrored block devices.
  *
  * Write operations (`erase()`, `program()` and `write()`) are forwarded
- * to both block devices.
- * Read operations (`read()`) are only performed on BlockDeviceA.
+ * to both block devices. They are split into erase and write blocks, which
+ * are issued to both devices in turn, so that devices returning before the
+ * block is finished (e.g. `modm::BdSpiFlash`) erase and program concurrently.
+ * Read operations (`read()`) are performed on BlockDeviceA, unless it
+ * reports to be busy via `isBusy()` while BlockDeviceB is idle.
  *
  * \tparam BlockDeviceA		First block device of the mirrored block devices
  * \tparam BlockDeviceB		Second block device
@@ -36,6 +40,9 @@ namespace modm
 template <typename BlockDeviceA, typename BlockDeviceB>
 class BdMirror : public modm::BlockDevice, protected NestedResumable<3>
 {
+	static_assert(requires { BlockDeviceA::DeviceSize; BlockDeviceB::DeviceSize; },
+			"Both mirrored devices must have a compile-time DeviceSize!");
+
 public:
 	/// Initializes the storage hardware
 	modm::ResumableResult<bool>
@@ -113,9 +120,27 @@ private:
 	BlockDeviceA blockDeviceA;
 	BlockDeviceB blockDeviceB;
 
+private:
+	// Granularity in which both devices are accessed alternately, which
+	// matches the page and sector size of common flash memories
+	static constexpr bd_size_t ProgramChunk = (256 + BlockSizeWrite - 1) / BlockSizeWrite * BlockSizeWrite;
+	static constexpr bd_size_t EraseChunk = (4096 + BlockSizeErase - 1) / BlockSizeErase * BlockSizeErase;
+
+	template <typename Device>
+	requires requires (Device& device) { device.isBusy(); }
+	modm::ResumableResult<bool>
+	isBusy(Device& device);
+
+	/// Block devices without `isBusy()` are never busy
+	template <typename Device>
+	modm::ResumableResult<bool>
+	isBusy(Device& device);
+
 private:
 	bool resultA;
 	bool resultB;
+	bd_size_t index;
+	bd_size_t chunk;
 
 };
 
@@ -26,7 +26,7 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::initialize()
 	resultA = RF_CALL(blockDeviceA.initialize());
 	resultB = RF_CALL(blockDeviceB.initialize());
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 // ----------------------------------------------------------------------------
@@ -39,7 +39,7 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::deinitialize()
 	resultA = RF_CALL(blockDeviceA.deinitialize());
 	resultB = RF_CALL(blockDeviceB.deinitialize());
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 // ----------------------------------------------------------------------------
@@ -47,7 +47,13 @@ template <typename BlockDeviceA, typename BlockDeviceB>
 modm::ResumableResult<bool>
 modm::BdMirror<BlockDeviceA, BlockDeviceB>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
-	return blockDeviceA.read(buffer, address, size);
+	RF_BEGIN();
+
+	if (RF_CALL(isBusy(blockDeviceA)) and not RF_CALL(isBusy(blockDeviceB))) {
+		RF_RETURN_CALL(blockDeviceB.read(buffer, address, size));
+	}
+
+	RF_END_RETURN_CALL(blockDeviceA.read(buffer, address, size));
 }
 
 // ----------------------------------------------------------------------------
@@ -61,10 +67,16 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::program(const uint8_t* buffer, bd_ad
 		RF_RETURN(false);
 	}
 
-	resultA = RF_CALL(blockDeviceA.program(buffer, address, size));
-	resultB = RF_CALL(blockDeviceB.program(buffer, address, size));
+	// alternate between both devices block by block
+	resultA = resultB = true;
+	for (index = 0; index < size and resultA and resultB; index += chunk)
+	{
+		chunk = std::min(size - index, ProgramChunk);
+		resultA = RF_CALL(blockDeviceA.program(&buffer[index], address + index, chunk));
+		resultB = RF_CALL(blockDeviceB.program(&buffer[index], address + index, chunk));
+	}
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 
@@ -79,10 +91,16 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::erase(bd_address_t address, bd_size_
 		RF_RETURN(false);
 	}
 
-	resultA = RF_CALL(blockDeviceA.erase(address, size));
-	resultB = RF_CALL(blockDeviceB.erase(address, size));
+	// alternate between both devices block by block
+	resultA = resultB = true;
+	for (index = 0; index < size and resultA and resultB; index += chunk)
+	{
+		chunk = std::min(size - index, EraseChunk);
+		resultA = RF_CALL(blockDeviceA.erase(address + index, chunk));
+		resultB = RF_CALL(blockDeviceB.erase(address + index, chunk));
+	}
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN(resultA && resultB);
 }
 
 
@@ -97,8 +115,29 @@ modm::BdMirror<BlockDeviceA, BlockDeviceB>::write(const uint8_t* buffer, bd_addr
 		RF_RETURN(false);
 	}
 
-	resultA = RF_CALL(blockDeviceA.write(buffer, address, size));
-	resultB = RF_CALL(blockDeviceB.write(buffer, address, size));
+	if(!RF_CALL(this->erase(address, size))) {
+		RF_RETURN(false);
+	}
 
-	RF_END_RETURN(resultA && resultA);
+	RF_END_RETURN_CALL(this->program(buffer, address, size));
+}
+
+// ----------------------------------------------------------------------------
+template <typename BlockDeviceA, typename BlockDeviceB>
+template <typename Device>
+requires requires (Device& device) { device.isBusy(); }
+modm::ResumableResult<bool>
+modm::BdMirror<BlockDeviceA, BlockDeviceB>::isBusy(Device& device)
+{
+	RF_BEGIN();
+	RF_END_RETURN_CALL(device.isBusy());
+}
+
+template <typename BlockDeviceA, typename BlockDeviceB>
+template <typename Device>
+modm::ResumableResult<bool>
+modm::BdMirror<BlockDeviceA, BlockDeviceB>::isBusy(Device&)
+{
+	RF_BEGIN();
+	RF_END_RETURN(false);
 }
@@ -0,0 +1,228 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_SDCARD_HPP
+#define MODM_BLOCK_DEVICE_SDCARD_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/architecture/interface/gpio.hpp>
+#include <modm/architecture/interface/spi_device.hpp>
+#include <modm/processing/resumable.hpp>
+#include <modm/processing/timer.hpp>
+
+#include "sd_constants.hpp"
+
+namespace modm
+{
+
+/**
+ * \brief	Block device with an MMC/SD/SDHC card in SPI mode
+ *
+ * Consecutive blocks are streamed with a single multiple block read or write
+ * command and each block is moved with one `Spi::transfer(tx, rx, length)`
+ * call, which uses DMA if the SPI master supports it. Multiple block writes
+ * tell SD cards the number of blocks in advance, so that the card can erase
+ * them before they are programmed.
+ *
+ * While the card is busy, the driver yields after every polled byte instead
+ * of blocking the fiber or protothread.
+ *
+ * The SPI master must be initialized with a baudrate of at most 400 kHz
+ * before calling `initialize()`, and may be reinitialized afterwards with up
+ * to 25 MHz.
+ *
+ * The byte addresses of the `BlockDevice` interface are limited to 4 GiB, use
+ * `readBlocks()` and `writeBlocks()` to access the full card.
+ *
+ * The capacity of the card is only known after `initialize()`, see
+ * `getBlockCount()`. Therefore the card has no compile-time `DeviceSize` and
+ * cannot be used with adapters that require one, like `BdCache`, `BdMirror`
+ * or `KvStore`.
+ *
+ * \tparam Spi	The SpiMaster interface
+ * \tparam Cs	The GpioOutput pin connected to the card chip select
+ *
+ * \ingroup	modm_driver_block_device_sd_card
+ */
+template <typename Spi, typename Cs>
+class BdSdCard : public modm::BlockDevice, public modm::SpiDevice< Spi >, protected NestedResumable<6>
+{
+public:
+	/// Initializes the card and reads its capacity
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Deinitializes nothing
+	modm::ResumableResult<bool>
+	deinitialize();
+
+	/** Read data from one or more blocks
+	 *
+	 *  @param buffer	Buffer to read data into
+	 *  @param address	Address to begin reading from
+	 *  @param size		Size to read in bytes (multiple of read block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Program blocks with data
+	 *
+	 *  The blocks do not have to be erased before being programmed.
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of write block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+	/** Erase blocks
+	 *
+	 *  The state of an erased block is undefined until it has been programmed
+	 *
+	 *  @param address	Address of block to begin erasing
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size);
+
+	/** Writes data to one or more blocks
+	 *
+	 *  Same as `program()`, since the card erases the blocks itself.
+	 *
+	 *  @param buffer	Buffer of data to write to blocks
+	 *  @param address	Address of first block to begin writing to
+	 *  @param size		Size to write in bytes (multiple of write block size)
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size);
+
+public:
+	/** Read consecutive blocks
+	 *
+	 *  @param buffer	Buffer of `count * BlockSize` bytes to read data into
+	 *  @param block	Index of the first block
+	 *  @param count	Number of blocks
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	readBlocks(uint8_t* buffer, uint32_t block, uint32_t count);
+
+	/** Write consecutive blocks
+	 *
+	 *  Returns after the card finished programming the last block.
+	 *
+	 *  @param buffer	Buffer of `count * BlockSize` bytes to write
+	 *  @param block	Index of the first block
+	 *  @param count	Number of blocks
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	writeBlocks(const uint8_t* buffer, uint32_t block, uint32_t count);
+
+	/** Erase consecutive blocks
+	 *
+	 *  @param block	Index of the first block
+	 *  @param count	Number of blocks
+	 *  @return			True on success
+	 */
+	modm::ResumableResult<bool>
+	eraseBlocks(uint32_t block, uint32_t count);
+
+	/// @return the type of the initialized card, or `None`
+	sd::CardType
+	getCardType() const
+	{ return cardType; }
+
+	/// @return the number of blocks of the initialized card
+	uint32_t
+	getBlockCount() const
+	{ return blockCount; }
+
+public:
+	static constexpr bd_size_t BlockSize = sd::BlockSize;
+	static constexpr bd_size_t BlockSizeRead = BlockSize;
+	static constexpr bd_size_t BlockSizeWrite = BlockSize;
+	static constexpr bd_size_t BlockSizeErase = BlockSize;
+
+private:
+	modm::ResumableResult<bool>
+	initializeCard();
+
+	modm::ResumableResult<bool>
+	readData(uint8_t* buffer, uint32_t block, uint32_t count);
+
+	modm::ResumableResult<bool>
+	writeData(const uint8_t* buffer, uint32_t block, uint32_t count);
+
+	modm::ResumableResult<bool>
+	eraseData(uint32_t block, uint32_t count);
+
+	/// Sends a command and returns the R1 response, which is `Invalid` on timeout
+	modm::ResumableResult<uint8_t>
+	sendCommand(sd::Command command, uint32_t argument);
+
+	/// Receives a block of `size` bytes after its start token
+	modm::ResumableResult<bool>
+	receiveDataBlock(uint8_t* buffer, uint16_t size);
+
+	/// Sends a block of `BlockSize` bytes and returns if the card accepted it
+	modm::ResumableResult<bool>
+	sendDataBlock(const uint8_t* buffer, sd::Token token);
+
+	/// Polls the card until it is not busy anymore without blocking
+	modm::ResumableResult<bool>
+	waitReady(modm::Timeout::duration timeout);
+
+	bool
+	isValidRange(uint32_t block, uint32_t count) const
+	{ return count and block < blockCount and count <= blockCount - block; }
+
+	uint32_t
+	toAddress(uint32_t block) const
+	{ return (cardType == sd::CardType::Sdhc) ? block : block * BlockSize; }
+
+	static uint32_t
+	parseBlockCount(const uint8_t* csd);
+
+private:
+	static constexpr std::chrono::milliseconds InitializeTimeout{1'000};
+	static constexpr std::chrono::milliseconds ReadTimeout{100};
+	static constexpr std::chrono::milliseconds WriteTimeout{500};
+	/// Per erased allocation unit of at most 4 MiB
+	static constexpr std::chrono::milliseconds EraseTimeout{250};
+
+	modm::Timeout timeout;
+	modm::Timeout readyTimeout;
+
+	sd::CardType cardType{sd::CardType::None};
+	sd::CardType detectedType;
+	uint32_t blockCount{0};
+	uint32_t index;
+	bool success;
+
+	uint8_t commandBuffer[6];
+	uint8_t data[16];
+	uint8_t crc[2];
+	uint8_t response;
+	uint8_t retries;
+	bool appCommand;
+};
+
+}
+#include "block_device_sdcard_impl.hpp"
+
+#endif // MODM_BLOCK_DEVICE_SDCARD_HPP
@@ -0,0 +1,489 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_BLOCK_DEVICE_SDCARD_HPP
+#error	"Don't include this file directly, use 'block_device_sdcard.hpp' instead!"
+#endif
+#include "block_device_sdcard.hpp"
+
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::initialize()
+{
+	RF_BEGIN();
+	this->attachConfigurationHandler([]() {
+		Spi::setDataMode(Spi::DataMode::Mode0);
+		Spi::setDataOrder(Spi::DataOrder::MsbFirst);
+	});
+	Cs::setOutput(modm::Gpio::High);
+	cardType = sd::CardType::None;
+	blockCount = 0;
+
+	RF_WAIT_UNTIL(this->acquireMaster());
+	// at least 74 clock cycles with deselected card to enter SPI mode
+	std::memset(data, 0xff, 10);
+	RF_CALL(Spi::transfer(data, nullptr, 10));
+
+	Cs::reset();
+	success = RF_CALL(initializeCard());
+	Cs::set();
+	// the card releases MISO only with the next clock
+	RF_CALL(Spi::transfer(0xff));
+	this->releaseMaster();
+
+	if (success) cardType = detectedType;
+	RF_END_RETURN(success);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::deinitialize()
+{
+	RF_BEGIN();
+	cardType = sd::CardType::None;
+	blockCount = 0;
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeRead != 0) || (address % BlockSizeRead != 0)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(readBlocks(buffer, address / BlockSize, size / BlockSize));
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeWrite != 0) || (address % BlockSizeWrite != 0)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(writeBlocks(buffer, address / BlockSize, size / BlockSize));
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::erase(bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeErase != 0) || (address % BlockSizeErase != 0)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(eraseBlocks(address / BlockSize, size / BlockSize));
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+{
+	RF_BEGIN();
+
+	if((size == 0) || (size % BlockSizeWrite != 0) || (address % BlockSizeWrite != 0)) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(writeBlocks(buffer, address / BlockSize, size / BlockSize));
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::readBlocks(uint8_t* buffer, uint32_t block, uint32_t count)
+{
+	RF_BEGIN();
+
+	if (not isValidRange(block, count)) {
+		RF_RETURN(false);
+	}
+
+	RF_WAIT_UNTIL(this->acquireMaster());
+	Cs::reset();
+	success = RF_CALL(readData(buffer, block, count));
+	Cs::set();
+	RF_CALL(Spi::transfer(0xff));
+	this->releaseMaster();
+
+	RF_END_RETURN(success);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::writeBlocks(const uint8_t* buffer, uint32_t block, uint32_t count)
+{
+	RF_BEGIN();
+
+	if (not isValidRange(block, count)) {
+		RF_RETURN(false);
+	}
+
+	RF_WAIT_UNTIL(this->acquireMaster());
+	Cs::reset();
+	success = RF_CALL(writeData(buffer, block, count));
+	Cs::set();
+	RF_CALL(Spi::transfer(0xff));
+	this->releaseMaster();
+
+	RF_END_RETURN(success);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::eraseBlocks(uint32_t block, uint32_t count)
+{
+	RF_BEGIN();
+
+	if (not isValidRange(block, count)) {
+		RF_RETURN(false);
+	}
+
+	RF_WAIT_UNTIL(this->acquireMaster());
+	Cs::reset();
+	success = RF_CALL(eraseData(block, count));
+	Cs::set();
+	RF_CALL(Spi::transfer(0xff));
+	this->releaseMaster();
+
+	RF_END_RETURN(success);
+}
+
+// ============================================================================
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::initializeCard()
+{
+	RF_BEGIN();
+
+	if (RF_CALL(sendCommand(sd::Command::GoIdleState, 0)) != uint8_t(sd::R1::Idle)) {
+		RF_RETURN(false);
+	}
+
+	timeout.restart(InitializeTimeout);
+	if (RF_CALL(sendCommand(sd::Command::SendInterfaceCondition, sd::InterfaceCondition)) == uint8_t(sd::R1::Idle))
+	{
+		// SD ver 2 echoes the voltage range and check pattern
+		std::memset(data, 0xff, 4);
+		RF_CALL(Spi::transfer(data, data, 4));
+		if (((data[2] << 8 | data[3]) & 0xFFF) != sd::InterfaceCondition) {
+			RF_RETURN(false);
+		}
+
+		while (RF_CALL(sendCommand(sd::Command::AppSendOpCondition, sd::OcrCardCapacityStatus)) != 0)
+		{
+			if (timeout.isExpired()) {
+				RF_RETURN(false);
+			}
+			RF_YIELD();
+		}
+
+		if (RF_CALL(sendCommand(sd::Command::ReadOcr, 0)) != 0) {
+			RF_RETURN(false);
+		}
+		std::memset(data, 0xff, 4);
+		RF_CALL(Spi::transfer(data, data, 4));
+		detectedType = (data[0] & (sd::OcrCardCapacityStatus >> 24)) ? sd::CardType::Sdhc : sd::CardType::SdV2;
+	}
+	else
+	{
+		// SD ver 1 accepts the application command, MMC ver 3 does not
+		detectedType = sd::CardType::SdV1;
+		if (RF_CALL(sendCommand(sd::Command::AppSendOpCondition, 0)) > uint8_t(sd::R1::Idle)) {
+			detectedType = sd::CardType::Mmc;
+		}
+
+		while (RF_CALL(sendCommand(detectedType == sd::CardType::Mmc ?
+				sd::Command::SendOpCondition : sd::Command::AppSendOpCondition, 0)) != 0)
+		{
+			if (timeout.isExpired()) {
+				RF_RETURN(false);
+			}
+			RF_YIELD();
+		}
+	}
+
+	if (detectedType != sd::CardType::Sdhc)
+	{
+		if (RF_CALL(sendCommand(sd::Command::SetBlockLength, BlockSize)) != 0) {
+			RF_RETURN(false);
+		}
+	}
+
+	if (RF_CALL(sendCommand(sd::Command::SendCsd, 0)) != 0) {
+		RF_RETURN(false);
+	}
+	if (not RF_CALL(receiveDataBlock(data, sizeof(data)))) {
+		RF_RETURN(false);
+	}
+	blockCount = parseBlockCount(data);
+
+	RF_END_RETURN(blockCount != 0);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::readData(uint8_t* buffer, uint32_t block, uint32_t count)
+{
+	RF_BEGIN();
+
+	if (count == 1)
+	{
+		if (RF_CALL(sendCommand(sd::Command::ReadSingleBlock, toAddress(block))) != 0) {
+			RF_RETURN(false);
+		}
+		RF_RETURN_CALL(receiveDataBlock(buffer, BlockSize));
+	}
+
+	if (RF_CALL(sendCommand(sd::Command::ReadMultipleBlock, toAddress(block))) != 0) {
+		RF_RETURN(false);
+	}
+	for (index = 0; index < count; index++)
+	{
+		if (not RF_CALL(receiveDataBlock(buffer + index * BlockSize, BlockSize))) {
+			break;
+		}
+	}
+	// the card keeps streaming blocks until it is stopped
+	RF_CALL(sendCommand(sd::Command::StopTransmission, 0));
+	// the R1b response is followed by busy until the card has stopped
+	if (not RF_CALL(waitReady(ReadTimeout))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN(index == count);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::writeData(const uint8_t* buffer, uint32_t block, uint32_t count)
+{
+	RF_BEGIN();
+
+	if (count == 1)
+	{
+		if (RF_CALL(sendCommand(sd::Command::WriteBlock, toAddress(block))) != 0) {
+			RF_RETURN(false);
+		}
+		if (not RF_CALL(sendDataBlock(buffer, sd::Token::StartBlock))) {
+			RF_RETURN(false);
+		}
+		RF_RETURN_CALL(waitReady(WriteTimeout));
+	}
+
+	if (cardType != sd::CardType::Mmc)
+	{
+		// lets the card pre-erase the blocks, so programming them is faster
+		if (RF_CALL(sendCommand(sd::Command::AppSetWriteBlockEraseCount, count)) != 0) {
+			RF_RETURN(false);
+		}
+	}
+	if (RF_CALL(sendCommand(sd::Command::WriteMultipleBlock, toAddress(block))) != 0) {
+		RF_RETURN(false);
+	}
+	for (index = 0; index < count; index++)
+	{
+		if (not RF_CALL(sendDataBlock(buffer + index * BlockSize, sd::Token::StartMultipleWrite))) {
+			break;
+		}
+	}
+
+	if (not RF_CALL(waitReady(WriteTimeout))) {
+		RF_RETURN(false);
+	}
+	RF_CALL(Spi::transfer(uint8_t(sd::Token::StopTransmission)));
+	// the card signals busy only one byte after the stop token
+	RF_CALL(Spi::transfer(0xff));
+	if (not RF_CALL(waitReady(WriteTimeout))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN(index == count);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::eraseData(uint32_t block, uint32_t count)
+{
+	RF_BEGIN();
+
+	if (RF_CALL(sendCommand(sd::Command::EraseWriteBlockStart, toAddress(block))) != 0) {
+		RF_RETURN(false);
+	}
+	if (RF_CALL(sendCommand(sd::Command::EraseWriteBlockEnd, toAddress(block + count - 1))) != 0) {
+		RF_RETURN(false);
+	}
+	if (RF_CALL(sendCommand(sd::Command::Erase, 0)) != 0) {
+		RF_RETURN(false);
+	}
+	// the card is busy until all blocks are erased
+	RF_CALL(Spi::transfer(0xff));
+
+	RF_END_RETURN_CALL(waitReady(EraseTimeout * (count / 8192 + 1)));
+}
+
+// ----------------------------------------------------------------------------
+template <typename Spi, typename Cs>
+modm::ResumableResult<uint8_t>
+modm::BdSdCard<Spi, Cs>::sendCommand(sd::Command command, uint32_t argument)
+{
+	RF_BEGIN();
+
+	appCommand = uint8_t(command) & uint8_t(sd::Command::App);
+	while (true)
+	{
+		if (command != sd::Command::GoIdleState and command != sd::Command::StopTransmission)
+		{
+			if (not RF_CALL(waitReady(WriteTimeout))) {
+				RF_RETURN(uint8_t(sd::R1::Invalid));
+			}
+		}
+
+		if (appCommand) {
+			commandBuffer[0] = 0x40 | uint8_t(sd::Command::AppCommand);
+			std::memset(commandBuffer + 1, 0, 4);
+		} else {
+			commandBuffer[0] = 0x40 | (uint8_t(command) & 0x3F);
+			commandBuffer[1] = argument >> 24;
+			commandBuffer[2] = argument >> 16;
+			commandBuffer[3] = argument >> 8;
+			commandBuffer[4] = argument;
+		}
+		// only these commands are CRC checked in SPI mode
+		if (commandBuffer[0] == 0x40) {
+			commandBuffer[5] = 0x95;
+		} else if (commandBuffer[0] == (0x40 | uint8_t(sd::Command::SendInterfaceCondition))) {
+			commandBuffer[5] = 0x87;
+		} else {
+			commandBuffer[5] = 0x01;
+		}
+		RF_CALL(Spi::transfer(commandBuffer, nullptr, 6));
+
+		if (command == sd::Command::StopTransmission) {
+			// skip the stuff byte
+			RF_CALL(Spi::transfer(0xff));
+		}
+		// the response follows within 8 bytes
+		retries = 10;
+		do {
+			response = RF_CALL(Spi::transfer(0xff));
+		}
+		while ((response & uint8_t(sd::R1::Invalid)) and --retries);
+
+		if (not appCommand or response > uint8_t(sd::R1::Idle)) {
+			break;
+		}
+		appCommand = false;
+	}
+
+	RF_END_RETURN(response);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::receiveDataBlock(uint8_t* buffer, uint16_t size)
+{
+	RF_BEGIN();
+
+	readyTimeout.restart(ReadTimeout);
+	while ((response = RF_CALL(Spi::transfer(0xff))) == 0xff)
+	{
+		if (readyTimeout.isExpired()) {
+			RF_RETURN(false);
+		}
+		RF_YIELD();
+	}
+	if (response != uint8_t(sd::Token::StartBlock)) {
+		RF_RETURN(false);
+	}
+
+	// the card requires MOSI to be high while sending, so transfer in-place
+	std::memset(buffer, 0xff, size);
+	RF_CALL(Spi::transfer(buffer, buffer, size));
+	// discard the CRC
+	std::memset(crc, 0xff, 2);
+	RF_CALL(Spi::transfer(crc, nullptr, 2));
+
+	RF_END_RETURN(true);
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::sendDataBlock(const uint8_t* buffer, sd::Token token)
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(waitReady(WriteTimeout))) {
+		RF_RETURN(false);
+	}
+
+	RF_CALL(Spi::transfer(uint8_t(token)));
+	RF_CALL(Spi::transfer(buffer, nullptr, BlockSize));
+	// the CRC is not checked in SPI mode
+	std::memset(crc, 0xff, 2);
+	RF_CALL(Spi::transfer(crc, nullptr, 2));
+
+	// the card is busy programming the block after the data response
+	response = RF_CALL(Spi::transfer(0xff));
+
+	RF_END_RETURN((response & uint8_t(sd::DataResponse::Mask)) == uint8_t(sd::DataResponse::Accepted));
+}
+
+template <typename Spi, typename Cs>
+modm::ResumableResult<bool>
+modm::BdSdCard<Spi, Cs>::waitReady(modm::Timeout::duration interval)
+{
+	RF_BEGIN();
+
+	readyTimeout.restart(interval);
+	// the card holds MISO low while it is busy
+	while (RF_CALL(Spi::transfer(0xff)) != 0xff)
+	{
+		if (readyTimeout.isExpired()) {
+			RF_RETURN(false);
+		}
+		RF_YIELD();
+	}
+
+	RF_END_RETURN(true);
+}
+
+template <typename Spi, typename Cs>
+uint32_t
+modm::BdSdCard<Spi, Cs>::parseBlockCount(const uint8_t* csd)
+{
+	if ((csd[0] >> 6) == 1)
+	{
+		// CSD ver 2: capacity in units of 512 KiB
+		const uint32_t size = uint32_t(csd[7] & 0x3F) << 16 | uint32_t(csd[8]) << 8 | csd[9];
+		return (size + 1) << 10;
+	}
+	// CSD ver 1 and MMC: capacity = (C_SIZE + 1) * 2^(C_SIZE_MULT + 2) * 2^READ_BL_LEN
+	const uint32_t size = uint32_t(csd[6] & 0x03) << 10 | uint32_t(csd[7]) << 2 | csd[8] >> 6;
+	const uint8_t multiplier = ((csd[9] & 0x03) << 1 | csd[10] >> 7) + 2;
+	const uint8_t length = csd[5] & 0x0F;
+	if (length + multiplier < 9) return 0;
+	return (size + 1) << (length + multiplier - 9);
+}
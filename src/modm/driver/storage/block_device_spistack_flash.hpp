@@ -28,12 +28,35 @@ namespace modm
  * The `read()`, `erase()`,`program()` and `write()` methodes wait for
  * the chip to finish writing to the flash.
  *
+ * Erase and program jobs are split into erase sectors and pages, which are
+ * issued to the dies in turn: While one die is busy erasing or programming,
+ * the next command is already sent to another die. Dies that are erased
+ * completely use a single chip erase.
+ *
+ * With the striped layout, consecutive erase blocks are distributed over
+ * all dies (like RAID0), so that even small sequential jobs keep all dies
+ * busy. The striped layout is not compatible with data written using the
+ * linear layout.
+ *
+ * Every change of the die runs `selectDie()` of the SPI block device, which
+ * for `BdSpiFlash` sends the die select, write enable and global block unlock
+ * commands and waits for the selected die twice. Pipelined program jobs
+ * change the die for every page, and striped reads for every erase block.
+ * In the simulation of four stacked dies in
+ * `examples/linux/block_device/spi_stack_flash`, these commands take about
+ * 6 µs per change of the die, which is 2% of a pipelined write of the whole
+ * device and 1% of a striped read. Most of the time spent in `selectDie()`
+ * of a pipelined job is waiting until the selected die finished its previous
+ * page, which the next program command would have to wait for anyway.
+ *
  * \tparam SpiBlockDevice		Base SPI block device of the homogenous stack
+ * \tparam DieCount				Number of dies in the stack
+ * \tparam Striped				Interleave the dies in units of erase blocks
  *
  * \ingroup	modm_driver_block_device_spi_stack_flash
  * \author	Rasmus Kleist Hørlyck Sørensen
  */
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped = false>
 class BdSpiStackFlash : public modm::BlockDevice, protected NestedResumable<3>
 {
 public:
@@ -60,8 +83,8 @@ public:
 	 *  Any block has to be erased prior to being programmed
 	 *
 	 *  @param buffer	Buffer of data to write to blocks
-	 *  @param address	Address of first block to begin writing to
-	 *  @param size		Size to write in bytes (multiple of read block size)
+	 *  @param address	Address of first block to begin writing to (aligned to write block size)
+	 *  @param size		Size to write in bytes (multiple of write block size)
 	 *  @return			True on success
 	 */
 	modm::ResumableResult<bool>
@@ -71,8 +94,8 @@ public:
 	 *
 	 *  The state of an erased block is undefined until it has been programmed
 	 *
-	 *  @param address	Address of block to begin erasing
-	 *  @param size		Size to erase in bytes (multiple of read block size)
+	 *  @param address	Address of block to begin erasing (aligned to erase block size)
+	 *  @param size		Size to erase in bytes (multiple of erase block size)
 	 *  @return			True on success
 	 */
 	modm::ResumableResult<bool>
@@ -110,11 +133,40 @@ public:
 	static constexpr bd_size_t BlockSizeErase = SpiBlockDevice::BlockSizeErase;
 	static constexpr bd_size_t DieSize = SpiBlockDevice::DeviceSize;
 	static constexpr bd_size_t DeviceSize = DieCount * DieSize;
+	/// Size of the contiguous address range mapped to a single die
+	static constexpr bd_size_t StripeSize = Striped ? BlockSizeErase : DieSize;
+
+	static_assert(DieSize % StripeSize == 0, "DieSize must be a multiple of the erase block size!");
+	static_assert(StripeSize % BlockSizeWrite == 0, "The erase block size must be a multiple of the write block size!");
+
+private:
+	struct DieAddress
+	{
+		uint8_t die;
+		bd_address_t address;
+	};
+
+	static constexpr DieAddress
+	toDie(bd_address_t address);
+
+	static constexpr bd_address_t
+	fromDie(uint8_t die, bd_address_t address);
+
+	/// Splits an address range into a range on every die
+	void
+	distribute(bd_address_t address, bd_size_t size);
+
+	modm::ResumableResult<void>
+	select(uint8_t die);
 
 private:
-	std::ldiv_t dv;
+	DieAddress dv;
 	uint32_t index;
 	uint8_t currentDie;
+	uint8_t die;
+	bool pending;
+	bd_address_t dieBegin[DieCount];
+	bd_address_t dieEnd[DieCount];
 	SpiBlockDevice spiBlockDevice;
 };
 
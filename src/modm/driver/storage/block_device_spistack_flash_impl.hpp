@@ -16,9 +16,9 @@
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::initialize()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::initialize()
 {
 	RF_BEGIN();
 
@@ -32,9 +32,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::initialize()
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::deinitialize()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::deinitialize()
 {
 	RF_BEGIN();
 	RF_END_RETURN_CALL(spiBlockDevice.deinitialize());
@@ -42,9 +42,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::deinitialize()
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::read(uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
@@ -54,12 +54,12 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::read(uint8_t* buffer, bd_addres
 
 	index = 0;
 	while (index < size) {
-		dv = std::ldiv(index + address, DieSize); // dv.quot = die #ID, dv.rem = die address
-		if (currentDie != dv.quot) {
-			RF_CALL(spiBlockDevice.selectDie(currentDie = dv.quot));
-		}
-		if (RF_CALL(spiBlockDevice.read(&buffer[index], dv.rem, std::min(size - index, DieSize - dv.rem)))) {
-			index += DieSize - dv.rem; // size - index <= DieSize - dv.rem only on last iteration!
+		dv = toDie(index + address);
+		RF_CALL(select(dv.die));
+		// size - index <= StripeSize - offset only on last iteration!
+		if (RF_CALL(spiBlockDevice.read(&buffer[index], dv.address,
+				std::min<bd_size_t>(size - index, StripeSize - (index + address) % StripeSize)))) {
+			index += StripeSize - (index + address) % StripeSize;
 		} else {
 			RF_RETURN(false);
 		}
@@ -70,65 +70,72 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::read(uint8_t* buffer, bd_addres
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
-	if((size == 0) || (size % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
+	if((size == 0) || (size % BlockSizeWrite != 0) || (address % BlockSizeWrite != 0) || (address + size > DeviceSize)) {
 		RF_RETURN(false);
 	}
 
-	index = 0;
-	while (index < size) {
-		dv = std::ldiv(index + address, DieSize); // dv.quot = die #ID, dv.rem = die address
-		if (currentDie != dv.quot) {
-			RF_CALL(spiBlockDevice.selectDie(currentDie = dv.quot));
+	// Program one page per die in turn, so the pages of the other dies are
+	// transferred while the previous page is being programmed.
+	distribute(address, size);
+	do {
+		pending = false;
+		for (die = 0; die < DieCount; die++) {
+			if (dieBegin[die] >= dieEnd[die]) continue;
+			pending = true;
+			RF_CALL(select(die));
+			if (not RF_CALL(spiBlockDevice.program(&buffer[fromDie(die, dieBegin[die]) - address], dieBegin[die], BlockSizeWrite))) {
+				RF_RETURN(false);
+			}
+			dieBegin[die] += BlockSizeWrite;
 		}
-		if (RF_CALL(spiBlockDevice.program(&buffer[index], dv.rem, std::min(size - index, DieSize - dv.rem)))) {
-			index += DieSize - dv.rem; // size - index <= DieSize - dv.rem only on last iteration!
-		} else {
-			RF_RETURN(false);
-		}
-	}
+	} while (pending);
 
 	RF_END_RETURN(true);
 }
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::erase(bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::erase(bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
-	if((size == 0) || (size % BlockSizeErase != 0) || (address + size > DeviceSize)) {
+	if((size == 0) || (size % BlockSizeErase != 0) || (address % BlockSizeErase != 0) || (address + size > DeviceSize)) {
 		RF_RETURN(false);
 	}
 
-	index = 0;
-	while (index < size) {
-		dv = std::ldiv(index + address, DieSize); // dv.quot = die #ID, dv.rem = die address
-		if (currentDie != dv.quot) {
-			RF_CALL(spiBlockDevice.selectDie(currentDie = dv.quot));
+	// Erase one sector per die in turn, so all dies erase in parallel
+	distribute(address, size);
+	do {
+		pending = false;
+		for (die = 0; die < DieCount; die++) {
+			if (dieBegin[die] >= dieEnd[die]) continue;
+			pending = true;
+			RF_CALL(select(die));
+			// dies that are erased completely use a chip erase
+			index = (dieBegin[die] == 0 and dieEnd[die] == DieSize) ? DieSize : BlockSizeErase;
+			if (not RF_CALL(spiBlockDevice.erase(dieBegin[die], index))) {
+				RF_RETURN(false);
+			}
+			dieBegin[die] += index;
 		}
-		if (RF_CALL(spiBlockDevice.erase(dv.rem, std::min(size - index, DieSize - dv.rem)))) {
-			index += DieSize - dv.rem; // size - index <= DieSize - dv.rem only on last iteration!
-		} else {
-			RF_RETURN(false);
-		}
-	}
+	} while (pending);
 
 	RF_END_RETURN(true);
 }
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
 {
 	RF_BEGIN();
 
@@ -149,9 +156,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::write(const uint8_t* buffer, bd
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<bool>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::isBusy()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::isBusy()
 {
 	RF_BEGIN();
 
@@ -168,9 +175,9 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::isBusy()
 
 // ----------------------------------------------------------------------------
 
-template <typename SpiBlockDevice, uint8_t DieCount>
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
 modm::ResumableResult<void>
-modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::waitWhileBusy()
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::waitWhileBusy()
 {
 	RF_BEGIN();
 	while(RF_CALL(isBusy())) {
@@ -178,3 +185,52 @@ modm::BdSpiStackFlash<SpiBlockDevice, DieCount>::waitWhileBusy()
 	}
 	RF_END();
 }
+
+// ----------------------------------------------------------------------------
+
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
+constexpr typename modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::DieAddress
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::toDie(bd_address_t address)
+{
+	const bd_address_t stripe = address / StripeSize;
+	return {uint8_t(stripe % DieCount), (stripe / DieCount) * StripeSize + address % StripeSize};
+}
+
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
+constexpr modm::BlockDevice::bd_address_t
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::fromDie(uint8_t die, bd_address_t address)
+{
+	return ((address / StripeSize) * DieCount + die) * StripeSize + address % StripeSize;
+}
+
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
+void
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::distribute(bd_address_t address, bd_size_t size)
+{
+	const bd_address_t firstStripe = address / StripeSize;
+	const bd_address_t lastStripe = (address + size - 1) / StripeSize;
+	for (uint8_t ii = 0; ii < DieCount; ii++)
+	{
+		// first and last stripe within the range located on this die
+		const bd_address_t first = firstStripe + (ii + DieCount - firstStripe % DieCount) % DieCount;
+		const bd_address_t last = lastStripe - (lastStripe % DieCount + DieCount - ii) % DieCount;
+		if (first > lastStripe or last < firstStripe)
+		{
+			dieBegin[ii] = dieEnd[ii] = 0;
+			continue;
+		}
+		dieBegin[ii] = toDie(std::max<bd_address_t>(address, first * StripeSize)).address;
+		dieEnd[ii] = toDie(std::min<bd_address_t>(address + size, (last + 1) * StripeSize) - 1).address + 1;
+	}
+}
+
+template <typename SpiBlockDevice, uint8_t DieCount, bool Striped>
+modm::ResumableResult<void>
+modm::BdSpiStackFlash<SpiBlockDevice, DieCount, Striped>::select(uint8_t die)
+{
+	RF_BEGIN();
+	if (currentDie != die) {
+		RF_CALL(spiBlockDevice.selectDie(currentDie = die));
+	}
+	RF_END();
+}
@@ -0,0 +1,332 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_KV_STORE_HPP
+#define MODM_KV_STORE_HPP
+
+#include <modm/architecture/interface/block_device.hpp>
+#include <modm/processing/resumable.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <string_view>
+
+namespace modm
+{
+
+/**
+ * \brief	Log-structured key-value store on top of a block device
+ *
+ * Values are appended as CRC protected records to a circular log of erase
+ * sectors, so updating a value only programs a few write blocks instead of
+ * erasing and rewriting a whole sector. An in-RAM hash index maps every key
+ * to the address of its latest record.
+ *
+ * When the log runs out of free sectors, the oldest sector is compacted by
+ * copying its live records to the head of the log. Since static values are
+ * moved along with the log, all sectors are erased equally often. The erase
+ * count of every sector is stored in its header.
+ *
+ * A record only becomes valid once it has been programmed completely, so a
+ * power loss at any point keeps either the old or the new value of a key.
+ * Partially programmed records are detected by their CRC when mounting and
+ * the affected sector is closed for further writes.
+ *
+ * `set()` and `remove()` compact the log on demand. To move this work out
+ * of the critical path, call `compact()` from an idle fiber while
+ * `needsCompaction()` returns true.
+ *
+ * \code
+ * modm::KvStore<modm::BdSpiFlash<SpiMaster, Cs, 8_MiB>, 32, 64> store;
+ * store.initialize();
+ * constexpr auto Gain = store.hash("gain");
+ * store.set(Gain, (const uint8_t*)&gain, sizeof(gain));
+ * store.get(Gain, (uint8_t*)&gain, sizeof(gain));
+ * \endcode
+ *
+ * \tparam	BlockDevice		Underlying block device
+ * \tparam	MaxKeys			Maximum number of keys stored at the same time
+ * \tparam	MaxValueSize	Maximum size of a single value in bytes
+ * \tparam	SectorSize		Size of a log sector, multiple of the erase block size
+ *
+ * \ingroup	modm_driver_kv_store
+ */
+template < class BlockDevice, size_t MaxKeys = 32, size_t MaxValueSize = 64,
+		   uint32_t SectorSize = std::max<uint32_t>(BlockDevice::BlockSizeErase, 4096) >
+class KvStore : protected modm::NestedResumable<6>
+{
+	static_assert(requires { BlockDevice::DeviceSize; },
+			"The block device must have a compile-time DeviceSize!");
+
+public:
+	using key_t = uint32_t;
+	using bd_address_t = modm::BlockDevice::bd_address_t;
+	using bd_size_t = modm::BlockDevice::bd_size_t;
+
+public:
+	/// Initializes the block device and mounts the store
+	modm::ResumableResult<bool>
+	initialize();
+
+	/// Rebuilds the index from the log or formats an empty device
+	modm::ResumableResult<bool>
+	mount();
+
+	/// Discards all keys and restarts the log in the first sector
+	modm::ResumableResult<bool>
+	format();
+
+	/** Read the value of a key
+	 *
+	 *  @param key		Key to read
+	 *  @param value	Buffer to copy the value into
+	 *  @param size		Size of the buffer, larger values are truncated
+	 *  @return			True if the key exists and its record is intact
+	 */
+	modm::ResumableResult<bool>
+	get(key_t key, uint8_t* value, size_t size);
+
+	/** Store a value for a key
+	 *
+	 *  @param key		Key to write
+	 *  @param value	Data to store
+	 *  @param size		Size of the data, at most `MaxValueSize`
+	 *  @return			True once the value has been programmed
+	 */
+	modm::ResumableResult<bool>
+	set(key_t key, const uint8_t* value, size_t size);
+
+	/// Removes a key from the store, returns false if the key does not exist
+	modm::ResumableResult<bool>
+	remove(key_t key);
+
+	/// Reclaims the oldest log sector by moving its live records to the head
+	modm::ResumableResult<bool>
+	compact();
+
+public:
+	bool
+	contains(key_t key) const
+	{ return find(key) != nullptr; }
+
+	/// @return size of the value of a key or zero if the key does not exist
+	size_t
+	getSize(key_t key) const;
+
+	size_t
+	getKeyCount() const
+	{ return keyCount; }
+
+	/// @return remaining space for records in bytes
+	bd_size_t
+	getFreeSize() const
+	{ return Capacity - liveBytes; }
+
+	/// @return true if there are few free sectors left and `compact()` can reclaim space
+	bool
+	needsCompaction() const;
+
+	/// FNV-1a hash to derive keys from strings at compile time
+	static constexpr key_t
+	hash(std::string_view name)
+	{
+		key_t key{2166136261ul};
+		for (const char c : name) key = (key ^ uint8_t(c)) * 16777619ul;
+		return key;
+	}
+
+	BlockDevice&
+	getBlockDevice()
+	{ return blockDevice; }
+
+public:
+	static constexpr bd_size_t Sectors = BlockDevice::DeviceSize / SectorSize;
+
+protected:
+	enum class
+	Type : uint8_t
+	{
+		Value = 0x01,
+		Tombstone = 0x02,
+		Compacted = 0x03,
+	};
+
+	enum class
+	Scan : uint8_t
+	{
+		Valid,
+		End,
+		Corrupt,
+	};
+
+	struct SectorHeader
+	{
+		uint32_t magic;
+		uint32_t sequence;
+		uint32_t eraseCount;
+		uint32_t crc;
+	};
+
+	struct RecordHeader
+	{
+		key_t key;
+		uint16_t length;
+		Type type;
+		uint8_t check;
+		uint32_t crc;
+	};
+
+	struct Entry
+	{
+		key_t key;
+		bd_address_t address;	// zero marks an empty slot
+		uint16_t length;
+	};
+
+	static constexpr uint32_t SectorMagic = 0x4d4b5653; // "SVKM"
+	static constexpr uint8_t RecordCheck = 0xa5;
+
+	static constexpr bd_size_t
+	align(bd_size_t size)
+	{ return (size + BlockDevice::BlockSizeWrite - 1) / BlockDevice::BlockSizeWrite * BlockDevice::BlockSizeWrite; }
+
+	static constexpr bd_size_t
+	recordSize(size_t length)
+	{ return align(sizeof(RecordHeader) + length); }
+
+	static constexpr bd_size_t SectorHeaderSize = align(sizeof(SectorHeader));
+	static constexpr bd_size_t SectorPayload = SectorSize - SectorHeaderSize;
+	static constexpr bd_size_t MarkerSize = recordSize(0);
+	static constexpr bd_size_t RecordSizeMax = recordSize(MaxValueSize);
+	// Room kept free in every sector so that an interrupted compaction,
+	// which left a partially programmed record behind, can be completed.
+	static constexpr bd_size_t CompactionReserve = MarkerSize + RecordSizeMax;
+	static constexpr bd_size_t HeaderReadSize =
+			(sizeof(RecordHeader) + BlockDevice::BlockSizeRead - 1) / BlockDevice::BlockSizeRead * BlockDevice::BlockSizeRead;
+	// Every sector but the reserve must be able to hold the live data even
+	// when the remainder of each sector is too small for the next record.
+	static constexpr bd_size_t Capacity =
+			(Sectors - 1) * (SectorPayload - CompactionReserve - (RecordSizeMax - BlockDevice::BlockSizeWrite));
+	static constexpr size_t IndexSize = std::bit_ceil(MaxKeys * 2);
+	static constexpr uint8_t IndexShift = 32 - std::countr_zero(IndexSize);
+
+	static_assert(SectorSize % BlockDevice::BlockSizeErase == 0,
+			"SectorSize must be a multiple of the erase block size!");
+	static_assert(BlockDevice::BlockSizeWrite % BlockDevice::BlockSizeRead == 0,
+			"The write block size must be a multiple of the read block size!");
+	static_assert(Sectors >= 2, "The store requires at least two sectors!");
+	static_assert(SectorPayload > CompactionReserve + RecordSizeMax,
+			"SectorSize is too small for MaxValueSize!");
+	static_assert(MaxValueSize <= 0xffff, "MaxValueSize is limited to 64kB!");
+	static_assert(MaxKeys > 0, "MaxKeys must be at least one!");
+
+protected:
+	modm::ResumableResult<bool>
+	readSectorHeader(bd_size_t sector);
+
+	modm::ResumableResult<Scan>
+	readRecord(bd_size_t sector, bd_size_t offset, uint32_t sequence);
+
+	modm::ResumableResult<bool>
+	nextRecord(bd_size_t sector, bd_size_t& offset, uint32_t sequence);
+
+	modm::ResumableResult<bool>
+	openSector(bd_size_t sector);
+
+	modm::ResumableResult<bool>
+	appendRecord(Type type, key_t key, const uint8_t* value, size_t size, bool compacting);
+
+	modm::ResumableResult<bool>
+	makeSpace(bd_size_t size);
+
+	static uint32_t
+	computeCrc(const uint8_t* data, size_t length);
+
+	static bool
+	isBlank(const uint8_t* data, size_t length);
+
+	bd_size_t
+	next(bd_size_t sector) const
+	{ return (sector + 1 == Sectors) ? 0 : sector + 1; }
+
+	bd_size_t
+	freeSectors() const
+	{ return Sectors - usedSectors; }
+
+	uint32_t
+	sequenceOf(bd_size_t sector) const
+	{ return headSequence - (head + Sectors - sector) % Sectors; }
+
+	bool
+	fits(bd_size_t size) const
+	{ return headOffset + size <= SectorSize - CompactionReserve or freeSectors() >= 2; }
+
+	const Entry*
+	find(key_t key) const;
+
+	Entry*
+	find(key_t key)
+	{ return const_cast<Entry*>(static_cast<const KvStore*>(this)->find(key)); }
+
+	Entry&
+	insert(key_t key);
+
+	void
+	erase(Entry* entry);
+
+	void
+	clearIndex();
+
+private:
+	BlockDevice blockDevice;
+
+	Entry index[IndexSize];
+	size_t keyCount;
+	bd_size_t liveBytes;
+	bd_size_t usedBytes;
+
+	bd_size_t head;
+	bd_size_t tail;
+	bd_size_t usedSectors;
+	bd_size_t headOffset;
+	uint32_t headSequence;
+	uint32_t deadSequence;
+
+	// decoded by readSectorHeader() and readRecord()
+	SectorHeader sectorHeader;
+	bool sectorValid;
+	RecordHeader recordHeader;
+	bd_size_t recordLength;
+	Scan scan;
+	bool scanCorrupt;
+	bd_size_t scanDirtyEnd;
+
+	// state of the resumable functions
+	bd_size_t mountSector;
+	bd_size_t mountOffset;
+	uint32_t mountSequence;
+	bd_size_t compactOffset;
+	bd_address_t compactAddress;
+	bd_size_t compactSector;
+	uint32_t compactSequence;
+	bd_address_t appendAddress;
+	uint8_t attempts;
+	Entry* entry;
+
+	alignas(4) uint8_t buffer[std::max(RecordSizeMax, SectorHeaderSize)];
+};
+
+}	// namespace modm
+
+#include "kv_store_impl.hpp"
+
+#endif // MODM_KV_STORE_HPP
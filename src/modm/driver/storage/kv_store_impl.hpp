@@ -0,0 +1,577 @@
+// coding: utf-8
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_KV_STORE_HPP
+	#error	"Don't include this file directly, use 'kv_store.hpp' instead!"
+#endif
+#include <modm/math/utils/crc.hpp>
+#include <cstring>
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::initialize()
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(blockDevice.initialize())) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN_CALL(mount());
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::mount()
+{
+	RF_BEGIN();
+
+	clearIndex();
+	usedSectors = 0;
+	headSequence = 0;
+	deadSequence = 0;
+
+	// Find the newest sector and the newest compaction marker, which
+	// invalidates all sectors up to and including its sequence number.
+	for (mountSector = 0; mountSector < Sectors; mountSector++)
+	{
+		if (not RF_CALL(readSectorHeader(mountSector))) {
+			RF_RETURN(false);
+		}
+		if (not sectorValid) continue;
+
+		mountSequence = sectorHeader.sequence;
+		if (usedSectors == 0 or mountSequence > headSequence) {
+			head = mountSector;
+			headSequence = mountSequence;
+			usedSectors = 1;
+		}
+		for (mountOffset = SectorHeaderSize; RF_CALL(nextRecord(mountSector, mountOffset, mountSequence));
+			 mountOffset += recordSize(recordLength))
+		{
+			if (recordHeader.type == Type::Compacted) {
+				deadSequence = std::max(deadSequence, recordHeader.key);
+			}
+		}
+	}
+
+	if (usedSectors == 0 or headSequence <= deadSequence) {
+		RF_RETURN_CALL(format());
+	}
+
+	// The live sectors form a consecutive sequence ending at the head
+	for (tail = head; usedSectors < Sectors; usedSectors++)
+	{
+		mountSector = (tail + Sectors - 1) % Sectors;
+		if (not RF_CALL(readSectorHeader(mountSector))) {
+			RF_RETURN(false);
+		}
+		if (not sectorValid or sectorHeader.sequence != headSequence - usedSectors or
+			sectorHeader.sequence <= deadSequence) break;
+		tail = mountSector;
+	}
+
+	// Replay all records from oldest to newest to rebuild the index
+	for (mountSector = tail; ; mountSector = next(mountSector))
+	{
+		mountSequence = sequenceOf(mountSector);
+		for (mountOffset = SectorHeaderSize; RF_CALL(nextRecord(mountSector, mountOffset, mountSequence));
+			 mountOffset += recordSize(recordLength))
+		{
+			switch (recordHeader.type)
+			{
+				case Type::Value:
+					entry = &insert(recordHeader.key);
+					if (entry->address) liveBytes -= recordSize(entry->length);
+					entry->address = mountSector * SectorSize + mountOffset;
+					entry->length = recordHeader.length;
+					liveBytes += recordSize(recordLength);
+					usedBytes += recordSize(recordLength);
+					break;
+				case Type::Tombstone:
+					if ((entry = find(recordHeader.key))) erase(entry);
+					usedBytes += recordSize(recordLength);
+					break;
+				default:
+					break;
+			}
+		}
+		if (mountSector == head) break;
+	}
+
+	// continue behind the last programmed block of the head sector
+	headOffset = mountOffset;
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::format()
+{
+	RF_BEGIN();
+
+	// Block devices without erase functionality keep the old sectors valid,
+	// they are invalidated by a compaction marker instead.
+	mountSequence = 0;
+	for (mountSector = 0; mountSector < Sectors; mountSector++)
+	{
+		if (not RF_CALL(readSectorHeader(mountSector))) {
+			RF_RETURN(false);
+		}
+		if (sectorValid) {
+			mountSequence = std::max(mountSequence, sectorHeader.sequence);
+		}
+	}
+
+	clearIndex();
+	usedSectors = 0;
+	headSequence = mountSequence;
+	deadSequence = mountSequence;
+	head = Sectors - 1;
+
+	if (not RF_CALL(openSector(0))) {
+		RF_RETURN(false);
+	}
+	tail = head;
+
+	RF_END_RETURN_CALL(appendRecord(Type::Compacted, deadSequence, nullptr, 0, true));
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::get(key_t key, uint8_t* value, size_t size)
+{
+	RF_BEGIN();
+
+	if (not (entry = find(key))) {
+		RF_RETURN(false);
+	}
+
+	if (RF_CALL(readRecord(entry->address / SectorSize, entry->address % SectorSize,
+						   sequenceOf(entry->address / SectorSize))) != Scan::Valid or
+		recordHeader.key != key)
+	{
+		RF_RETURN(false);
+	}
+
+	std::memcpy(value, buffer + sizeof(RecordHeader), std::min<size_t>(size, recordHeader.length));
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::set(key_t key, const uint8_t* value, size_t size)
+{
+	RF_BEGIN();
+
+	if (size > MaxValueSize) {
+		RF_RETURN(false);
+	}
+	if ((entry = find(key))) {
+		if (liveBytes - recordSize(entry->length) + recordSize(size) > Capacity) {
+			RF_RETURN(false);
+		}
+	}
+	else if (keyCount >= MaxKeys or liveBytes + recordSize(size) > Capacity) {
+		RF_RETURN(false);
+	}
+
+	if (not RF_CALL(makeSpace(recordSize(size)))) {
+		RF_RETURN(false);
+	}
+	if (not RF_CALL(appendRecord(Type::Value, key, value, size, false))) {
+		RF_RETURN(false);
+	}
+
+	entry = &insert(key);
+	if (entry->address) liveBytes -= recordSize(entry->length);
+	entry->address = appendAddress;
+	entry->length = size;
+	liveBytes += recordSize(size);
+	usedBytes += recordSize(size);
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::remove(key_t key)
+{
+	RF_BEGIN();
+
+	if (not contains(key)) {
+		RF_RETURN(false);
+	}
+
+	if (not RF_CALL(makeSpace(MarkerSize))) {
+		RF_RETURN(false);
+	}
+	if (not RF_CALL(appendRecord(Type::Tombstone, key, nullptr, 0, false))) {
+		RF_RETURN(false);
+	}
+
+	entry = find(key);
+	liveBytes -= recordSize(entry->length);
+	usedBytes += MarkerSize;
+	erase(entry);
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::compact()
+{
+	RF_BEGIN();
+
+	// Live records must never be copied into the sector they are read from
+	if (tail == head)
+	{
+		if (freeSectors() == 0 or not RF_CALL(openSector(next(head)))) {
+			RF_RETURN(false);
+		}
+	}
+
+	compactSector = tail;
+	compactSequence = sequenceOf(tail);
+	for (compactOffset = SectorHeaderSize; RF_CALL(nextRecord(compactSector, compactOffset, compactSequence));
+		 compactOffset += recordSize(recordLength))
+	{
+		if (recordHeader.type == Type::Compacted) continue;
+
+		usedBytes -= recordSize(recordLength);
+		compactAddress = compactSector * SectorSize + compactOffset;
+		if (recordHeader.type != Type::Value or
+			not (entry = find(recordHeader.key)) or entry->address != compactAddress) continue;
+
+		// Opening a sector reuses the buffer, so the record must be read again
+		if (headOffset + recordSize(recordLength) > SectorSize)
+		{
+			if (freeSectors() == 0 or not RF_CALL(openSector(next(head)))) {
+				RF_RETURN(false);
+			}
+			if (RF_CALL(readRecord(compactSector, compactOffset, compactSequence)) != Scan::Valid) {
+				RF_RETURN(false);
+			}
+		}
+		if (not RF_CALL(appendRecord(Type::Value, recordHeader.key,
+									 buffer + sizeof(RecordHeader), recordLength, true))) {
+			RF_RETURN(false);
+		}
+		entry = find(recordHeader.key);
+		entry->address = appendAddress;
+		usedBytes += recordSize(recordLength);
+	}
+
+	// Persist that the tail sector is free now, it is erased when reopened
+	if (not RF_CALL(appendRecord(Type::Compacted, compactSequence, nullptr, 0, true))) {
+		RF_RETURN(false);
+	}
+	deadSequence = compactSequence;
+	tail = next(tail);
+	usedSectors--;
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+size_t
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::getSize(key_t key) const
+{
+	const Entry* entry = find(key);
+	return entry ? entry->length : 0;
+}
+
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+bool
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::needsCompaction() const
+{
+	// Only compact if at least half a sector can be reclaimed, otherwise the
+	// log would be rotated without gaining space, which only costs erases.
+	return freeSectors() < 2 and (usedBytes - liveBytes) >= SectorPayload / 2;
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::readSectorHeader(bd_size_t sector)
+{
+	RF_BEGIN();
+
+	if (not RF_CALL(blockDevice.read(buffer, sector * SectorSize, SectorHeaderSize))) {
+		RF_RETURN(false);
+	}
+	std::memcpy(&sectorHeader, buffer, sizeof(SectorHeader));
+	sectorValid = (sectorHeader.magic == SectorMagic) and
+			(sectorHeader.crc == computeCrc(buffer, offsetof(SectorHeader, crc)));
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<typename modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::Scan>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::readRecord(bd_size_t sector, bd_size_t offset, uint32_t sequence)
+{
+	RF_BEGIN();
+
+	if (offset + MarkerSize > SectorSize) {
+		RF_RETURN(Scan::End);
+	}
+	if (not RF_CALL(blockDevice.read(buffer, sector * SectorSize + offset, HeaderReadSize))) {
+		RF_RETURN(Scan::Corrupt);
+	}
+	if (isBlank(buffer, sizeof(RecordHeader))) {
+		RF_RETURN(Scan::End);
+	}
+
+	std::memcpy(&recordHeader, buffer, sizeof(RecordHeader));
+	recordLength = recordHeader.length;
+	if (recordHeader.check != RecordCheck or recordLength > MaxValueSize or
+		offset + recordSize(recordLength) > SectorSize) {
+		RF_RETURN(Scan::Corrupt);
+	}
+	if (recordSize(recordLength) > HeaderReadSize)
+	{
+		if (not RF_CALL(blockDevice.read(buffer + HeaderReadSize, sector * SectorSize + offset + HeaderReadSize,
+										 recordSize(recordLength) - HeaderReadSize))) {
+			RF_RETURN(Scan::Corrupt);
+		}
+	}
+
+	{
+		// The CRC is salted with the sector sequence number, so that records of
+		// a previous use of the sector are recognized on non-erasing devices.
+		const uint32_t salt = recordHeader.crc ^ computeCrc(buffer, offsetof(RecordHeader, crc)) ^
+				computeCrc(buffer + sizeof(RecordHeader), recordLength);
+		if (salt == sequence) {
+			RF_RETURN(Scan::Valid);
+		}
+		if (salt < sequence) {
+			RF_RETURN(Scan::End);
+		}
+	}
+
+	RF_END_RETURN(Scan::Corrupt);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::nextRecord(bd_size_t sector, bd_size_t& offset, uint32_t sequence)
+{
+	RF_BEGIN();
+
+	// Records are programmed sequentially, so the log ends at the first blank
+	// header. However, a power loss may leave a partially programmed record
+	// behind, in which case the rest of the sector is searched block by block
+	// for records that were appended after recovering from it.
+	scanCorrupt = false;
+	scanDirtyEnd = offset;
+	for (; offset + MarkerSize <= SectorSize; offset += BlockDevice::BlockSizeWrite)
+	{
+		scan = RF_CALL(readRecord(sector, offset, sequence));
+		if (scan == Scan::Valid) {
+			RF_RETURN(true);
+		}
+		if (scan == Scan::End and not scanCorrupt) {
+			RF_RETURN(false);
+		}
+		scanCorrupt = true;
+		if (not RF_CALL(blockDevice.read(buffer, sector * SectorSize + offset, BlockDevice::BlockSizeWrite)) or
+			not isBlank(buffer, BlockDevice::BlockSizeWrite)) {
+			scanDirtyEnd = offset + BlockDevice::BlockSizeWrite;
+		}
+	}
+	offset = scanCorrupt ? scanDirtyEnd : SectorSize;
+
+	RF_END_RETURN(false);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::openSector(bd_size_t sector)
+{
+	RF_BEGIN();
+
+	// carry over the erase count of the previous use
+	if (not RF_CALL(readSectorHeader(sector))) {
+		RF_RETURN(false);
+	}
+	sectorHeader.eraseCount = sectorValid ? sectorHeader.eraseCount + 1 : 1;
+	if (not RF_CALL(blockDevice.erase(sector * SectorSize, SectorSize))) {
+		RF_RETURN(false);
+	}
+
+	sectorHeader.magic = SectorMagic;
+	sectorHeader.sequence = headSequence + 1;
+	std::memset(buffer, 0xff, SectorHeaderSize);
+	std::memcpy(buffer, &sectorHeader, sizeof(SectorHeader));
+	sectorHeader.crc = computeCrc(buffer, offsetof(SectorHeader, crc));
+	std::memcpy(buffer, &sectorHeader, sizeof(SectorHeader));
+	if (not RF_CALL(blockDevice.program(buffer, sector * SectorSize, SectorHeaderSize))) {
+		RF_RETURN(false);
+	}
+
+	head = sector;
+	headSequence++;
+	headOffset = SectorHeaderSize;
+	usedSectors++;
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::appendRecord(
+		Type type, key_t key, const uint8_t* value, size_t size, bool compacting)
+{
+	RF_BEGIN();
+
+	// Regular writes leave room for completing a compaction in every sector
+	if (headOffset + recordSize(size) > (compacting ? SectorSize : SectorSize - CompactionReserve))
+	{
+		if (freeSectors() < (compacting ? 1u : 2u)) {
+			RF_RETURN(false);
+		}
+		if (not RF_CALL(openSector(next(head)))) {
+			RF_RETURN(false);
+		}
+	}
+
+	{
+		if (size) std::memmove(buffer + sizeof(RecordHeader), value, size);
+		std::memset(buffer + sizeof(RecordHeader) + size, 0xff, recordSize(size) - sizeof(RecordHeader) - size);
+
+		RecordHeader header{key, uint16_t(size), type, RecordCheck, 0};
+		std::memcpy(buffer, &header, sizeof(RecordHeader));
+		header.crc = computeCrc(buffer, offsetof(RecordHeader, crc)) ^
+				computeCrc(buffer + sizeof(RecordHeader), size) ^ headSequence;
+		std::memcpy(buffer, &header, sizeof(RecordHeader));
+	}
+
+	appendAddress = head * SectorSize + headOffset;
+	// a partially programmed record is skipped when the sector is scanned
+	headOffset += recordSize(size);
+	if (not RF_CALL(blockDevice.program(buffer, appendAddress, recordSize(size)))) {
+		RF_RETURN(false);
+	}
+
+	RF_END_RETURN(true);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+modm::ResumableResult<bool>
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::makeSpace(bd_size_t size)
+{
+	RF_BEGIN();
+
+	// Every compaction frees one sector, so after one round through the log
+	// all garbage has been reclaimed.
+	for (attempts = 0; not fits(size) and attempts < Sectors; attempts++)
+	{
+		if (not RF_CALL(compact())) {
+			RF_RETURN(false);
+		}
+	}
+
+	RF_END_RETURN(fits(size));
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+uint32_t
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::computeCrc(const uint8_t* data, size_t length)
+{
+	return modm::math::crc32(data, length);
+}
+
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+bool
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::isBlank(const uint8_t* data, size_t length)
+{
+	// erased NOR flash reads as 0xff, an unwritten file or RAM as zero
+	for (size_t ii = 1; ii < length; ii++) {
+		if (data[ii] != data[0]) return false;
+	}
+	return (data[0] == 0xff) or (data[0] == 0x00);
+}
+
+// ----------------------------------------------------------------------------
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+const typename modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::Entry*
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::find(key_t key) const
+{
+	// Fibonacci hashing with linear probing, the index is at most half full
+	for (size_t slot = uint32_t(key * 2654435769ul) >> IndexShift; ; slot = (slot + 1) % IndexSize)
+	{
+		if (not index[slot].address) return nullptr;
+		if (index[slot].key == key) return &index[slot];
+	}
+}
+
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+typename modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::Entry&
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::insert(key_t key)
+{
+	size_t slot = uint32_t(key * 2654435769ul) >> IndexShift;
+	for (; index[slot].address; slot = (slot + 1) % IndexSize)
+	{
+		if (index[slot].key == key) return index[slot];
+	}
+	keyCount++;
+	index[slot].key = key;
+	return index[slot];
+}
+
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+void
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::erase(Entry* entry)
+{
+	// Shift following entries back into the gap, so that no probe sequence
+	// is interrupted by an empty slot.
+	size_t gap = entry - index;
+	for (size_t slot = (gap + 1) % IndexSize; index[slot].address; slot = (slot + 1) % IndexSize)
+	{
+		const size_t home = uint32_t(index[slot].key * 2654435769ul) >> IndexShift;
+		if (((slot - home) % IndexSize) >= ((slot - gap) % IndexSize))
+		{
+			index[gap] = index[slot];
+			gap = slot;
+		}
+	}
+	index[gap].address = 0;
+	keyCount--;
+}
+
+template <class BlockDevice, size_t MaxKeys, size_t MaxValueSize, uint32_t SectorSize>
+void
+modm::KvStore<BlockDevice, MaxKeys, MaxValueSize, SectorSize>::clearIndex()
+{
+	for (Entry& entry : index) entry.address = 0;
+	keyCount = 0;
+	liveBytes = 0;
+	usedBytes = 0;
+}
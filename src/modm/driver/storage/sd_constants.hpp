@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2010, Martin Rosekeit
  * Copyright (c) 2011-2012, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -15,30 +16,98 @@
 #ifndef MODM_SD_CONSTANTS_HPP
 #define MODM_SD_CONSTANTS_HPP
 
-// Definitions for MMC/SDC command
-#define CMD0	(0x40 + 0)	// GO_IDLE_STATE
-#define CMD1	(0x40 + 1)	// SEND_OP_COND (MMC)
-#define ACMD41	(0xC0 + 41)	// SEND_OP_COND (SDC)
-#define CMD8	(0x40 + 8)	// SEND_IF_COND
-#define CMD9	(0x40 + 9)	// SEND_CSD
-#define CMD10	(0x40 + 10)	// SEND_CID
-#define CMD12	(0x40 + 12)	// STOP_TRANSMISSION
-#define ACMD13	(0xC0 + 13)	// SD_STATUS (SDC)
-#define CMD16	(0x40 + 16)	// SET_BLOCKLEN
-#define CMD17	(0x40 + 17)	// READ_SINGLE_BLOCK
-#define CMD18	(0x40 + 18)	// READ_MULTIPLE_BLOCK
-#define CMD23	(0x40 + 23)	// SET_BLOCK_COUNT (MMC)
-#define ACMD23	(0xC0 + 23)	// SET_WR_BLK_ERASE_COUNT (SDC)
-#define CMD24	(0x40 + 24)	// WRITE_BLOCK
-#define CMD25	(0x40 + 25)	// WRITE_MULTIPLE_BLOCK
-#define CMD55	(0x40 + 55)	// APP_CMD
-#define CMD58	(0x40 + 58)	// READ_OCR
-
-// Card type flags (CardType)
-#define CT_MMC		0x01		// MMC ver 3
-#define CT_SD1		0x02		// SD ver 1
-#define CT_SD2		0x04		// SD ver 2
-#define CT_SDC		(CT_SD1|CT_SD2)	// SD
-#define CT_BLOCK	0x08		// Block addressing
+#include <stdint.h>
+
+namespace modm
+{
+
+/// @ingroup modm_driver_block_device_sd_card
+namespace sd
+{
+
+/// Commands of MMC/SD cards in SPI mode, application specific commands
+/// are marked with the `App` bit and must be preceded by `AppCommand`.
+enum class
+Command : uint8_t
+{
+	GoIdleState				= 0,
+	SendOpCondition			= 1,	///< MMC only
+	SendInterfaceCondition	= 8,
+	SendCsd					= 9,
+	SendCid					= 10,
+	StopTransmission		= 12,
+	SendStatus				= 13,
+	SetBlockLength			= 16,
+	ReadSingleBlock			= 17,
+	ReadMultipleBlock		= 18,
+	SetBlockCount			= 23,	///< MMC only
+	WriteBlock				= 24,
+	WriteMultipleBlock		= 25,
+	EraseWriteBlockStart	= 32,
+	EraseWriteBlockEnd		= 33,
+	Erase					= 38,
+	AppCommand				= 55,
+	ReadOcr					= 58,
+
+	App						= 0x80,
+	AppSdStatus				= App | 13,
+	AppSetWriteBlockEraseCount = App | 23,
+	AppSendOpCondition		= App | 41,
+};
+
+/// Bits of the R1 response to every command
+enum class
+R1 : uint8_t
+{
+	Ready					= 0,
+	Idle					= 0x01,
+	EraseReset				= 0x02,
+	IllegalCommand			= 0x04,
+	CrcError				= 0x08,
+	EraseSequenceError		= 0x10,
+	AddressError			= 0x20,
+	ParameterError			= 0x40,
+	Invalid					= 0x80,
+};
+
+/// Tokens framing the data blocks
+enum class
+Token : uint8_t
+{
+	StartBlock				= 0xFE,	///< Start of a single block read or write
+	StartMultipleWrite		= 0xFC,	///< Start of a block of a multiple block write
+	StopTransmission		= 0xFD,	///< End of a multiple block write
+};
+
+/// Data response to every written block
+enum class
+DataResponse : uint8_t
+{
+	Mask					= 0x1F,
+	Accepted				= 0x05,
+	CrcError				= 0x0B,
+	WriteError				= 0x0D,
+};
+
+/// Bit in the OCR register of a card with block addressing
+constexpr uint32_t OcrCardCapacityStatus = (1ul << 30);
+/// Argument of SendInterfaceCondition with 2.7-3.6V and the check pattern
+constexpr uint32_t InterfaceCondition = 0x1AA;
+/// Size of a block in bytes, which is fixed to 512 bytes
+constexpr uint16_t BlockSize = 512;
+
+enum class
+CardType : uint8_t
+{
+	None,
+	Mmc,		///< MMC ver 3
+	SdV1,		///< SD ver 1
+	SdV2,		///< SD ver 2 with byte addressing (SDSC)
+	Sdhc,		///< SD ver 2 with block addressing (SDHC and SDXC)
+};
+
+} // namespace sd
+
+} // namespace modm
 
 #endif // MODM_SD_CONSTANTS_HPP
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_SIZE_CLASS_CACHE_HPP
+#define MODM_SIZE_CLASS_CACHE_HPP
+
+#include <stdint.h>
+#include <cstddef>
+#include <modm/architecture/interface/atomic_lock.hpp>
+
+namespace modm
+{
+
+/**
+ * Size-class cache for small allocations.
+ *
+ * Serves requests of up to `Classes * Granularity` bytes from one freelist per
+ * size class in O(1). The arena is split into pages of `PageSize` bytes, which
+ * are assigned to a size class on first use and then carved into blocks of
+ * that class. A table with one byte per page maps any pointer to its class, so
+ * freeing does not need a block header and pointers of other allocators are
+ * rejected by a single range check.
+ *
+ * Pages stay assigned to their class once used, the blocks cached in them but
+ * currently not allocated are reported as fragmentation.
+ *
+ * All operations are guarded by the `Lock` critical section, so the cache can
+ * be used from interrupts when using the default `modm::atomic::Lock`.
+ *
+ * @tparam	Classes		Number of size classes (at most 254)
+ * @tparam	Granularity	Size difference between classes in bytes, also the
+ *						alignment of all blocks
+ * @tparam	PageSize	Size of a page in bytes, must be a power of two
+ * @tparam	Lock		Critical section around all freelist operations
+ *
+ * @ingroup modm_driver_size_class_cache
+ */
+template <std::size_t Classes = 8, std::size_t Granularity = 8,
+		  std::size_t PageSize = 256, class Lock = modm::atomic::Lock>
+class SizeClassCache
+{
+	static_assert(Classes > 0 and Classes < 255, "Classes must be in [1, 254]!");
+	static_assert(Granularity >= sizeof(void*) and not (Granularity & (Granularity - 1)),
+				  "Granularity must be a power of two of at least the pointer size!");
+	static_assert(not (PageSize & (PageSize - 1)) and PageSize >= Classes * Granularity,
+				  "PageSize must be a power of two and fit the largest class!");
+
+public:
+	/// Largest size served by the cache
+	static constexpr std::size_t MaxSize = Classes * Granularity;
+
+	struct ClassStatistics
+	{
+		uint32_t allocations;	///< successful allocations
+		uint32_t misses;		///< allocations failed due to no free page
+		uint16_t used;			///< currently allocated blocks
+		uint16_t peak;			///< maximum of allocated blocks
+		uint16_t pages;			///< pages assigned to this class
+	};
+
+public:
+	/**
+	 * Initializes the cache inside the memory [begin, end).
+	 *
+	 * The page table is placed at the start of the memory.
+	 */
+	void
+	initialize(void *begin, void *end);
+
+	/// @return a block of at least `size` bytes or nullptr if the size is
+	///			too large or no block is available.
+	void *
+	allocate(std::size_t size);
+
+	/// @return false if the pointer does not belong to the cache
+	bool
+	free(void *ptr);
+
+	/// @return true if the pointer belongs to the cache
+	bool
+	contains(const void *ptr) const
+	{ return pages <= ptr and ptr < pagesEnd; }
+
+	/// @return the usable size of a block of the cache or zero
+	std::size_t
+	getSize(const void *ptr) const;
+
+	/// @return the size class for a requested size
+	static constexpr std::size_t
+	getClass(std::size_t size)
+	{ return size ? (size - 1) / Granularity : 0; }
+
+public:
+	const ClassStatistics&
+	getStatistics(std::size_t sizeClass) const
+	{ return statistics[sizeClass]; }
+
+	/// Number of pages of the arena
+	std::size_t
+	getPageCount() const
+	{ return (pagesEnd - pages) / PageSize; }
+
+	/// Number of pages not assigned to any class yet
+	std::size_t
+	getFreePageCount() const;
+
+	/// Bytes inside assigned pages, which are not allocated
+	std::size_t
+	getFragmentedSize() const;
+
+private:
+	struct Node
+	{
+		Node *next;
+	};
+
+	struct SizeClass
+	{
+		Node *freelist;
+		uint8_t *bump;
+		uint8_t *bumpEnd;
+	};
+
+	uint8_t *pageClass{nullptr};
+	uint8_t *pages{nullptr};
+	uint8_t *pagesEnd{nullptr};
+	uint8_t *nextPage{nullptr};
+	SizeClass classes[Classes]{};
+	ClassStatistics statistics[Classes]{};
+};
+
+} // namespace modm
+
+#include "size_class_cache_impl.hpp"
+
+#endif // MODM_SIZE_CLASS_CACHE_HPP
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_SIZE_CLASS_CACHE_HPP
+	#error	"Don't include this file directly, use 'size_class_cache.hpp' instead!"
+#endif
+
+// ----------------------------------------------------------------------------
+template <std::size_t Classes, std::size_t Granularity, std::size_t PageSize, class Lock>
+void
+modm::SizeClassCache<Classes, Granularity, PageSize, Lock>::initialize(void *begin, void *end)
+{
+	const uintptr_t first = uintptr_t(begin);
+	const uintptr_t last = uintptr_t(end);
+	auto align = [](uintptr_t address) { return (address + Granularity - 1) & ~uintptr_t(Granularity - 1); };
+
+	// one byte of page table per page, followed by the aligned pages
+	std::size_t count = (last > first) ? (last - first) / (PageSize + 1) : 0;
+	while (count and align(first + count) + count * PageSize > last) count--;
+
+	pageClass = reinterpret_cast<uint8_t *>(first);
+	pages = reinterpret_cast<uint8_t *>(count ? align(first + count) : first);
+	pagesEnd = pages + count * PageSize;
+	nextPage = pages;
+	for (std::size_t ii = 0; ii < count; ii++) pageClass[ii] = 0;
+	for (std::size_t ii = 0; ii < Classes; ii++) {
+		classes[ii] = {};
+		statistics[ii] = {};
+	}
+}
+
+// ----------------------------------------------------------------------------
+template <std::size_t Classes, std::size_t Granularity, std::size_t PageSize, class Lock>
+void *
+modm::SizeClassCache<Classes, Granularity, PageSize, Lock>::allocate(std::size_t size)
+{
+	if (size > MaxSize) return nullptr;
+	const std::size_t index = getClass(size);
+	const std::size_t blockSize = (index + 1) * Granularity;
+	SizeClass &sizeClass = classes[index];
+	ClassStatistics &stats = statistics[index];
+	void *ptr;
+
+	Lock lock;
+	if (Node *node = sizeClass.freelist) {
+		sizeClass.freelist = node->next;
+		ptr = node;
+	}
+	else
+	{
+		// carve the blocks lazily out of the current page of this class
+		if (std::size_t(sizeClass.bumpEnd - sizeClass.bump) < blockSize)
+		{
+			if (nextPage == pagesEnd) {
+				stats.misses++;
+				return nullptr;
+			}
+			pageClass[(nextPage - pages) / PageSize] = index + 1;
+			sizeClass.bump = nextPage;
+			sizeClass.bumpEnd = nextPage + PageSize;
+			nextPage += PageSize;
+			stats.pages++;
+		}
+		ptr = sizeClass.bump;
+		sizeClass.bump += blockSize;
+	}
+	stats.allocations++;
+	if (++stats.used > stats.peak) stats.peak = stats.used;
+	return ptr;
+}
+
+template <std::size_t Classes, std::size_t Granularity, std::size_t PageSize, class Lock>
+bool
+modm::SizeClassCache<Classes, Granularity, PageSize, Lock>::free(void *ptr)
+{
+	if (not contains(ptr)) return false;
+	const std::size_t index = pageClass[(static_cast<uint8_t *>(ptr) - pages) / PageSize] - 1;
+	Node *node = static_cast<Node *>(ptr);
+
+	Lock lock;
+	node->next = classes[index].freelist;
+	classes[index].freelist = node;
+	statistics[index].used--;
+	return true;
+}
+
+template <std::size_t Classes, std::size_t Granularity, std::size_t PageSize, class Lock>
+std::size_t
+modm::SizeClassCache<Classes, Granularity, PageSize, Lock>::getSize(const void *ptr) const
+{
+	if (not contains(ptr)) return 0;
+	return pageClass[(static_cast<const uint8_t *>(ptr) - pages) / PageSize] * Granularity;
+}
+
+// ----------------------------------------------------------------------------
+template <std::size_t Classes, std::size_t Granularity, std::size_t PageSize, class Lock>
+std::size_t
+modm::SizeClassCache<Classes, Granularity, PageSize, Lock>::getFreePageCount() const
+{
+	Lock lock;
+	return (pagesEnd - nextPage) / PageSize;
+}
+
+template <std::size_t Classes, std::size_t Granularity, std::size_t PageSize, class Lock>
+std::size_t
+modm::SizeClassCache<Classes, Granularity, PageSize, Lock>::getFragmentedSize() const
+{
+	std::size_t size{0};
+	Lock lock;
+	for (std::size_t ii = 0; ii < Classes; ii++) {
+		size += statistics[ii].pages * PageSize - statistics[ii].used * (ii + 1) * Granularity;
+	}
+	return size;
+}
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2019-2020, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -22,6 +23,8 @@ namespace modm::math
 /// @ingroup modm_math_utils
 /// @{
 
+/// @note The software implementation does not compute the same checksum as
+///       `_crc8_ccitt_update()` of avr-libc, which is used on AVR instead.
 inline uint8_t
 crc8_ccitt_update(uint8_t crc, uint8_t data)
 {
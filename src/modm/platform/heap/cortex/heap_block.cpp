@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2016, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -16,6 +17,7 @@
 #include <errno.h>
 #include <modm/architecture/interface/assert.hpp>
 #include <modm/platform/core/heap_table.hpp>
+#include <modm/platform/heap/heap_statistics.hpp>
 
 // ----------------------------------------------------------------------------
 // Using the MODM Block Allocator
@@ -34,6 +36,15 @@ static modm::BlockAllocator< MODM_MEMORY_BLOCK_ALLOCATOR_TYPE, MODM_MEMORY_BLOCK
 // this allocator has a maximum heap size!
 const size_t max_heap_size = (1 << (sizeof(MODM_MEMORY_BLOCK_ALLOCATOR_TYPE) * 8)) *
 							  MODM_MEMORY_BLOCK_ALLOCATOR_CHUNK_SIZE;
+static size_t heap_size{0};
+static size_t heap_used{0};
+static size_t heap_peak{0};
+
+#ifdef MODM_HEAP_CACHE_SIZE
+#include <modm/driver/storage/size_class_cache.hpp>
+
+static modm::platform::HeapCache cache;
+#endif
 
 extern "C"
 {
@@ -50,6 +61,15 @@ void __modm_initialize_memory(void)
 	}
 	// initialize the heap
 	allocator.initialize((void*)heap_start, (void*)heap_end);
+	heap_size = allocator.getAvailableSize();
+
+#ifdef MODM_HEAP_CACHE_SIZE
+	if (uint8_t *arena = (uint8_t *) allocator.allocate(MODM_HEAP_CACHE_SIZE); arena)
+	{
+		heap_used = heap_peak = allocator.getSize(arena);
+		cache.initialize(arena, arena + MODM_HEAP_CACHE_SIZE);
+	}
+#endif
 }
 
 extern void __malloc_lock(struct _reent *);
@@ -57,8 +77,17 @@ extern void __malloc_unlock(struct _reent *);
 
 void* __wrap__malloc_r(struct _reent *r, size_t size)
 {
+#ifdef MODM_HEAP_CACHE_SIZE
+	// small blocks are served by the cache first
+	if (void *ptr = cache.allocate(size); ptr) return ptr;
+#endif
 	__malloc_lock(r);
 	void *ptr = allocator.allocate(size);
+	if (ptr)
+	{
+		heap_used += allocator.getSize(ptr);
+		if (heap_used > heap_peak) heap_peak = heap_used;
+	}
 	__malloc_unlock(r);
 	modm_assert_continue_fail_debug(ptr, "malloc",
 			"No memory left in Block heap!", size);
@@ -82,9 +111,34 @@ void* __wrap__realloc_r(struct _reent *r, void *p, size_t size)
 
 void __wrap__free_r(struct _reent *r, void *p)
 {
+	if (!p) return;
+#ifdef MODM_HEAP_CACHE_SIZE
+	if (cache.free(p)) return;
+#endif
 	__malloc_lock(r);
+	heap_used -= allocator.getSize(p);
 	allocator.free(p);
 	__malloc_unlock(r);
 }
 
 } // extern "C"
+
+// ----------------------------------------------------------------------------
+bool
+modm::platform::getHeapUsage(std::size_t index, HeapUsage &usage)
+{
+	if (index) return false;
+	__malloc_lock(_REENT);
+	usage = {MemoryDefault, heap_size, heap_used, heap_peak,
+			 allocator.getAvailableSize(), allocator.getLargestAvailableSize()};
+	__malloc_unlock(_REENT);
+	return true;
+}
+
+#ifdef MODM_HEAP_CACHE_SIZE
+const modm::platform::HeapCache&
+modm::platform::getHeapCache()
+{
+	return cache;
+}
+#endif
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2016-2017, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -17,6 +18,7 @@
 #include <modm/architecture/interface/assert.h>
 #include <modm/architecture/interface/memory.hpp>
 #include <modm/platform/core/heap_table.hpp>
+#include <modm/platform/heap/heap_statistics.hpp>
 
 // ----------------------------------------------------------------------------
 #include <tlsf/tlsf.h>
@@ -25,18 +27,52 @@
 #define MODM_TLSF_MAX_MEM_POOL_COUNT 6
 #endif
 
+static_assert(MODM_TLSF_MAX_MEM_POOL_COUNT <= 8, "Pool slots are limited to 8 pools!");
+
 typedef struct
 {
 	uint16_t traits;
 	tlsf_t tlsf;
 	const uint8_t* end;
+	size_t used;
+	size_t peak;
 } mem_pool_t;
 
 static mem_pool_t mem_pools[MODM_TLSF_MAX_MEM_POOL_COUNT];
+// bitmask of the pools located in each 16MiB address range
+static uint8_t pool_slots[256];
+
+// default is accessible by S-Bus and DMA-able
+static constexpr uint32_t default_traits = uint32_t(modm::MemoryTrait::AccessSBus) |
+										   uint32_t(modm::MemoryTrait::AccessDMA);
+
+#ifdef MODM_HEAP_CACHE_SIZE
+#include <modm/driver/storage/size_class_cache.hpp>
+
+static modm::platform::HeapCache cache;
+// no traits are satisfied until the cache is initialized
+static uint32_t cache_traits{0};
+#endif
+
+static inline void
+account_allocation(mem_pool_t *pool, size_t size)
+{
+	pool->used += size + tlsf_alloc_overhead();
+	if (pool->used > pool->peak) pool->peak = pool->used;
+}
+
+static inline void
+account_free(mem_pool_t *pool, size_t size)
+{
+	pool->used -= size + tlsf_alloc_overhead();
+}
 
 extern "C"
 {
 
+void * malloc_traits(size_t size, uint32_t traits);
+static mem_pool_t * get_pool_for_ptr(void *p);
+
 void
 __modm_initialize_memory(void)
 {
@@ -68,19 +104,38 @@ __modm_initialize_memory(void)
 			(current_pool - 1)->end = tend;
 		}
 	}
+
+	// mark all address ranges covered by each pool
+	for (mem_pool_t *pool = mem_pools; pool < current_pool; pool++)
+	{
+		for (uintptr_t slot = uintptr_t(pool->tlsf) >> 24;
+			 slot <= (uintptr_t(pool->end) - 1) >> 24; slot++)
+		{
+			pool_slots[slot & 0xff] |= 1u << (pool - mem_pools);
+		}
+	}
+
+#ifdef MODM_HEAP_CACHE_SIZE
+	if (uint8_t *arena = (uint8_t *) malloc_traits(MODM_HEAP_CACHE_SIZE, default_traits); arena)
+	{
+		cache.initialize(arena, arena + MODM_HEAP_CACHE_SIZE);
+		cache_traits = get_pool_for_ptr(arena)->traits;
+	}
+#endif
 }
 
-static tlsf_t
-get_tlsf_for_ptr(void *p)
+static mem_pool_t *
+get_pool_for_ptr(void *p)
 {
-	for (mem_pool_t *pool = mem_pools;
-		 pool < (mem_pools + MODM_TLSF_MAX_MEM_POOL_COUNT);
-		 pool++)
+	// only pools in the same address range of the pointer are candidates,
+	// which is usually just a single one
+	for (uint8_t slots = pool_slots[(uintptr_t(p) >> 24) & 0xff]; slots; slots &= slots - 1)
 	{
+		mem_pool_t *pool = mem_pools + __builtin_ctz(slots);
 		if ((pool->tlsf < p) && (p < (void *) pool->end))
 		{
 			// pointer is within this pool
-			return pool->tlsf;
+			return pool;
 		}
 	}
 	modm_assert_continue_fail_debug(0, "tlsf.pool",
@@ -93,6 +148,13 @@ extern void __malloc_unlock(struct _reent *);
 
 void * malloc_traits(size_t size, uint32_t traits)
 {
+#ifdef MODM_HEAP_CACHE_SIZE
+	// small blocks are served by the cache if it satisfies the traits
+	if ((cache_traits & traits) == traits)
+	{
+		if (void *p = cache.allocate(size); p) return p;
+	}
+#endif
 try_again:
 	for (mem_pool_t *pool = mem_pools;
 		 pool < (mem_pools + MODM_TLSF_MAX_MEM_POOL_COUNT);
@@ -102,6 +164,7 @@ try_again:
 		{
 			__malloc_lock(_REENT);
 			void *p = tlsf_malloc(pool->tlsf, size);
+			if (p) account_allocation(pool, tlsf_block_size(p));
 			__malloc_unlock(_REENT);
 			if (p) return p;
 		}
@@ -128,9 +191,7 @@ try_again:
 
 void *__wrap__malloc_r(struct _reent *, size_t size)
 {
-	// default is accessible by S-Bus and DMA-able
-	return malloc_traits(size, uint32_t(modm::MemoryTrait::AccessSBus) |
-							   uint32_t(modm::MemoryTrait::AccessDMA));
+	return malloc_traits(size, default_traits);
 }
 
 void *__wrap__calloc_r(struct _reent *r, size_t size)
@@ -144,11 +205,32 @@ void *__wrap__realloc_r(struct _reent *r, void *p, size_t size)
 {
 	if (!p) return __wrap__malloc_r(r, size);
 
+#ifdef MODM_HEAP_CACHE_SIZE
+	if (cache.contains(p))
+	{
+		const size_t block_size = cache.getSize(p);
+		if (size <= block_size) return p;
+		void *ptr = __wrap__malloc_r(r, size);
+		if (ptr) {
+			memcpy(ptr, p, block_size);
+			cache.free(p);
+		}
+		return ptr;
+	}
+#endif
+
 	void *ptr = NULL;
 
 	__malloc_lock(r);
-	const tlsf_t pool = get_tlsf_for_ptr(p);
-	if (pool) ptr = tlsf_realloc(pool, p, size);
+	mem_pool_t *const pool = get_pool_for_ptr(p);
+	if (pool)
+	{
+		const size_t block_size = tlsf_block_size(p);
+		ptr = tlsf_realloc(pool->tlsf, p, size);
+		// a zero size frees the block, otherwise it is kept on failure
+		if (ptr or !size) account_free(pool, block_size);
+		if (ptr) account_allocation(pool, tlsf_block_size(ptr));
+	}
 	__malloc_unlock(r);
 
 	modm_assert_continue_fail_debug(ptr, "realloc",
@@ -160,11 +242,57 @@ void __wrap__free_r(struct _reent *r, void *p)
 {
 	// do nothing if NULL pointer
 	if (!p) return;
+#ifdef MODM_HEAP_CACHE_SIZE
+	if (cache.free(p)) return;
+#endif
 	__malloc_lock(r);
-	const tlsf_t pool = get_tlsf_for_ptr(p);
+	mem_pool_t *const pool = get_pool_for_ptr(p);
 	// free if pointer belongs to a pool.
-	if (pool) tlsf_free(pool, p);
+	if (pool)
+	{
+		account_free(pool, tlsf_block_size(p));
+		tlsf_free(pool->tlsf, p);
+	}
 	__malloc_unlock(r);
 }
 
 } // extern "C"
+
+// ----------------------------------------------------------------------------
+static void
+usage_walker(void *, size_t size, int used, void *user)
+{
+	if (used) return;
+	modm::platform::HeapUsage *usage = (modm::platform::HeapUsage *) user;
+	usage->free += size;
+	if (size > usage->largest) usage->largest = size;
+}
+
+bool
+modm::platform::getHeapUsage(std::size_t index, HeapUsage &usage)
+{
+	if (index >= MODM_TLSF_MAX_MEM_POOL_COUNT or !mem_pools[index].tlsf) return false;
+	const mem_pool_t *const pool = mem_pools + index;
+	const uint8_t *const start = (const uint8_t *) pool->tlsf;
+
+	__malloc_lock(_REENT);
+	usage = {MemoryTraits(pool->traits), 0, pool->used, pool->peak, 0, 0};
+	// walk all regions that were added to this pool
+	for (const auto [ttraits, tstart, tend, tsize] : HeapTable())
+	{
+		if (tstart < start or tstart >= pool->end) continue;
+		usage.size += tsize;
+		tlsf_walk_pool((tstart == start) ? tlsf_get_pool(pool->tlsf) : (pool_t) tstart,
+					   usage_walker, &usage);
+	}
+	__malloc_unlock(_REENT);
+	return true;
+}
+
+#ifdef MODM_HEAP_CACHE_SIZE
+const modm::platform::HeapCache&
+modm::platform::getHeapCache()
+{
+	return cache;
+}
+#endif
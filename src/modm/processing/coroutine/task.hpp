@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <modm/architecture/interface/assert.hpp>
+#include <modm/architecture/interface/fiber.hpp>
+#include <modm/processing/resumable.hpp>
+#include <modm/utils/pool_allocator.hpp>
+
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace modm
+{
+
+template< typename T = void >
+class task;
+
+namespace coroutine
+{
+
+/// Static pool of all coroutine frames, sized by the module options.
+/// @ingroup modm_processing_coroutine
+PoolAllocator&
+framePool();
+
+/// @cond
+namespace detail
+{
+
+struct promise_base
+{
+	static void *
+	operator new(std::size_t size) noexcept;
+
+	static void
+	operator delete(void *ptr, std::size_t size) noexcept;
+
+	std::suspend_always
+	initial_suspend() noexcept
+	{ return {}; }
+
+	void
+	unhandled_exception()
+	{ modm_assert(false, "coro.exc", "Unhandled exception in coroutine!"); }
+
+	// awaiting task, or the noop coroutine for the outermost task
+	std::coroutine_handle<> continuation{std::noop_coroutine()};
+	// promise of the outermost task, which owns the following members
+	promise_base *root{this};
+	// innermost suspended frame, which is resumed directly
+	std::coroutine_handle<> leaf;
+	// the leaf is only resumed once this condition is true
+	bool (*blocker)(void *){nullptr};
+	void *context{nullptr};
+};
+
+struct final_awaiter
+{
+	bool
+	await_ready() noexcept
+	{ return false; }
+
+	template< class Promise >
+	std::coroutine_handle<>
+	await_suspend(std::coroutine_handle<Promise> handle) noexcept
+	{
+		promise_base &promise = handle.promise();
+		promise.root->leaf = promise.continuation;
+		return promise.continuation;
+	}
+
+	void
+	await_resume() noexcept {}
+};
+
+template< typename T >
+struct promise : promise_base
+{
+	task<T>
+	get_return_object() noexcept;
+
+	static task<T>
+	get_return_object_on_allocation_failure() noexcept
+	{ return {}; }
+
+	final_awaiter
+	final_suspend() noexcept
+	{ return {}; }
+
+	template< typename U >
+	void
+	return_value(U &&result)
+	{ value.emplace(std::forward<U>(result)); }
+
+	std::optional<T> value;
+};
+
+template<>
+struct promise<void> : promise_base
+{
+	task<void>
+	get_return_object() noexcept;
+
+	static task<void>
+	get_return_object_on_allocation_failure() noexcept;
+
+	final_awaiter
+	final_suspend() noexcept
+	{ return {}; }
+
+	void
+	return_void() noexcept {}
+};
+
+template< class Awaiter >
+bool
+check(void *awaiter)
+{ return static_cast<Awaiter *>(awaiter)->poll(); }
+
+template< class Awaiter, class Promise >
+void
+block(std::coroutine_handle<Promise> handle, Awaiter *awaiter)
+{
+	promise_base *root = handle.promise().root;
+	root->blocker = check<Awaiter>;
+	root->context = awaiter;
+}
+
+template< class Function >
+struct condition_awaiter
+{
+	Function condition;
+
+	bool
+	poll()
+	{ return condition(); }
+
+	bool
+	await_ready()
+	{ return poll(); }
+
+	template< class Promise >
+	void
+	await_suspend(std::coroutine_handle<Promise> handle)
+	{ block(handle, this); }
+
+	void
+	await_resume() noexcept {}
+};
+
+#ifdef MODM_RESUMABLE_IS_FIBER
+template< class Function >
+struct resumable_awaiter
+{
+	Function function;
+
+	bool
+	await_ready() noexcept
+	{ return true; }
+
+	void
+	await_suspend(std::coroutine_handle<>) noexcept {}
+
+	decltype(auto)
+	await_resume()
+	{ return function(); }
+};
+#else
+template< class Function >
+struct resumable_awaiter
+{
+	Function function;
+	std::invoke_result_t<Function&> result{rf::Running};
+
+	bool
+	poll()
+	{
+		result = function();
+		return result.getState() <= rf::NestingError;
+	}
+
+	bool
+	await_ready()
+	{ return poll(); }
+
+	template< class Promise >
+	void
+	await_suspend(std::coroutine_handle<Promise> handle)
+	{ block(handle, this); }
+
+	auto
+	await_resume()
+	{ return result.getResult(); }
+};
+#endif
+
+template< typename T >
+struct task_awaiter
+{
+	std::coroutine_handle<promise<T>> handle;
+
+	bool
+	await_ready() noexcept
+	{ return not handle; }
+
+	template< class Promise >
+	std::coroutine_handle<>
+	await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
+	{
+		promise_base &promise = handle.promise();
+		promise.continuation = awaiting;
+		promise.root = awaiting.promise().root;
+		promise.root->leaf = handle;
+		return handle;
+	}
+
+	T
+	await_resume()
+	{
+		if constexpr (not std::is_void_v<T>)
+			return std::move(*handle.promise().value);
+	}
+};
+
+} // namespace detail
+/// @endcond
+
+/// @ingroup modm_processing_coroutine
+/// @{
+
+/// Suspends the coroutine until the next time the task is resumed.
+inline std::suspend_always
+yield() noexcept
+{ return {}; }
+
+/**
+ * Suspends the coroutine until `bool condition()` returns true.
+ *
+ * While the condition is false, resuming the task only calls the condition
+ * without entering any coroutine frame.
+ *
+ * @warning If `bool condition()` is true on first call, no suspension is performed!
+ */
+template< class Function >
+auto
+wait_until(Function &&condition)
+{
+	return detail::condition_awaiter<std::decay_t<Function>>{std::forward<Function>(condition)};
+}
+
+/**
+ * Calls a resumable function until it finished and returns its result.
+ *
+ * With the protothread and resumable function macros, the function is polled
+ * each time the task is resumed, without entering any coroutine frame.
+ * With the fiber implementation of resumable functions, the function is
+ * called once and yields the current fiber itself.
+ *
+ * ```cpp
+ * modm::task<bool>
+ * Sensor::readData()
+ * {
+ *     const bool success = co_await modm::coroutine::resumable([&]{ return driver.readData(); });
+ *     co_return success;
+ * }
+ * ```
+ */
+template< class Function >
+auto
+resumable(Function &&function)
+{
+	return detail::resumable_awaiter<std::decay_t<Function>>{std::forward<Function>(function)};
+}
+
+/// @}
+
+} // namespace coroutine
+
+/**
+ * Lazily started coroutine returning a value of type `T`.
+ *
+ * The coroutine frames are allocated from a static pool without using the
+ * heap. Awaiting a task from within another task runs it to completion with
+ * the awaiting coroutine suspended, so that resuming the outermost task jumps
+ * directly into the innermost suspended frame.
+ *
+ * The outermost task must be resumed until it is done, either from a loop, a
+ * protothread or a fiber:
+ *
+ * ```cpp
+ * modm::task<uint8_t> read();
+ *
+ * auto reading = read();
+ * // non-blocking polling
+ * while (reading.resume()) doSomethingElse();
+ * // or yield the current fiber until done
+ * const uint8_t value = reading.wait();
+ * ```
+ *
+ * @ingroup modm_processing_coroutine
+ */
+template< typename T >
+class [[nodiscard]] task
+{
+public:
+	using promise_type = coroutine::detail::promise<T>;
+	using handle_type = std::coroutine_handle<promise_type>;
+
+	task() = default;
+
+	explicit
+	task(handle_type handle) noexcept : handle(handle)
+	{ handle.promise().leaf = handle; }
+
+	task(task &&other) noexcept :
+		handle(std::exchange(other.handle, nullptr))
+	{}
+
+	task&
+	operator = (task &&other) noexcept
+	{
+		if (this != &other)
+		{
+			if (handle) handle.destroy();
+			handle = std::exchange(other.handle, nullptr);
+		}
+		return *this;
+	}
+
+	~task()
+	{
+		if (handle) handle.destroy();
+	}
+
+	/// @return `true` if the task finished or has no coroutine frame
+	bool
+	done() const
+	{ return not handle or handle.done(); }
+
+	/**
+	 * Resumes the innermost suspended coroutine of this task once.
+	 *
+	 * @warning Only resume the outermost task, never a task that is awaited!
+	 * @return `true` if the task is still running, `false` if it finished.
+	 */
+	bool
+	resume()
+	{
+		if (done()) return false;
+		coroutine::detail::promise_base &root = handle.promise();
+		if (root.blocker)
+		{
+			if (not root.blocker(root.context)) return true;
+			root.blocker = nullptr;
+		}
+		root.leaf.resume();
+		return not handle.done();
+	}
+
+	/// Resumes the task until done and yields the current fiber in between.
+	T
+	wait()
+	{
+		while (resume()) modm::this_fiber::yield();
+		return result();
+	}
+
+	/// @return the result of a finished task
+	T
+	result()
+	{
+		if constexpr (not std::is_void_v<T>)
+			return std::move(*handle.promise().value);
+	}
+
+	coroutine::detail::task_awaiter<T>
+	operator co_await() && noexcept
+	{ return {handle}; }
+
+private:
+	handle_type handle;
+};
+
+/// @cond
+template< typename T >
+task<T>
+coroutine::detail::promise<T>::get_return_object() noexcept
+{ return task<T>{task<T>::handle_type::from_promise(*this)}; }
+
+inline task<void>
+coroutine::detail::promise<void>::get_return_object() noexcept
+{ return task<void>{task<void>::handle_type::from_promise(*this)}; }
+
+inline task<void>
+coroutine::detail::promise<void>::get_return_object_on_allocation_failure() noexcept
+{ return {}; }
+/// @endcond
+
+} // namespace modm
@@ -2,6 +2,7 @@
  * Copyright (c) 2011, 2018, Fabian Greif
  * Copyright (c) 2012, 2014-2015, 2018, Niklas Hauser
  * Copyright (c) 2017, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -15,6 +16,7 @@
 #define MODM_PT_MACROS_HPP
 
 #include <modm/architecture/utils.hpp>
+#include "wait.hpp"
 
 /// @ingroup modm_processing_protothread
 /// @{
@@ -46,13 +48,25 @@
 #define PT_YIELD() \
     do { \
 		this->ptState = __LINE__; \
-		return true; \
+		return modm::pt::poll(); \
 		case __LINE__: ; \
 	} while (0)
 
 /// Cause protothread to wait **while** given condition is true.
 /// \hideinitializer
 #define PT_WAIT_WHILE(...) \
+    do { \
+		this->ptState = __LINE__; \
+		modm_fallthrough; \
+		case __LINE__: \
+			if (__VA_ARGS__) \
+				return modm::pt::poll(); \
+    } while (0)
+
+/// @cond
+/// Waits while the condition is true without polling, so that the wake-up
+/// sources added by the condition decide when the protothread runs again.
+#define PT_WAIT_WHILE_PARKED(...) \
     do { \
 		this->ptState = __LINE__; \
 		modm_fallthrough; \
@@ -60,15 +74,38 @@
 			if (__VA_ARGS__) \
 				return true; \
     } while (0)
+/// @endcond
 
 /// Cause protothread to wait **until** given condition is true.
 /// \hideinitializer
 #define PT_WAIT_UNTIL(...) \
 	PT_WAIT_WHILE(!(__VA_ARGS__))
 
+/**
+ * Cause protothread to wait until one of the given wake-up sources is ready.
+ *
+ * The sources may be a `modm::GenericTimeout`, which is ready once expired,
+ * a `bool` flag, which is ready once true, or a `modm::pt::Semaphore`, which
+ * is ready once acquired. A `modm::pt::Scheduler` does not run the protothread
+ * until one of the sources is ready.
+ *
+ * Only this macro and `PT_WAIT_THREAD()` park the protothread. Any other wait,
+ * for example `PT_WAIT_UNTIL(!child.run() or flag)`, is polled on every pass,
+ * even if the child protothread waits with `PT_WAIT_FOR()`.
+ *
+ * \code
+ * PT_WAIT_FOR(timeout);
+ * PT_WAIT_FOR(dataReady, timeout);
+ * \endcode
+ * \hideinitializer
+ */
+#define PT_WAIT_FOR(...) \
+	PT_WAIT_WHILE_PARKED(modm::pt::parked(__VA_ARGS__))
+
 /// Cause protothread to wait until given child protothread completes.
+/// The protothread is parked on the wake-up sources of the child.
 /// \hideinitializer
-#define PT_WAIT_THREAD(...) 	PT_WAIT_UNTIL(!(__VA_ARGS__).run())
+#define PT_WAIT_THREAD(...) 	PT_WAIT_WHILE_PARKED((__VA_ARGS__).run())
 
 /// Restart and spawn given child protothread and wait until it completes.
 /// \hideinitializer
@@ -91,7 +128,7 @@
 		case __LINE__: \
 			auto rfResult = (__VA_ARGS__); \
 			if (rfResult.getState() > modm::rf::NestingError) { \
-				return true; \
+				return modm::pt::poll(); \
 			} \
 			rfResult.getResult(); \
 	})
@@ -106,7 +143,7 @@
 #define PT_RESTART() \
 	do { \
 		this->restart(); \
-		return true; \
+		return modm::pt::poll(); \
 	} while (0)
 
 /// Stop and exit from protothread.
@@ -2,6 +2,7 @@
  * Copyright (c) 2011, 2018, Fabian Greif
  * Copyright (c) 2012, 2014-2015, 2018, 2023, Niklas Hauser
  * Copyright (c) 2017, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -15,6 +16,7 @@
 #define MODM_PT_MACROS_FIBERS_HPP
 
 #include <modm/architecture/utils.hpp>
+#include "wait.hpp"
 #include <modm/processing/fiber.hpp>
 
 /// @ingroup modm_processing_protothread
@@ -52,6 +54,11 @@
 #define PT_WAIT_UNTIL(...) \
 	PT_WAIT_WHILE(!(__VA_ARGS__))
 
+/// Cause protothread to wait until one of the given wake-up sources is ready.
+/// \hideinitializer
+#define PT_WAIT_FOR(...) \
+	PT_WAIT_WHILE(modm::pt::parked(__VA_ARGS__))
+
 /// Cause protothread to wait until given child protothread completes.
 /// \hideinitializer
 #define PT_WAIT_THREAD(...) \
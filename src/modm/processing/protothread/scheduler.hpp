@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_PT_SCHEDULER_HPP
+#define MODM_PT_SCHEDULER_HPP
+
+#include <stddef.h>
+#include <optional>
+#include <modm/architecture/interface/assert.hpp>
+#include "protothread.hpp"
+#include "semaphore.hpp"
+#include "wait.hpp"
+
+namespace modm
+{
+	namespace pt
+	{
+		/**
+		 * \brief	Runs only the protothreads that are ready
+		 *
+		 * Protothreads that wait with `PT_WAIT_FOR()` are parked until one
+		 * of their wake-up sources is ready, so their run() function is not
+		 * called while they wait. All other protothreads are run on every
+		 * call to run(), just like in a super-loop.
+		 *
+		 * Since the scheduler knows what every protothread waits for, it
+		 * reports the next wake-up deadline, until which the core may sleep:
+		 *
+		 * \code
+		 * modm::pt::Scheduler<2> scheduler;
+		 * scheduler.add(blinker);
+		 * scheduler.add(receiver);
+		 *
+		 * while (true)
+		 * {
+		 *     scheduler.run();
+		 *     // sleep until the next deadline or any interrupt
+		 *     if (auto wakeup = scheduler.nextWakeup()) armWakeUpTimer(*wakeup);
+		 *     __WFI();
+		 * }
+		 * \endcode
+		 *
+		 * \tparam	Threads		Maximum number of protothreads
+		 *
+		 * \ingroup	modm_processing_protothread
+		 */
+		template< size_t Threads >
+		class Scheduler
+		{
+		public:
+			/// Adds a protothread, which must outlive the scheduler.
+			template< class Thread >
+			void
+			add(Thread &thread)
+			{
+				if (not modm_assert_continue_ignore(count < Threads, "pt.sched",
+						"Scheduler has no space for the protothread!", Threads))
+					return;
+
+				entries[count++] = {&thread,
+					[](Protothread *thread) { return static_cast<Thread *>(thread)->run(); },
+					{}};
+			}
+
+			/**
+			 * \brief	Runs every ready protothread once
+			 *
+			 * \return	\c true if any protothread is still running.
+			 */
+			bool
+			run()
+			{
+				const auto now = modm::Clock::now();
+				bool running = false;
+				for (size_t ii = 0; ii < count; ii++)
+				{
+					Entry &entry = entries[ii];
+					if (not entry.thread->isRunning()) continue;
+					if (entry.wakeup.isReady(now))
+					{
+						entry.wakeup = {};
+						detail::parking = &entry.wakeup;
+						entry.run(entry.thread);
+						detail::parking = nullptr;
+					}
+					running |= entry.thread->isRunning();
+				}
+				return running;
+			}
+
+			/**
+			 * \brief	Time at which a parked protothread must run next
+			 *
+			 * \return	the current time if any protothread is ready,
+			 * 			the earliest deadline of all parked protothreads, or
+			 * 			`std::nullopt` if only an interrupt can wake any
+			 * 			protothread.
+			 */
+			std::optional<modm::Clock::time_point>
+			nextWakeup() const
+			{
+				const auto now = modm::Clock::now();
+				std::optional<modm::Clock::time_point> next;
+				for (size_t ii = 0; ii < count; ii++)
+				{
+					const Entry &entry = entries[ii];
+					if (not entry.thread->isRunning()) continue;
+					if (entry.wakeup.isReady(now)) return now;
+					if (entry.wakeup.timed and (not next or
+						int32_t((entry.wakeup.deadline - *next).count()) < 0))
+					{
+						next = entry.wakeup.deadline;
+					}
+				}
+				return next;
+			}
+
+		private:
+			struct Entry
+			{
+				Protothread *thread;
+				bool (*run)(Protothread *);
+				WakeUp wakeup;
+			};
+
+			Entry entries[Threads];
+			size_t count{0};
+		};
+	}
+}
+
+#endif // MODM_PT_SCHEDULER_HPP
@@ -2,6 +2,7 @@
  * Copyright (c) 2011, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2012, Sascha Schade
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -113,9 +114,29 @@ namespace modm
 				this->count++;
 			}
 
+			/// \return	\c true if acquire() would succeed
+			bool
+			isAvailable() const
+			{
+				return (this->count > 0);
+			}
+
 		protected:
 			uint16_t count;
 		};
+
+		/// @cond
+		/// Wake-up source of `PT_WAIT_FOR()`, which is ready once acquired
+		inline bool
+		park(Semaphore &semaphore)
+		{
+			if (semaphore.acquire()) return false;
+			detail::watch(&semaphore, [](const volatile void *semaphore)
+					{ return static_cast<const Semaphore *>(
+							const_cast<const void *>(semaphore))->isAvailable(); });
+			return true;
+		}
+		/// @endcond
 	}
 }
 
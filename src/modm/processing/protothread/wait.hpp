@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_PT_WAIT_HPP
+#define MODM_PT_WAIT_HPP
+
+#include <stdint.h>
+#include <chrono>
+#include <modm/architecture/interface/clock.hpp>
+
+namespace modm
+{
+	template< class Clock, class Duration >
+	class GenericTimeout;
+
+	namespace pt
+	{
+		/**
+		 * \brief	Wake-up sources of a parked protothread
+		 *
+		 * Filled by `PT_WAIT_FOR()` while the protothread is run by a
+		 * `modm::pt::Scheduler`, which only runs the protothread again once
+		 * one of the sources is ready. All sources of a compound wait are
+		 * watched, up to `MaxSources` flags and semaphores, beyond which the
+		 * protothread is polled instead. Yielding for any other reason marks
+		 * the protothread as polled as well, so it runs again on the next
+		 * pass even if a child protothread added its sources before.
+		 *
+		 * \ingroup	modm_processing_protothread
+		 */
+		struct WakeUp
+		{
+			static constexpr uint8_t MaxSources{4};
+
+			/// A flag or semaphore, which is ready once `isReady(object)` is true
+			struct Source
+			{
+				const volatile void *object;
+				bool (*isReady)(const volatile void *object);
+			};
+
+			modm::Clock::time_point deadline{};
+			Source sources[MaxSources]{};
+			uint8_t count{0};
+			bool timed{false};
+			bool parked{false};
+			bool polled{false};
+
+			/// \return	\c true if the protothread must run
+			bool
+			isReady(modm::Clock::time_point now) const
+			{
+				if (polled or not parked) return true;
+				if (timed and isDue(now)) return true;
+				for (uint8_t ii = 0; ii < count; ii++)
+				{
+					if (sources[ii].isReady(sources[ii].object)) return true;
+				}
+				return false;
+			}
+
+			/// \return	\c true if the deadline is not in the future
+			bool
+			isDue(modm::Clock::time_point now) const
+			{
+				// robust against the overflow of the clock
+				return int32_t((now - deadline).count()) >= 0;
+			}
+		};
+
+		/// @cond
+		namespace detail
+		{
+			/// Wake-up sources of the protothread that is currently run by a scheduler
+			inline WakeUp *parking{nullptr};
+
+			/// Adds a source to the protothread that is currently run by a scheduler
+			inline void
+			watch(const volatile void *object, bool (*isReady)(const volatile void *))
+			{
+				WakeUp *wakeup = parking;
+				if (not wakeup) return;
+				// without space for the source only polling notices it
+				if (wakeup->count < WakeUp::MaxSources)
+					wakeup->sources[wakeup->count++] = {object, isReady};
+				else
+					wakeup->polled = true;
+				wakeup->parked = true;
+			}
+		}
+
+		/// The protothread waits for a condition that only polling can observe
+		inline bool
+		poll()
+		{
+			if (WakeUp *wakeup = detail::parking) wakeup->polled = true;
+			return true;
+		}
+
+		inline bool
+		park(const volatile bool &flag)
+		{
+			if (flag) return false;
+			detail::watch(&flag, [](const volatile void *flag)
+					{ return *static_cast<const volatile bool *>(flag); });
+			return true;
+		}
+
+		template< class Clock, class Duration >
+		bool
+		park(const GenericTimeout<Clock, Duration> &timeout)
+		{
+			if (timeout.isExpired()) return false;
+			WakeUp *wakeup = detail::parking;
+			// a stopped timeout may be restarted by anyone, so keep polling
+			if (wakeup and timeout.isArmed())
+			{
+				const auto deadline = modm::Clock::now() +
+						std::chrono::ceil<modm::Clock::duration>(timeout.remaining());
+				if (not wakeup->timed or
+					int32_t((deadline - wakeup->deadline).count()) < 0)
+				{
+					wakeup->deadline = deadline;
+				}
+				wakeup->timed = true;
+				wakeup->parked = true;
+			}
+			return true;
+		}
+
+		// park(Semaphore&) is declared in semaphore.hpp and found by ADL.
+
+		/// \return	\c true while none of the sources is ready
+		template< class... Sources >
+		bool
+		parked(Sources&... sources)
+		{
+			WakeUp *wakeup = detail::parking;
+			WakeUp previous;
+			if (wakeup) previous = *wakeup;
+			if ((park(sources) and ...)) return true;
+			// the protothread continues, so forget the partially added sources
+			if (wakeup) *wakeup = previous;
+			return false;
+		}
+		/// @endcond
+	}
+}
+
+#endif // MODM_PT_WAIT_HPP
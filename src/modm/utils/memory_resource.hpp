@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_MEMORY_RESOURCE_HPP
+#define MODM_MEMORY_RESOURCE_HPP
+
+#include <memory_resource>
+#include <modm/architecture/interface/assert.hpp>
+
+namespace modm
+{
+
+/**
+ * `std::pmr::memory_resource` adapter of a `modm::MonotonicArena` or
+ * `modm::PoolAllocator`.
+ *
+ * Allocations that do not fit into the resource are forwarded to the optional
+ * upstream resource, otherwise a failed allocation is fatal and raises the
+ * `alloc` assertion:
+ *
+ * ```cpp
+ * modm::PoolAllocator pool(buffer, 32);
+ * modm::MemoryResource<modm::PoolAllocator> resource(pool);
+ * std::pmr::list<int> list(&resource);
+ * ```
+ *
+ * @ingroup modm_utils
+ */
+template< class Resource >
+class MemoryResource : public std::pmr::memory_resource
+{
+public:
+	MemoryResource(Resource &resource, std::pmr::memory_resource *upstream = nullptr) :
+		resource(resource), upstream(upstream)
+	{}
+
+	Resource &
+	getResource() const
+	{ return resource; }
+
+protected:
+	void *
+	do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		if (void *ptr = resource.allocate(bytes, alignment)) return ptr;
+		if (upstream) return upstream->allocate(bytes, alignment);
+		modm_assert(0, "alloc", "Resource failed to allocate!", bytes);
+		return nullptr;
+	}
+
+	void
+	do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override
+	{
+		if (resource.contains(ptr)) resource.deallocate(ptr, bytes, alignment);
+		else if (upstream) upstream->deallocate(ptr, bytes, alignment);
+	}
+
+	bool
+	do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+	{ return this == &other; }
+
+private:
+	Resource &resource;
+	std::pmr::memory_resource *upstream;
+};
+
+}	// namespace modm
+
+#endif	// MODM_MEMORY_RESOURCE_HPP
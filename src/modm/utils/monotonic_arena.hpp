@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_MONOTONIC_ARENA_HPP
+#define MODM_MONOTONIC_ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <modm/architecture/interface/memory.hpp>
+
+namespace modm
+{
+
+/**
+ * Bump allocator over a fixed memory region.
+ *
+ * Allocations are carved from the region in order and are only freed all at
+ * once with `reset()` in constant time. Only the most recent allocation can be
+ * given back individually, which makes growing the last container cheap.
+ *
+ * The arena is meant for per-cycle work: allocate all temporary objects,
+ * process them, then reset the arena without touching the global heap.
+ * The destructors of the objects are not called by `reset()`.
+ *
+ * This class is not thread-safe, use one arena per context.
+ *
+ * @see modm::ResourceAllocator to use it with containers.
+ * @ingroup modm_utils
+ */
+class MonotonicArena
+{
+public:
+	/// Uses an external buffer, which must outlive the arena
+	MonotonicArena(void *buffer, std::size_t size) :
+		begin(static_cast<uint8_t *>(buffer)), end(begin + size), current(begin), peak(begin)
+	{}
+
+	template< typename T, std::size_t N >
+	explicit MonotonicArena(T (&buffer)[N]) :
+		MonotonicArena(buffer, sizeof(buffer))
+	{}
+
+	/// Allocates the region once from the heap with the given memory traits
+	MonotonicArena(std::size_t size, MemoryTraits traits) :
+		MonotonicArena(new (traits) uint8_t[size], size)
+	{
+		owned = true;
+	}
+
+	MonotonicArena(const MonotonicArena&) = delete;
+	MonotonicArena&
+	operator = (const MonotonicArena&) = delete;
+
+	~MonotonicArena()
+	{
+		if (owned) delete[] begin;
+	}
+
+	/// @return aligned memory or `nullptr` if the arena is exhausted
+	void *
+	allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+	{
+		const uintptr_t address = (uintptr_t(current) + alignment - 1) & ~uintptr_t(alignment - 1);
+		if (address > uintptr_t(end) or size > uintptr_t(end) - address) return nullptr;
+		current = reinterpret_cast<uint8_t *>(address) + size;
+		if (current > peak) peak = current;
+		return reinterpret_cast<void *>(address);
+	}
+
+	/// Only gives back the memory of the most recent allocation
+	void
+	deallocate(void *ptr, std::size_t size, std::size_t = alignof(std::max_align_t))
+	{
+		if (static_cast<uint8_t *>(ptr) + size == current) current = static_cast<uint8_t *>(ptr);
+	}
+
+	/// Frees all allocations at once
+	void
+	reset()
+	{ current = begin; }
+
+	bool
+	contains(const void *ptr) const
+	{ return begin <= ptr and ptr < end; }
+
+	std::size_t
+	getSize() const
+	{ return end - begin; }
+
+	std::size_t
+	getUsed() const
+	{ return current - begin; }
+
+	std::size_t
+	getAvailable() const
+	{ return end - current; }
+
+	/// Maximum of used bytes since construction
+	std::size_t
+	getPeak() const
+	{ return peak - begin; }
+
+private:
+	uint8_t *const begin;
+	uint8_t *const end;
+	uint8_t *current;
+	uint8_t *peak;
+	bool owned{false};
+};
+
+}	// namespace modm
+
+#endif	// MODM_MONOTONIC_ARENA_HPP
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_POOL_ALLOCATOR_HPP
+#define MODM_POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <modm/architecture/interface/memory.hpp>
+
+namespace modm
+{
+
+/**
+ * Fixed-block allocator over a fixed memory region.
+ *
+ * All blocks have the same size, so allocating and freeing is a constant time
+ * push or pop of an intrusive free list without any fragmentation. The blocks
+ * are carved lazily from the region, so construction is constant time too.
+ *
+ * This makes it a good fit for the nodes of lists and maps, which all have
+ * the same size.
+ *
+ * This class is not thread-safe, use one pool per context.
+ *
+ * @see modm::ResourceAllocator to use it with containers.
+ * @ingroup modm_utils
+ */
+class PoolAllocator
+{
+public:
+	/// Uses an external buffer, which must outlive the pool
+	PoolAllocator(void *buffer, std::size_t size, std::size_t blockSize,
+				  std::size_t alignment = alignof(std::max_align_t)) :
+		origin(static_cast<uint8_t *>(buffer)),
+		alignment(alignment < alignof(Node) ? alignof(Node) : alignment),
+		blockSize(align(blockSize < sizeof(Node) ? sizeof(Node) : blockSize, this->alignment)),
+		begin(reinterpret_cast<uint8_t *>(align(uintptr_t(buffer), this->alignment))),
+		end(begin + (uintptr_t(buffer) + size > uintptr_t(begin) ?
+					 (uintptr_t(buffer) + size - uintptr_t(begin)) / this->blockSize * this->blockSize : 0)),
+		next(begin)
+	{}
+
+	template< typename T, std::size_t N >
+	PoolAllocator(T (&buffer)[N], std::size_t blockSize,
+				  std::size_t alignment = alignof(std::max_align_t)) :
+		PoolAllocator(buffer, sizeof(buffer), blockSize, alignment)
+	{}
+
+	/// Allocates the region once from the heap with the given memory traits
+	PoolAllocator(std::size_t blockSize, std::size_t blocks, MemoryTraits traits,
+				  std::size_t alignment = alignof(std::max_align_t)) :
+		PoolAllocator(new (traits) uint8_t[regionSize(blockSize, blocks, alignment)],
+					  regionSize(blockSize, blocks, alignment), blockSize, alignment)
+	{
+		owned = true;
+	}
+
+	PoolAllocator(const PoolAllocator&) = delete;
+	PoolAllocator&
+	operator = (const PoolAllocator&) = delete;
+
+	~PoolAllocator()
+	{
+		if (owned) delete[] origin;
+	}
+
+	/// @return one block or `nullptr` if the request does not fit or the pool is exhausted
+	void *
+	allocate(std::size_t size, std::size_t alignment = 1)
+	{
+		if (size > blockSize or alignment > this->alignment) return nullptr;
+		void *ptr;
+		if (freelist) {
+			ptr = freelist;
+			freelist = freelist->next;
+		}
+		else if (next < end) {
+			ptr = next;
+			next += blockSize;
+		}
+		else return nullptr;
+
+		if (++used > peak) peak = used;
+		return ptr;
+	}
+
+	void
+	deallocate(void *ptr, std::size_t = 0, std::size_t = 0)
+	{
+		if (not ptr) return;
+		Node *node = static_cast<Node *>(ptr);
+		node->next = freelist;
+		freelist = node;
+		used--;
+	}
+
+	/// Frees all blocks at once
+	void
+	reset()
+	{
+		freelist = nullptr;
+		next = begin;
+		used = 0;
+	}
+
+	bool
+	contains(const void *ptr) const
+	{ return begin <= ptr and ptr < end; }
+
+	std::size_t
+	getBlockSize() const
+	{ return blockSize; }
+
+	std::size_t
+	getBlockCount() const
+	{ return (end - begin) / blockSize; }
+
+	std::size_t
+	getUsed() const
+	{ return used; }
+
+	std::size_t
+	getAvailable() const
+	{ return getBlockCount() - used; }
+
+	/// Maximum of used blocks since construction
+	std::size_t
+	getPeak() const
+	{ return peak; }
+
+private:
+	struct Node
+	{
+		Node *next;
+	};
+
+	static constexpr std::size_t
+	align(std::size_t value, std::size_t alignment)
+	{ return (value + alignment - 1) & ~(alignment - 1); }
+
+	/// Fits exactly the number of blocks regardless of the alignment of the region
+	static constexpr std::size_t
+	regionSize(std::size_t blockSize, std::size_t blocks, std::size_t alignment)
+	{
+		if (alignment < alignof(Node)) alignment = alignof(Node);
+		if (blockSize < sizeof(Node)) blockSize = sizeof(Node);
+		return align(blockSize, alignment) * blocks + alignment - 1;
+	}
+
+	uint8_t *const origin;
+	const std::size_t alignment;
+	const std::size_t blockSize;
+	uint8_t *const begin;
+	uint8_t *const end;
+	uint8_t *next;
+	Node *freelist{nullptr};
+	std::size_t used{0};
+	std::size_t peak{0};
+	bool owned{false};
+};
+
+}	// namespace modm
+
+#endif	// MODM_POOL_ALLOCATOR_HPP
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_RESOURCE_ALLOCATOR_HPP
+#define MODM_RESOURCE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <modm/architecture/interface/assert.hpp>
+
+namespace modm
+{
+
+/**
+ * Standard allocator handle of a `modm::MonotonicArena` or `modm::PoolAllocator`.
+ *
+ * Use it with the modm and standard containers, which then take all their
+ * memory from the resource instead of the global heap:
+ *
+ * ```cpp
+ * uint8_t buffer[1024];
+ * modm::MonotonicArena arena(buffer);
+ * modm::DynamicArray<int, modm::ResourceAllocator<int, modm::MonotonicArena>> array(10, arena);
+ * ```
+ *
+ * The handle only refers to the resource, so copies of it share the resource.
+ * A failed allocation is fatal and raises the `alloc` assertion.
+ *
+ * @ingroup modm_utils
+ */
+template< typename T, class Resource >
+class ResourceAllocator
+{
+	template< typename, class > friend class ResourceAllocator;
+
+public:
+	using value_type = T;
+
+	template< typename U >
+	struct rebind
+	{
+		using other = ResourceAllocator<U, Resource>;
+	};
+
+	ResourceAllocator(Resource &resource) noexcept :
+		resource(&resource)
+	{}
+
+	template< typename U >
+	ResourceAllocator(const ResourceAllocator<U, Resource> &other) noexcept :
+		resource(other.resource)
+	{}
+
+	T *
+	allocate(std::size_t n)
+	{
+		void *ptr = resource->allocate(n * sizeof(T), alignof(T));
+		modm_assert(ptr, "alloc", "Resource failed to allocate!", n * sizeof(T));
+		return static_cast<T *>(ptr);
+	}
+
+	void
+	deallocate(T *ptr, std::size_t n) noexcept
+	{
+		resource->deallocate(ptr, n * sizeof(T), alignof(T));
+	}
+
+	Resource &
+	getResource() const
+	{ return *resource; }
+
+	template< typename U >
+	bool
+	operator == (const ResourceAllocator<U, Resource> &other) const
+	{ return resource == other.resource; }
+
+private:
+	Resource *resource;
+};
+
+}	// namespace modm
+
+#endif	// MODM_RESOURCE_ALLOCATOR_HPP
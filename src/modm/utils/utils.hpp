@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2011, Fabian Greif
  * Copyright (c) 2011-2012, 2017-2018, Niklas Hauser
  * Copyright (c) 2014, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -18,3 +19,6 @@
 #include "utils/aligned_storage.hpp"
 #include "utils/inplace_any.hpp"
 #include "utils/inplace_function.hpp"
+#include "utils/monotonic_arena.hpp"
+#include "utils/pool_allocator.hpp"
+#include "utils/resource_allocator.hpp"
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef	UNITTEST_BENCHMARK_HPP
+#define	UNITTEST_BENCHMARK_HPP
+
+#include "harness.hpp"
+
+namespace unittest
+{
+	/// @cond
+	namespace benchmark
+	{
+		/// Number of timed samples
+		constexpr uint8_t Samples = 100;
+
+		/// false if the target has no suitable timer
+		extern const bool available;
+		/// Unit of all timings, for example "ns" or "cycles"
+		extern const char *const unit;
+		/// Minimum duration of one sample in the unit
+		extern const uint32_t minimum;
+
+		uint32_t
+		now();
+
+		BenchmarkResult
+		evaluate(uint32_t *samples, uint32_t iterations);
+
+		template< typename Function >
+		modm_noinline uint32_t
+		measure(Function &function, uint32_t iterations)
+		{
+			const uint32_t start = now();
+			for (uint32_t ii = 0; ii < iterations; ii++) function();
+			return now() - start;
+		}
+
+		template< typename Function >
+		BenchmarkResult
+		run(Function &&function)
+		{
+			if (not available) {
+				function();
+				return {};
+			}
+			// doubling the iterations until a sample is long enough to time
+			// also warms up the caches and branch predictors
+			uint32_t iterations = 1;
+			while (measure(function, iterations) < minimum and iterations < (1ul << 20))
+				iterations *= 2;
+			measure(function, iterations);
+
+			uint32_t samples[Samples];
+			for (uint32_t &sample : samples) sample = measure(function, iterations);
+			return evaluate(samples, iterations);
+		}
+	}
+	/// @endcond
+
+	/// Prevents the compiler from optimizing away the computation of a value
+	/// @ingroup modm_unittest
+	template< typename T >
+	modm_always_inline void
+	doNotOptimize(const T &value)
+	{
+		asm volatile ("" :: "r,m" (value) : "memory");
+	}
+}
+
+/// @ingroup modm_unittest
+/// @{
+
+#ifdef __DOXYGEN__
+/**
+ * Times a callable and reports min, median and 99th percentile per call.
+ *
+ * The number of iterations per sample is scaled automatically, so that each
+ * sample is long enough for the timer resolution. On hosted the timings are
+ * in nanoseconds, on Cortex-M3 and above in CPU cycles using `DWT->CYCCNT`.
+ * Other targets only call the function once.
+ *
+ * The result is reported in machine-readable form and fails the test if the
+ * median exceeds the threshold configured for `suite.name` in the reporter.
+ */
+#define	TEST_BENCHMARK(name, function)
+#else
+#define	TEST_BENCHMARK(name, function) \
+	TEST_RETURN_(TEST_REPORTER_.reportBenchmark((name), ::unittest::benchmark::run(function), __LINE__))
+#endif
+
+/// @}
+
+#endif	// UNITTEST_BENCHMARK_HPP
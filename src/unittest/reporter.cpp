@@ -4,6 +4,7 @@
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2012, 2017-2018, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,7 @@
 // ----------------------------------------------------------------------------
 
 #include "reporter.hpp"
+#include "benchmark.hpp"
 
 namespace
 {
@@ -30,12 +32,20 @@ namespace
 	FLASH_STORAGE_STRING(reportTests) = " tests\n";
 	FLASH_STORAGE_STRING(reportOk) = "OK!\n";
 	FLASH_STORAGE_STRING(reportFail) = "FAIL!\n";
+
+	FLASH_STORAGE_STRING(benchmarkName) = "{\"benchmark\": \"";
+	FLASH_STORAGE_STRING(benchmarkUnit) = "\", \"unit\": \"";
+	FLASH_STORAGE_STRING(benchmarkIterations) = "\", \"iterations\": ";
+	FLASH_STORAGE_STRING(benchmarkMin) = ", \"min\": ";
+	FLASH_STORAGE_STRING(benchmarkMedian) = ", \"median\": ";
+	FLASH_STORAGE_STRING(benchmarkP99) = ", \"p99\": ";
+	FLASH_STORAGE_STRING(benchmarkThreshold) = "median exceeds threshold ";
 }
 
 unittest::Reporter::Reporter(modm::IODevice& device) :
 	outputStream(device), testName(modm::accessor::asFlash(invalidName)),
 	testFunction(modm::accessor::asFlash(invalidName)), testsPassed(0),
-	testsFailed(0)
+	testsFailed(0), thresholds(nullptr), thresholdCount(0)
 {
 }
 
@@ -75,6 +85,80 @@ unittest::Reporter::reportFailure(unsigned int lineNumber)
 	return outputStream;
 }
 
+bool
+unittest::Reporter::reportBenchmark(const char *name, const BenchmarkResult& result,
+									unsigned int lineNumber)
+{
+	// the target has no timer for benchmarks
+	if (result.iterations == 0) {
+		testsPassed++;
+		return true;
+	}
+
+	outputStream << modm::accessor::asFlash(benchmarkName)
+				 << testName << '.' << name
+				 << modm::accessor::asFlash(benchmarkUnit)
+				 << benchmark::unit
+				 << modm::accessor::asFlash(benchmarkIterations)
+				 << result.iterations
+				 << modm::accessor::asFlash(benchmarkMin)
+				 << result.min
+				 << modm::accessor::asFlash(benchmarkMedian)
+				 << result.median
+				 << modm::accessor::asFlash(benchmarkP99)
+				 << result.p99
+				 << '}' << modm::endl;
+
+	for (std::size_t ii = 0; ii < thresholdCount; ii++)
+	{
+		// match "suite.benchmark"
+		const char *key = thresholds[ii].name;
+		std::size_t pos = 0;
+		while (testName[pos] and key[pos] == testName[pos]) pos++;
+		if (testName[pos] or key[pos] != '.') continue;
+		key += pos + 1;
+		pos = 0;
+		while (name[pos] and key[pos] == name[pos]) pos++;
+		if (name[pos] or key[pos]) continue;
+
+		if (result.median > thresholds[ii].median)
+		{
+			reportFailure(lineNumber) << modm::accessor::asFlash(benchmarkThreshold)
+									  << thresholds[ii].median << '\n';
+			return false;
+		}
+		break;
+	}
+	testsPassed++;
+	return true;
+}
+
+void
+unittest::Reporter::setBenchmarkThresholds(const BenchmarkThreshold *thresholds, std::size_t count)
+{
+	this->thresholds = thresholds;
+	thresholdCount = count;
+}
+
+void
+unittest::Reporter::addResults(int_fast16_t passed, int_fast16_t failed)
+{
+	testsPassed += passed;
+	testsFailed += failed;
+}
+
+int_fast16_t
+unittest::Reporter::getPassed() const
+{
+	return testsPassed;
+}
+
+int_fast16_t
+unittest::Reporter::getFailed() const
+{
+	return testsFailed;
+}
+
 uint8_t
 unittest::Reporter::printSummary()
 {
@@ -4,6 +4,7 @@
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -17,12 +18,31 @@
 #define	UNITTEST_REPORTER_HPP
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include <modm/io/iostream.hpp>
 #include <modm/architecture/interface/accessor_flash.hpp>
 
 namespace unittest
 {
+	/// Timing of one benchmark, all values are per iteration
+	/// @ingroup modm_unittest
+	struct BenchmarkResult
+	{
+		uint32_t iterations;	///< iterations per sample, zero if not timed
+		uint32_t min;
+		uint32_t median;
+		uint32_t p99;
+	};
+
+	/// Maximum median of the benchmark `name` of the form `suite.benchmark`
+	/// @ingroup modm_unittest
+	struct BenchmarkThreshold
+	{
+		const char *name;
+		uint32_t median;
+	};
+
 	/**
 	 * \brief	Reporter
 	 *
@@ -75,6 +95,40 @@ namespace unittest
 		modm::IOStream&
 		reportFailure(unsigned int lineNumber);
 
+		/**
+		 * \brief	Report the result of a benchmark
+		 *
+		 * Writes the result as one line of JSON and fails if the median
+		 * exceeds the threshold of this benchmark.
+		 */
+		bool
+		reportBenchmark(const char *name, const BenchmarkResult& result,
+						unsigned int lineNumber);
+
+		/**
+		 * \brief	Set the regression thresholds of the benchmarks
+		 *
+		 * The table must outlive the reporter.
+		 */
+		void
+		setBenchmarkThresholds(const BenchmarkThreshold *thresholds, std::size_t count);
+
+		/**
+		 * \brief	Add the results of tests executed by another reporter
+		 *
+		 * Used by runners that execute test suites in separate processes.
+		 */
+		void
+		addResults(int_fast16_t passed, int_fast16_t failed);
+
+		/// Number of passed tests so far
+		int_fast16_t
+		getPassed() const;
+
+		/// Number of failed tests so far
+		int_fast16_t
+		getFailed() const;
+
 		/**
 		 * \brief	Writes a summary of all the tests
 		 *
@@ -92,6 +146,9 @@ namespace unittest
 
 		int_fast16_t testsPassed;
 		int_fast16_t testsFailed;
+
+		const BenchmarkThreshold *thresholds;
+		std::size_t thresholdCount;
 	};
 }
 
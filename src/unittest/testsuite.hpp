@@ -2,6 +2,7 @@
  * Copyright (c) 2009-2010, 2012, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2012, Sascha Schade
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -36,6 +37,25 @@ namespace unittest
 		virtual void
 		tearDown();
 	};
+
+	/**
+	 * \brief	Entry of the table of all test suites
+	 *
+	 * The table is generated together with `run_modm_unit_test()`, so that
+	 * a runner can execute the suites individually.
+	 *
+	 * \ingroup	modm_unittest
+	 */
+	struct TestSuiteEntry
+	{
+		const char *name;	///< Name of the test suite in flash
+		void (*run)();		///< Executes all test cases of the suite
+	};
+
+	/// Table of all test suites in alphabetical order
+	extern const TestSuiteEntry testSuites[];
+	/// Number of entries in `testSuites`
+	extern const std::size_t testSuiteCount;
 }
 
 #endif	// UNITTEST_TESTSUITE_HPP
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/driver/atomic/block_queue.hpp>
+
+#include "block_queue_test.hpp"
+
+void
+BlockQueueTest::testQueue()
+{
+	modm::atomic::BlockQueue<uint16_t, 4> queue;
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getMaxSize(), 4u);
+	TEST_ASSERT_EQUALS(queue.front().size(), 0u);
+
+	for (uint16_t value = 0; value < 3; value++)
+	{
+		uint16_t *slot = queue.reserve();
+		TEST_ASSERT_TRUE(slot != nullptr);
+		*slot = value;
+		queue.commit();
+	}
+	TEST_ASSERT_EQUALS(queue.getSize(), 3u);
+	queue.pop(2);
+
+	for (uint16_t value = 3; value < 6; value++)
+	{
+		*queue.reserve() = value;
+		queue.commit();
+	}
+	TEST_ASSERT_EQUALS(queue.getSize(), 4u);
+	TEST_ASSERT_TRUE(queue.reserve() == nullptr);
+	TEST_ASSERT_EQUALS(queue.getOverruns(), 1u);
+
+	// the block ends at the end of the buffer
+	auto block = queue.front();
+	TEST_ASSERT_EQUALS(block.size(), 2u);
+	TEST_ASSERT_EQUALS(block[0], 2);
+	TEST_ASSERT_EQUALS(block[1], 3);
+	queue.pop(block.size());
+
+	block = queue.front();
+	TEST_ASSERT_EQUALS(block.size(), 2u);
+	TEST_ASSERT_EQUALS(block[0], 4);
+	TEST_ASSERT_EQUALS(block[1], 5);
+
+	// popping more than available empties the queue
+	queue.pop(10);
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_TRUE(queue.reserve() != nullptr);
+}
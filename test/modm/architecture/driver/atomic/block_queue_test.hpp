@@ -1,7 +1,5 @@
 /*
- * Copyright (c) 2009, Martin Rosekeit
- * Copyright (c) 2009-2011, Fabian Greif
- * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -11,14 +9,12 @@
  */
 // ----------------------------------------------------------------------------
 
-#ifndef MODM_SD_HPP
-#define MODM_SD_HPP
+#include <unittest/testsuite.hpp>
 
-#include "fat.hpp"
-
-namespace modm
+/// @ingroup modm_test_test_architecture
+class BlockQueueTest : public unittest::TestSuite
 {
-
-}
-
-#endif // MODM_SD_HPP
+public:
+	void
+	testQueue();
+};
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/architecture/driver/atomic/ring_writer.hpp>
+#include <utility>
+
+#include "ring_writer_test.hpp"
+
+namespace
+{
+
+struct Ring
+{
+	static constexpr uint32_t size{16};
+	uint8_t buffer[size]{};
+	uint32_t head{0};
+	uint32_t tail{0};
+	uint32_t publishes{0};
+	// called before the head is published to simulate a preempting writer
+	void (*preempt)(){nullptr};
+
+	uint32_t
+	getFree(uint32_t position) const
+	{ return (tail + size - position - 1) % size; }
+
+	void
+	copy(uint32_t position, const uint8_t *data, uint32_t length)
+	{
+		for (uint32_t ii = 0; ii < length; ii++) {
+			buffer[(position + ii) % size] = data[ii];
+		}
+	}
+
+	void
+	publish(uint32_t position)
+	{
+		publishes++;
+		if (auto function = std::exchange(preempt, nullptr)) function();
+		head = position;
+	}
+};
+
+Ring* ring;
+modm::atomic::RingWriter* writer;
+
+}
+
+void
+RingWriterTest::testWrite()
+{
+	Ring ring;
+	modm::atomic::RingWriter writer;
+	const uint8_t data[20]{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+
+	TEST_ASSERT_EQUALS(writer.write(ring, data, 10, false), 10u);
+	TEST_ASSERT_EQUALS(ring.head, 10u);
+	TEST_ASSERT_EQUALS_ARRAY(ring.buffer, data, 10);
+
+	// records are written completely or not at all
+	TEST_ASSERT_EQUALS(writer.write(ring, data, 6, false), 0u);
+	TEST_ASSERT_EQUALS(ring.head, 10u);
+
+	// partial writes fill the remaining space
+	TEST_ASSERT_EQUALS(writer.write(ring, data, 6, true), 5u);
+	TEST_ASSERT_EQUALS(ring.head, 15u);
+	TEST_ASSERT_EQUALS(writer.getReserved(), 15u);
+
+	// writes wrap around the end of the buffer
+	ring.tail = 15;
+	TEST_ASSERT_EQUALS(writer.write(ring, data, 4, false), 4u);
+	TEST_ASSERT_EQUALS(ring.head, 3u);
+	TEST_ASSERT_EQUALS(ring.buffer[15], 1);
+	TEST_ASSERT_EQUALS(ring.buffer[2], 4);
+}
+
+void
+RingWriterTest::testPreemptedPublish()
+{
+	Ring ring;
+	modm::atomic::RingWriter writer;
+	::ring = &ring;
+	::writer = &writer;
+	const uint8_t data[4]{1, 2, 3, 4};
+
+	// a writer interrupting the publishing of the head offset
+	ring.preempt = []
+	{
+		const uint8_t nested[3]{5, 6, 7};
+		TEST_ASSERT_EQUALS(::writer->write(*::ring, nested, 3, false), 3u);
+		TEST_ASSERT_EQUALS(::ring->head, 7u);
+	};
+	TEST_ASSERT_EQUALS(writer.write(ring, data, 4, false), 4u);
+
+	// the head must not move back behind the data of the interrupting writer
+	TEST_ASSERT_EQUALS(ring.head, 7u);
+	TEST_ASSERT_EQUALS(ring.publishes, 3u);
+	TEST_ASSERT_EQUALS(ring.buffer[6], 7);
+}
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "i2c_queue_test.hpp"
+
+#include <modm/architecture/interface/i2c_queue.hpp>
+#include <modm-test/mock/i2c_bus.hpp>
+#include <algorithm>
+
+using namespace std::chrono_literals;
+using Bus = modm_test::platform::I2cBus;
+
+static uint8_t registers[8][16];
+
+static void
+attachDevices()
+{
+	Bus::removeDevices();
+	for (uint8_t ii = 0; ii < 8; ii++)
+	{
+		for (uint8_t jj = 0; jj < 16; jj++)
+			registers[ii][jj] = (ii << 4) | jj;
+		Bus::attachDevice(0x10 + ii, registers[ii], 16);
+	}
+}
+
+void
+I2cQueueTest::setUp()
+{
+	Bus::setSynchronous(false);
+	Bus::setBuffered(true);
+	Bus::setBaudrate(400'000);
+	Bus::setInterruptLatency(0ns);
+	Bus::resetStatistics();
+	attachDevices();
+}
+
+// ----------------------------------------------------------------------------
+void
+I2cQueueTest::testScatterGatherWrite()
+{
+	modm::I2cQueue<Bus, 4> queue;
+
+	const uint8_t reg = 0x04;
+	const uint8_t payload[] = {0xA0, 0xA1, 0xA2, 0xA3};
+	auto *request = queue.write(0x12, {&reg, 1}, payload);
+	TEST_ASSERT_TRUE(request != nullptr);
+	TEST_ASSERT_TRUE(request->isBusy());
+
+	Bus::run();
+	TEST_ASSERT_FALSE(request->isBusy());
+	TEST_ASSERT_TRUE(request->wasSuccessful());
+	TEST_ASSERT_TRUE(queue.release(request));
+
+	// the payload follows the register address without a repeated start
+	TEST_ASSERT_EQUALS_ARRAY(payload, registers[2] + 4, 4);
+	TEST_ASSERT_EQUALS(registers[2][3], 0x23);
+	TEST_ASSERT_EQUALS(registers[2][8], 0x28);
+	TEST_ASSERT_EQUALS(Bus::getStatistics().bytes, 5u);
+	// start, address, 5 bytes and stop
+	TEST_ASSERT_TRUE(Bus::getStatistics().busy == 2500ns * (1 + 9 + 5*9 + 1));
+}
+
+void
+I2cQueueTest::testWriteRead()
+{
+	modm::I2cQueue<Bus, 4> queue;
+
+	const uint8_t reg[] = {0x02, 0x0A};
+	uint8_t data[2][3]{};
+	auto *first = queue.writeRead(0x10, {reg, 1}, data[0]);
+	auto *second = queue.writeRead(0x17, {reg + 1, 1}, data[1]);
+	TEST_ASSERT_TRUE(first != nullptr);
+	TEST_ASSERT_TRUE(second != nullptr);
+
+	Bus::run();
+	TEST_ASSERT_TRUE(first->wasSuccessful());
+	TEST_ASSERT_TRUE(second->wasSuccessful());
+
+	const uint8_t expected[2][3] = {{0x02, 0x03, 0x04}, {0x7A, 0x7B, 0x7C}};
+	TEST_ASSERT_EQUALS_ARRAY(expected[0], data[0], 3);
+	TEST_ASSERT_EQUALS_ARRAY(expected[1], data[1], 3);
+
+	// a read continues at the register pointer
+	uint8_t next{0};
+	auto *third = queue.read(0x17, {&next, 1});
+	Bus::run();
+	TEST_ASSERT_TRUE(third->wasSuccessful());
+	TEST_ASSERT_EQUALS(next, 0x7D);
+}
+
+void
+I2cQueueTest::testPool()
+{
+	modm::I2cQueue<Bus, 3> queue;
+	TEST_ASSERT_EQUALS(queue.getFree(), 3u);
+
+	modm::I2cQueue<Bus, 3>::Request *requests[3];
+	for (auto &request : requests)
+		request = queue.ping(0x11);
+	TEST_ASSERT_EQUALS(queue.getFree(), 0u);
+	TEST_ASSERT_TRUE(queue.ping(0x11) == nullptr);
+
+	// busy requests cannot be released
+	TEST_ASSERT_FALSE(queue.release(requests[0]));
+	Bus::run();
+	TEST_ASSERT_EQUALS(Bus::getStatistics().transactions, 3u);
+
+	for (auto *request : requests)
+	{
+		TEST_ASSERT_TRUE(request->wasSuccessful());
+		TEST_ASSERT_TRUE(queue.release(request));
+	}
+	TEST_ASSERT_EQUALS(queue.getFree(), 3u);
+	TEST_ASSERT_TRUE(queue.ping(0x11) != nullptr);
+	Bus::run();
+}
+
+void
+I2cQueueTest::testChaining()
+{
+	modm::I2cQueue<Bus, 8> queue;
+
+	const uint8_t reg = 0x01;
+	uint8_t data[8][2]{};
+	modm::I2cQueue<Bus, 8>::Request *requests[8];
+	for (uint8_t ii = 0; ii < 8; ii++)
+		requests[ii] = queue.writeRead(0x10 + ii, {&reg, 1}, data[ii]);
+
+	// one transaction is active and the queue of the master is full
+	TEST_ASSERT_EQUALS(queue.getPending(), 8u - 1u - Bus::TransactionBufferSize);
+
+	// the pending requests are passed to the master when the previous ones are detached
+	Bus::run();
+	TEST_ASSERT_EQUALS(queue.getPending(), 0u);
+	TEST_ASSERT_FALSE(Bus::isBusy());
+	TEST_ASSERT_EQUALS(Bus::getStatistics().transactions, 8u);
+
+	for (uint8_t ii = 0; ii < 8; ii++)
+	{
+		TEST_ASSERT_TRUE(requests[ii]->wasSuccessful());
+		TEST_ASSERT_EQUALS(data[ii][0], (ii << 4) | 0x01);
+		TEST_ASSERT_EQUALS(data[ii][1], (ii << 4) | 0x02);
+		queue.release(requests[ii]);
+	}
+	TEST_ASSERT_EQUALS(queue.getFree(), 8u);
+}
+
+void
+I2cQueueTest::testAddressNack()
+{
+	modm::I2cQueue<Bus, 4> queue;
+
+	uint8_t data[2]{};
+	auto *missing = queue.read(0x50, {data, 1});
+	auto *present = queue.read(0x13, {data + 1, 1});
+	Bus::run();
+
+	TEST_ASSERT_FALSE(missing->isBusy());
+	TEST_ASSERT_FALSE(missing->wasSuccessful());
+	TEST_ASSERT_TRUE(present->wasSuccessful());
+	TEST_ASSERT_EQUALS(data[1], 0x30);
+
+	TEST_ASSERT_TRUE(queue.release(missing));
+	TEST_ASSERT_TRUE(queue.release(present));
+
+	// a reset fails the active and all queued requests
+	auto *active = queue.ping(0x13);
+	auto *queued = queue.ping(0x14);
+	TEST_ASSERT_TRUE(Bus::isBusy());
+	Bus::reset();
+	TEST_ASSERT_FALSE(Bus::isBusy());
+	TEST_ASSERT_FALSE(active->wasSuccessful());
+	TEST_ASSERT_FALSE(queued->wasSuccessful());
+	TEST_ASSERT_TRUE(queue.release(active));
+	TEST_ASSERT_TRUE(queue.release(queued));
+	TEST_ASSERT_EQUALS(queue.getFree(), 4u);
+}
+
+void
+I2cQueueTest::testSynchronousMaster()
+{
+	Bus::setSynchronous(true);
+	modm::I2cQueue<Bus, 4> queue;
+
+	// every request is transferred within submit, the next request is
+	// started by the dispatch which is running while the master detaches
+	uint8_t data[3]{};
+	modm::I2cQueue<Bus, 4>::Request *requests[3];
+	for (uint8_t ii = 0; ii < 3; ii++)
+		requests[ii] = queue.read(0x14 + ii, {data + ii, 1});
+
+	TEST_ASSERT_EQUALS(queue.getPending(), 0u);
+	TEST_ASSERT_FALSE(Bus::isBusy());
+	for (uint8_t ii = 0; ii < 3; ii++)
+	{
+		TEST_ASSERT_TRUE(requests[ii]->wasSuccessful());
+		TEST_ASSERT_EQUALS(data[ii], (4 + ii) << 4);
+	}
+	TEST_ASSERT_FALSE(queue.update());
+}
+
+void
+I2cQueueTest::testDevice()
+{
+	Bus::setSynchronous(true);
+	modm::I2cQueue<Bus, 2> queue;
+	modm::I2cQueueDevice<decltype(queue)> device(queue, 0x15);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.ping()));
+
+	const uint8_t reg = 0x08;
+	const uint8_t payload[] = {0x11, 0x22};
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.write({&reg, 1}, payload)));
+	TEST_ASSERT_EQUALS(registers[5][8], 0x11);
+	TEST_ASSERT_EQUALS(registers[5][9], 0x22);
+
+	uint8_t data[3]{};
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.writeRead({&reg, 1}, data)));
+	const uint8_t expected[] = {0x11, 0x22, 0x5A};
+	TEST_ASSERT_EQUALS_ARRAY(expected, data, 3);
+
+	// the descriptors are returned to the pool
+	TEST_ASSERT_EQUALS(queue.getFree(), 2u);
+
+	device.setAddress(0x60);
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(device.ping()));
+	TEST_ASSERT_EQUALS(queue.getFree(), 2u);
+}
+
+void
+I2cQueueTest::testUnbufferedMaster()
+{
+	Bus::setBuffered(false);
+	modm::I2cQueue<Bus, 4> queue;
+
+	uint8_t data[2]{};
+	auto *first = queue.read(0x12, {data, 1});
+	auto *second = queue.read(0x13, {data + 1, 1});
+	TEST_ASSERT_EQUALS(queue.getPending(), 1u);
+
+	// the master still holds the first request while detaching it,
+	// so the chained second request is rejected and stays pending
+	Bus::run();
+	TEST_ASSERT_TRUE(first->wasSuccessful());
+	TEST_ASSERT_FALSE(Bus::isBusy());
+	TEST_ASSERT_TRUE(second->isBusy());
+	TEST_ASSERT_EQUALS(queue.getPending(), 1u);
+
+	// polling the queue passes it to the idle master
+	TEST_ASSERT_FALSE(queue.update());
+	Bus::run();
+	TEST_ASSERT_TRUE(second->wasSuccessful());
+	TEST_ASSERT_EQUALS(data[0], 0x20);
+	TEST_ASSERT_EQUALS(data[1], 0x30);
+	queue.release(first);
+	queue.release(second);
+}
+
+void
+I2cQueueTest::testUnbufferedDevices()
+{
+	// the master rejects transactions while it detaches the previous one
+	Bus::setSynchronous(true);
+	Bus::setBuffered(false);
+	modm::I2cQueue<Bus, 2> queue;
+	modm::I2cQueueDevice<decltype(queue)> first(queue, 0x14);
+	modm::I2cQueueDevice<decltype(queue)> second(queue, 0x16);
+
+	const uint8_t reg = 0x03;
+	uint8_t data[2][2]{};
+	for (uint8_t ii = 0; ii < 4; ii++)
+	{
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(first.writeRead({&reg, 1}, data[0])));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(second.writeRead({&reg, 1}, data[1])));
+	}
+	TEST_ASSERT_EQUALS(data[0][1], 0x44);
+	TEST_ASSERT_EQUALS(data[1][1], 0x64);
+	TEST_ASSERT_EQUALS(queue.getFree(), 2u);
+}
+
+void
+I2cQueueTest::testUtilization()
+{
+	// the software needs 50us to start the next transfer from a thread
+	static constexpr auto ThreadLatency = 50us;
+	Bus::setInterruptLatency(2us);
+	modm::I2cQueue<Bus, 8> queue;
+
+	const uint8_t reg = 0x00;
+	uint8_t data[8][6];
+
+	// every device waits for its transfer before the next one is started
+	for (uint8_t ii = 0; ii < 8; ii++)
+	{
+		Bus::idle(ThreadLatency);
+		auto *request = queue.writeRead(0x10 + ii, {&reg, 1}, data[ii]);
+		Bus::run();
+		TEST_ASSERT_TRUE(request->wasSuccessful());
+		queue.release(request);
+	}
+	const auto sequential = Bus::getStatistics();
+	TEST_ASSERT_EQUALS(sequential.transactions, 8u);
+
+	// all reads are submitted at once and chained by the interrupt
+	Bus::resetStatistics();
+	std::fill(&data[0][0], &data[0][0] + sizeof(data), 0);
+	modm::I2cQueue<Bus, 8>::Request *requests[8];
+	Bus::idle(ThreadLatency);
+	for (uint8_t ii = 0; ii < 8; ii++)
+		requests[ii] = queue.writeRead(0x10 + ii, {&reg, 1}, data[ii]);
+	Bus::run();
+	const auto queued = Bus::getStatistics();
+	TEST_ASSERT_EQUALS(queued.transactions, 8u);
+
+	for (uint8_t ii = 0; ii < 8; ii++)
+	{
+		TEST_ASSERT_TRUE(requests[ii]->wasSuccessful());
+		TEST_ASSERT_EQUALS(data[ii][5], (ii << 4) | 0x05);
+		queue.release(requests[ii]);
+	}
+
+	// the same bits were transferred in both cases
+	TEST_ASSERT_TRUE(sequential.busy == queued.busy);
+	TEST_ASSERT_TRUE(queued.idle == ThreadLatency + 7 * 2us);
+	TEST_ASSERT_TRUE(sequential.getUtilization() < 0.85f);
+	TEST_ASSERT_TRUE(queued.getUtilization() > 0.95f);
+}
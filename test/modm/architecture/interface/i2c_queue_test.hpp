@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef I2C_QUEUE_TEST_HPP
+#define I2C_QUEUE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_architecture
+class I2cQueueTest : public unittest::TestSuite
+{
+public:
+	virtual void
+	setUp();
+
+	void
+	testScatterGatherWrite();
+
+	void
+	testWriteRead();
+
+	void
+	testPool();
+
+	void
+	testChaining();
+
+	void
+	testAddressNack();
+
+	void
+	testSynchronousMaster();
+
+	void
+	testDevice();
+
+	void
+	testUnbufferedMaster();
+
+	void
+	testUnbufferedDevices();
+
+	void
+	testUtilization();
+};
+
+#endif // I2C_QUEUE_TEST_HPP
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "spi_queue_test.hpp"
+
+#include <modm/architecture/interface/spi_queue.hpp>
+#include <modm-test/mock/spi_master.hpp>
+
+using SpiMaster = modm_test::platform::SpiMaster;
+using Queue = modm::SpiQueue<SpiMaster, 4>;
+
+// Chip select and configuration events in the order they happened.
+// Upper case letters select a device, lower case letters deselect it,
+// digits are calls of a configuration handler.
+static char events[32];
+static uint8_t eventCount;
+
+static void
+record(char event)
+{
+	if (eventCount < sizeof(events) - 1)
+	{
+		events[eventCount++] = event;
+		events[eventCount] = 0;
+	}
+}
+
+template< char Device >
+static void
+chipSelect(bool select)
+{ record(select ? Device : char(Device + ('a' - 'A'))); }
+
+static void configureFast() { record('1'); }
+static void configureSlow() { record('2'); }
+
+static const Queue::Target imu{&chipSelect<'I'>, configureFast, 1};
+static const Queue::Target display{&chipSelect<'D'>, configureFast};
+static const Queue::Target flash{&chipSelect<'F'>, configureSlow};
+
+void
+SpiQueueTest::setUp()
+{
+	SpiMaster::clearBuffers();
+	eventCount = 0;
+	events[0] = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+SpiQueueTest::testPriority()
+{
+	Queue queue;
+
+	const uint8_t data[] = {0xD0, 0xF0, 0xD1, 0x10};
+	queue.write(display, {data + 0, 1});
+	queue.write(flash, {data + 1, 1});
+	queue.write(display, {data + 2, 1});
+	// the imu is submitted last but transferred first, the others in order
+	queue.write(imu, {data + 3, 1});
+	TEST_ASSERT_EQUALS(queue.getPending(), 4u);
+
+	RF_CALL_BLOCKING(queue.update());
+	TEST_ASSERT_EQUALS(queue.getPending(), 0u);
+
+	uint8_t tx[4];
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 4u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expected[] = {0x10, 0xD0, 0xF0, 0xD1};
+	TEST_ASSERT_EQUALS_ARRAY(expected, tx, 4);
+}
+
+void
+SpiQueueTest::testChipSelect()
+{
+	Queue queue;
+
+	const uint8_t header[] = {0x02, 0x00, 0x10};
+	const uint8_t payload[] = {0xA0, 0xA1, 0xA2};
+	auto *request = queue.write(flash, header, payload);
+	TEST_ASSERT_TRUE(request != nullptr);
+	TEST_ASSERT_TRUE(request->isBusy());
+
+	RF_CALL_BLOCKING(queue.update());
+	TEST_ASSERT_FALSE(request->isBusy());
+	TEST_ASSERT_TRUE(queue.release(request));
+
+	// header and payload are transferred within one chip select
+	uint8_t tx[6];
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 6u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expected[] = {0x02, 0x00, 0x10, 0xA0, 0xA1, 0xA2};
+	TEST_ASSERT_EQUALS_ARRAY(expected, tx, 6);
+	TEST_ASSERT_TRUE(events[eventCount - 2] == 'F');
+	TEST_ASSERT_TRUE(events[eventCount - 1] == 'f');
+
+	// the master is released after the queue is empty
+	TEST_ASSERT_EQUALS(SpiMaster::acquire(this), 1);
+	TEST_ASSERT_EQUALS(SpiMaster::release(this), 0);
+}
+
+void
+SpiQueueTest::testConfiguration()
+{
+	Queue queue;
+
+	const uint8_t data[] = {0x01};
+	// apply the slow configuration, so that the fast one is applied below
+	auto *request = queue.write(flash, data);
+	RF_CALL_BLOCKING(queue.update());
+	queue.release(request);
+	eventCount = 0;
+
+	queue.write(imu, data);
+	queue.write(display, data);
+	queue.write(flash, data);
+	queue.write(display, data);
+	RF_CALL_BLOCKING(queue.update());
+
+	// imu and display share the configuration, it is applied once for both
+	// and again after the flash was transferred with its own configuration
+	TEST_ASSERT_EQUALS(eventCount, 11);
+	TEST_ASSERT_EQUALS_ARRAY("1IiDd2Ff1Dd", events, 11);
+	SpiMaster::clearBuffers();
+}
+
+void
+SpiQueueTest::testRead()
+{
+	Queue queue;
+
+	// the bytes received during the header are discarded
+	uint8_t rx[] = {0xFF, 0x11, 0x22, 0x33};
+	SpiMaster::appendRxBuffer(rx, 4);
+
+	const uint8_t command = 0x80 | 0x3B;
+	uint8_t data[3]{};
+	auto *request = queue.read(imu, {&command, 1}, data);
+	RF_CALL_BLOCKING(queue.update());
+	TEST_ASSERT_FALSE(request->isBusy());
+
+	const uint8_t expected[] = {0x11, 0x22, 0x33};
+	TEST_ASSERT_EQUALS_ARRAY(expected, data, 3);
+
+	// zeros are sent while reading
+	uint8_t tx[4];
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expectedTx[] = {0xBB, 0, 0, 0};
+	TEST_ASSERT_EQUALS_ARRAY(expectedTx, tx, 4);
+}
+
+void
+SpiQueueTest::testPool()
+{
+	modm::SpiQueue<SpiMaster, 2> queue;
+	const modm::SpiQueue<SpiMaster, 2>::Target device{&chipSelect<'D'>};
+
+	const uint8_t data[] = {0x01};
+	auto *first = queue.write(device, data);
+	auto *second = queue.write(device, data);
+	TEST_ASSERT_EQUALS(queue.getFree(), 0u);
+	TEST_ASSERT_TRUE(queue.write(device, data) == nullptr);
+
+	// busy requests cannot be released
+	TEST_ASSERT_FALSE(queue.release(first));
+
+	RF_CALL_BLOCKING(queue.update());
+	TEST_ASSERT_TRUE(queue.release(first));
+	TEST_ASSERT_TRUE(queue.release(second));
+	TEST_ASSERT_EQUALS(queue.getFree(), 2u);
+	TEST_ASSERT_EQUALS_ARRAY("DdDd", events, 4);
+	SpiMaster::clearBuffers();
+}
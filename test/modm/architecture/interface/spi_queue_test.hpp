@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SPI_QUEUE_TEST_HPP
+#define SPI_QUEUE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_architecture
+class SpiQueueTest : public unittest::TestSuite
+{
+public:
+	virtual void
+	setUp();
+
+	void
+	testPriority();
+
+	void
+	testChipSelect();
+
+	void
+	testConfiguration();
+
+	void
+	testRead();
+
+	void
+	testPool();
+};
+
+#endif // SPI_QUEUE_TEST_HPP
@@ -2,6 +2,7 @@
  * Copyright (c) 2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -13,6 +14,7 @@
 
 #include <unittest/type/count_type.hpp>
 #include <modm/container/dynamic_array.hpp>
+#include <unittest/benchmark.hpp>
 
 #include "dynamic_array_test.hpp"
 
@@ -324,3 +326,15 @@ DynamicArrayTest::testIteratorAccess()
 	(*it).b = 22312;
 	TEST_ASSERT_EQUALS(it->b, 22312);
 }
+
+void
+DynamicArrayTest::testBenchmark()
+{
+	modm::DynamicArray<uint16_t> array(32);
+	TEST_BENCHMARK("append", [&] {
+		array.removeAll();
+		for (uint16_t ii = 0; ii < 32; ii++) array.append(ii);
+		unittest::doNotOptimize(array.getBack());
+	});
+	TEST_ASSERT_EQUALS(array.getSize(), 32u);
+}
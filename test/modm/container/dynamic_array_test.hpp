@@ -3,6 +3,7 @@
  * Copyright (c) 2009-2010, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -64,5 +65,8 @@ public:
 	void
 	testIteratorAccess();
 
+	void
+	testBenchmark();
+
 	// TODO test decrement operator for iterators
 };
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "async_sink_test.hpp"
+
+#include <modm/debug/logger/async_sink.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <cstring>
+
+using namespace std::chrono_literals;
+using test_clock = modm_test::chrono::milli_clock;
+
+namespace
+{
+
+std::size_t
+readText(auto& sink, char* text, std::size_t size)
+{
+	std::size_t length{0};
+	while (std::size_t count = sink.read(reinterpret_cast<uint8_t*>(text + length), size - 1 - length)) {
+		length += count;
+	}
+	text[length] = 0;
+	return length;
+}
+
+bool
+writeText(auto& sink, const char* text, modm::log::Level level = modm::log::DISABLED)
+{
+	return sink.write(level, reinterpret_cast<const uint8_t*>(text), std::strlen(text));
+}
+
+}
+
+void
+AsyncSinkTest::setUp()
+{
+	test_clock::setTime(1000);
+}
+
+void
+AsyncSinkTest::testWholeRecords()
+{
+	modm::log::AsyncSink<32> sink;
+	char text[64];
+
+	TEST_ASSERT_TRUE(sink.isEmpty());
+	TEST_ASSERT_TRUE(writeText(sink, "0123456789\n"));
+	TEST_ASSERT_TRUE(writeText(sink, "abcdefghij\n"));
+	TEST_ASSERT_FALSE(sink.isEmpty());
+	// does not fit completely, so nothing of it is written
+	TEST_ASSERT_FALSE(writeText(sink, "ABCDEFGHIJ\n"));
+	TEST_ASSERT_EQUALS(readText(sink, text, sizeof(text)), 22u);
+	TEST_ASSERT_EQUALS_STRING(text, "0123456789\nabcdefghij\n");
+
+	// the report of the dropped record wraps around the end of the buffer
+	TEST_ASSERT_TRUE(writeText(sink, "x\n"));
+	auto first = sink.peek();
+	TEST_ASSERT_EQUALS(first.size(), 10u);
+	TEST_ASSERT_EQUALS(std::memcmp(first.data(), "<1 log rec", 10), 0);
+	sink.consume(first.size());
+	auto second = sink.peek();
+	TEST_ASSERT_EQUALS(second.size(), 16u);
+	TEST_ASSERT_EQUALS(std::memcmp(second.data(), "ords dropped>\nx\n", 16), 0);
+	sink.consume(second.size());
+	TEST_ASSERT_TRUE(sink.isEmpty());
+
+	const auto statistics = sink.getStatistics();
+	TEST_ASSERT_EQUALS(statistics.records, 3u);
+	TEST_ASSERT_EQUALS(statistics.overflows, 1u);
+	TEST_ASSERT_EQUALS(statistics.rateLimited, 0u);
+}
+
+void
+AsyncSinkTest::testOverflowReport()
+{
+	modm::log::AsyncSink<64> sink;
+	char text[128];
+
+	for (int ii = 0; ii < 20; ii++) writeText(sink, "0123456789\n");
+	TEST_ASSERT_EQUALS(sink.getDropped(), 15u);
+	TEST_ASSERT_EQUALS(sink.getStatistics().overflows, 15u);
+
+	// the report does not fit either, so the next record is dropped as well
+	readText(sink, text, 12);
+	TEST_ASSERT_FALSE(writeText(sink, "x\n"));
+	TEST_ASSERT_EQUALS(sink.getDropped(), 16u);
+
+	readText(sink, text, sizeof(text));
+	TEST_ASSERT_TRUE(writeText(sink, "x\n"));
+	TEST_ASSERT_EQUALS(sink.getDropped(), 0u);
+	readText(sink, text, sizeof(text));
+	TEST_ASSERT_EQUALS_STRING(text, "<16 log records dropped>\nx\n");
+}
+
+void
+AsyncSinkTest::testRateLimit()
+{
+	modm::log::AsyncSink<1024> sink;
+	char text[1024];
+
+	sink.setRateLimit(modm::log::DEBUG, 4, 100ms);
+	for (int ii = 0; ii < 10; ii++) writeText(sink, "d", modm::log::DEBUG);
+	// other levels are not limited
+	for (int ii = 0; ii < 10; ii++) TEST_ASSERT_TRUE(writeText(sink, "i", modm::log::INFO));
+	TEST_ASSERT_EQUALS(sink.getStatistics().rateLimited, 6u);
+	TEST_ASSERT_EQUALS(sink.getStatistics().overflows, 0u);
+	TEST_ASSERT_EQUALS(sink.getDropped(), 0u);
+	TEST_ASSERT_EQUALS(sink.getLimited(), 0u);
+	readText(sink, text, sizeof(text));
+	TEST_ASSERT_EQUALS_STRING(text, "dddd<6 log records rate limited>\niiiiiiiiii");
+
+	// one token is replenished every 25ms, up to the burst size
+	test_clock::increment(50);
+	TEST_ASSERT_TRUE(writeText(sink, "d", modm::log::DEBUG));
+	TEST_ASSERT_TRUE(writeText(sink, "d", modm::log::DEBUG));
+	TEST_ASSERT_FALSE(writeText(sink, "d", modm::log::DEBUG));
+	test_clock::increment(24);
+	TEST_ASSERT_FALSE(writeText(sink, "d", modm::log::DEBUG));
+	test_clock::increment(1);
+	TEST_ASSERT_TRUE(writeText(sink, "d", modm::log::DEBUG));
+	test_clock::increment(10'000);
+	for (int ii = 0; ii < 4; ii++) TEST_ASSERT_TRUE(writeText(sink, "d", modm::log::DEBUG));
+	TEST_ASSERT_FALSE(writeText(sink, "d", modm::log::DEBUG));
+
+	// removing the limit
+	sink.setRateLimit(modm::log::DEBUG, 0, 0ms);
+	for (int ii = 0; ii < 10; ii++) TEST_ASSERT_TRUE(writeText(sink, "d", modm::log::DEBUG));
+	TEST_ASSERT_EQUALS(sink.getStatistics().rateLimited, 9u);
+}
+
+void
+AsyncSinkTest::testLineDevice()
+{
+	modm::log::AsyncSink<64> sink;
+	modm::log::LineDevice<decltype(sink), 8> device(sink, modm::log::INFO);
+	char text[64];
+
+	device.write("abc");
+	TEST_ASSERT_TRUE(sink.isEmpty());
+	device.write("de\n");
+	TEST_ASSERT_EQUALS(sink.getStatistics().records, 1u);
+	// long lines are split
+	device.write("0123456789\n");
+	TEST_ASSERT_EQUALS(sink.getStatistics().records, 3u);
+	device.write("xy");
+	device.flush();
+	TEST_ASSERT_EQUALS(sink.getStatistics().records, 4u);
+	readText(sink, text, sizeof(text));
+	TEST_ASSERT_EQUALS_STRING(text, "abcde\n0123456789\nxy");
+}
+
+void
+AsyncSinkTest::testDeferredRecords()
+{
+	modm::log::AsyncSink<256> sink;
+	modm::log::DeferredLogger logger(sink);
+	uint8_t record[32];
+
+	sink.setRateLimit(modm::log::INFO, 1, 1s);
+	TEST_ASSERT_TRUE(logger.log(modm::log::INFO, "%u\n", 42u));
+	TEST_ASSERT_FALSE(logger.log(modm::log::INFO, "%u\n", 43u));
+	TEST_ASSERT_TRUE(logger.log(modm::log::ERROR, "%u\n", 44u));
+	TEST_ASSERT_EQUALS(sink.getStatistics().rateLimited, 1u);
+
+	TEST_ASSERT_EQUALS(sink.read(record, 10), 10u);
+	TEST_ASSERT_EQUALS(record[0], 0xA0 | modm::log::INFO);
+	TEST_ASSERT_EQUALS(record[1], 4u);
+	TEST_ASSERT_EQUALS(record[6], 42u);
+}
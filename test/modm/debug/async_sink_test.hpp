@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_debug
+class AsyncSinkTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testWholeRecords();
+
+	void
+	testOverflowReport();
+
+	void
+	testRateLimit();
+
+	void
+	testLineDevice();
+
+	void
+	testDeferredRecords();
+};
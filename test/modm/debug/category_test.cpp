@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "category_test.hpp"
+
+#include <modm/debug/logger/category.hpp>
+
+namespace
+{
+
+struct Sensors : modm::log::Category<Sensors, modm::log::Root, modm::log::INFO> {};
+struct Imu : modm::log::Category<Imu, Sensors> {};
+struct Gps : modm::log::Category<Gps, Sensors, modm::log::ERROR> {};
+// a lower threshold than the parent has no effect
+struct Baro : modm::log::Category<Baro, Sensors, modm::log::DEBUG> {};
+
+int evaluations{0};
+
+int
+evaluate()
+{ return ++evaluations; }
+
+}
+
+void
+CategoryTest::tearDown()
+{
+	modm::log::setLevel<modm::log::Root>(modm::log::DEBUG);
+	modm::log::setLevel<Sensors>(modm::log::DEBUG);
+	modm::log::setLevel<Imu>(modm::log::DEBUG);
+}
+
+void
+CategoryTest::testThreshold()
+{
+	static_assert(Imu::threshold == modm::log::INFO);
+	static_assert(Gps::threshold == modm::log::ERROR);
+	static_assert(Baro::threshold == modm::log::INFO);
+
+	static_assert(not modm::log::isCompiled<Imu>(modm::log::DEBUG));
+	static_assert(modm::log::isCompiled<Imu>(modm::log::INFO));
+	static_assert(not modm::log::isCompiled<Gps>(modm::log::WARNING));
+	static_assert(modm::log::isCompiled<Gps>(modm::log::ERROR));
+	static_assert(not modm::log::isCompiled<Gps>(modm::log::DISABLED));
+
+	TEST_ASSERT_FALSE(modm::log::isEnabled<Imu>(modm::log::DEBUG));
+	TEST_ASSERT_TRUE(modm::log::isEnabled<Imu>(modm::log::INFO));
+	TEST_ASSERT_TRUE(modm::log::isEnabled<modm::log::Root>(modm::log::DEBUG));
+}
+
+void
+CategoryTest::testRuntimeLevel()
+{
+	modm::log::setLevel<Imu>(modm::log::WARNING);
+	TEST_ASSERT_FALSE(modm::log::isEnabled<Imu>(modm::log::INFO));
+	TEST_ASSERT_TRUE(modm::log::isEnabled<Imu>(modm::log::WARNING));
+	// siblings are not affected
+	TEST_ASSERT_TRUE(modm::log::isEnabled<Baro>(modm::log::INFO));
+
+	// parents limit all their children
+	modm::log::setLevel<Sensors>(modm::log::ERROR);
+	TEST_ASSERT_FALSE(modm::log::isEnabled<Imu>(modm::log::WARNING));
+	TEST_ASSERT_FALSE(modm::log::isEnabled<Baro>(modm::log::WARNING));
+	TEST_ASSERT_TRUE(modm::log::isEnabled<Gps>(modm::log::ERROR));
+
+	modm::log::setLevel<modm::log::Root>(modm::log::DISABLED);
+	TEST_ASSERT_FALSE(modm::log::isEnabled<Gps>(modm::log::ERROR));
+
+	modm::log::setLevel<modm::log::Root>(modm::log::DEBUG);
+	modm::log::setLevel<Sensors>(modm::log::DEBUG);
+	TEST_ASSERT_TRUE(modm::log::isEnabled<Baro>(modm::log::INFO));
+	TEST_ASSERT_FALSE(modm::log::isEnabled<Imu>(modm::log::INFO));
+}
+
+void
+CategoryTest::testDisabledSites()
+{
+	evaluations = 0;
+	MODM_LOG_IF_ENABLED(Imu, modm::log::DEBUG) evaluate();
+	MODM_LOG_IF_ENABLED(Gps, modm::log::WARNING) evaluate();
+	TEST_ASSERT_EQUALS(evaluations, 0);
+
+	MODM_LOG_IF_ENABLED(Imu, modm::log::INFO) evaluate();
+	TEST_ASSERT_EQUALS(evaluations, 1);
+
+	modm::log::setLevel<Sensors>(modm::log::DISABLED);
+	MODM_LOG_IF_ENABLED(Imu, modm::log::ERROR) evaluate();
+	TEST_ASSERT_EQUALS(evaluations, 1);
+
+	// no dangling else
+	if (evaluations == 1) MODM_LOG_IF_ENABLED(Imu, modm::log::ERROR) evaluate();
+	else evaluations = 10;
+	TEST_ASSERT_EQUALS(evaluations, 1);
+}
@@ -4,6 +4,7 @@
  * Copyright (c) 2012, 2016, Sascha Schade
  * Copyright (c) 2012-2014, 2016-2018, Niklas Hauser
  * Copyright (c) 2013, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -57,6 +58,122 @@ struct Cs
 
 typedef modm::Ad7280a<DummySpi, Cs, modm::platform::GpioUnused, 1> Ad7280a;
 
+// ----------------------------------------------------------------------------
+/// Bitwise CRC as given in the datasheet
+static uint8_t
+referenceCrc(uint32_t data)
+{
+	auto update = [](uint8_t byte)
+	{
+		for (uint_fast8_t i = 0; i < 8; i++) {
+			byte = (byte & 0x80) ? ((byte << 1) ^ 0x2F) : (byte << 1);
+		}
+		return byte;
+	};
+	uint8_t crc = update((data >> 16) & 0xFF);
+	crc = update(crc ^ ((data >> 8) & 0xFF));
+	return crc ^ (data & 0xFF);
+}
+
+#ifndef MODM_CPU_AVR
+/**
+ * Daisy chain of eight devices, which converts all cells when the control
+ * register is written with a conversion start and shifts one result out
+ * of the chain with every following 32-bit frame.
+ */
+struct Chain
+{
+	static constexpr uint8_t devices = 8;
+
+	static inline uint32_t frames{0};
+	static inline uint32_t conversions{0};
+
+	static inline uint32_t results[devices * 6];
+	static inline uint8_t next{0};
+	static inline uint8_t pending{0};
+
+	static inline uint32_t rx{0};
+	static inline uint32_t tx{0};
+	static inline uint8_t count{0};
+
+	static uint16_t
+	cell(uint32_t conversion, uint8_t device, uint8_t channel)
+	{
+		return (conversion * 100 + device * 6 + channel) & 0xfff;
+	}
+
+	static void
+	select()
+	{
+		count = 0;
+		tx = pending ? results[next] : 0;
+	}
+
+	static void
+	deselect()
+	{
+		frames++;
+		if (pending) {
+			next++;
+			pending--;
+		}
+
+		const uint8_t reg = (rx >> 21) & 0x3f;
+		const uint8_t value = (rx >> 13) & 0xff;
+		if (rx != 0xF800030A and reg == modm::ad7280a::CTRL_HB and (value & (1 << 3))) {
+			convert();
+		}
+	}
+
+	static uint8_t
+	write(uint8_t data)
+	{
+		const uint8_t out = tx >> 24;
+		tx <<= 8;
+		rx = (rx << 8) | data;
+		count++;
+		return out;
+	}
+
+	static void
+	convert()
+	{
+		conversions++;
+		next = 0;
+		pending = 0;
+		for (uint8_t device = 0; device < devices; device++)
+		{
+			for (uint8_t channel = 0; channel < 6; channel++)
+			{
+				uint32_t frame = (uint32_t(modm::bitReverse(device)) << 24) |
+						(uint32_t(channel) << 23) |
+						(uint32_t(cell(conversions, device, channel)) << 11) | 0x400;
+				frame |= uint32_t(referenceCrc(frame >> 10)) << 2;
+				results[pending++] = frame;
+			}
+		}
+	}
+};
+
+struct ChainSpi
+{
+	static uint8_t
+	write(uint8_t data)
+	{
+		return Chain::write(data);
+	}
+};
+
+struct ChainCs
+{
+	static void set() { Chain::deselect(); }
+	static void reset() { Chain::select(); }
+	static void setOutput(bool) {}
+};
+
+typedef modm::Ad7280a<ChainSpi, ChainCs, modm::platform::GpioUnused, 8> Ad7280aChain;
+#endif
+
 // ----------------------------------------------------------------------------
 void
 Ad7280aTest::testCrcByte()
@@ -277,3 +394,61 @@ Ad7280aTest::testBalancer()
 
 	device.finish();
 }
+
+// ----------------------------------------------------------------------------
+void
+Ad7280aTest::testCrcTable()
+{
+	for (uint32_t value = 0; value < 256; value++) {
+		TEST_ASSERT_EQUALS(Ad7280a::calculateCrc(value << 16), referenceCrc(value << 16));
+	}
+	TEST_ASSERT_EQUALS(Ad7280a::calculateCrc(0x3FFFFF), referenceCrc(0x3FFFFF));
+	TEST_ASSERT_EQUALS(Ad7280a::calculateCrc(0x2AAAAA), referenceCrc(0x2AAAAA));
+}
+
+// ----------------------------------------------------------------------------
+void
+Ad7280aTest::testPipelinedScan()
+{
+#ifdef MODM_CPU_AVR
+	// the chain model does not fit into the RAM of any AVR
+	return;
+#else
+	uint16_t values[8 * 6];
+
+	// Conversion and readback: 2 register writes and 48 readback frames
+	Chain::frames = 0;
+	TEST_ASSERT_TRUE(Ad7280aChain::readAllChannels(values));
+	TEST_ASSERT_EQUALS(Chain::frames, 2u + 48u);
+	TEST_ASSERT_EQUALS(values[0], Chain::cell(Chain::conversions, 0, 0));
+	TEST_ASSERT_EQUALS(values[47], Chain::cell(Chain::conversions, 7, 5));
+
+	// The pipelined scan restarts the conversion with the last readback
+	// frame, so every following scan takes only the 48 readback frames
+	// and does not wait for the conversion.
+	Ad7280aChain::startConversion();
+	for (uint32_t scan = 0; scan < 4; scan++)
+	{
+		const uint32_t conversion = Chain::conversions;
+		Chain::frames = 0;
+		TEST_ASSERT_TRUE(Ad7280aChain::readConversions(values));
+		TEST_ASSERT_EQUALS(Chain::frames, 48u);
+		TEST_ASSERT_EQUALS(Chain::conversions, conversion + 1);
+
+		bool match = true;
+		for (uint8_t device = 0; device < 8; device++) {
+			for (uint8_t channel = 0; channel < 6; channel++) {
+				match &= (values[device * 6 + channel] == Chain::cell(conversion, device, channel));
+			}
+		}
+		TEST_ASSERT_TRUE(match);
+	}
+
+	// Without restart the chain is idle after the readback
+	const uint32_t conversion = Chain::conversions;
+	TEST_ASSERT_TRUE(Ad7280aChain::readConversions(values, false));
+	TEST_ASSERT_EQUALS(Chain::conversions, conversion);
+	TEST_ASSERT_FALSE(Ad7280aChain::readConversions(values, false));
+	TEST_ASSERT_EQUALS(values[0], 0u);
+#endif
+}
@@ -2,6 +2,7 @@
  * Copyright (c) 2009, Martin Rosekeit
  * Copyright (c) 2009-2010, 2012, Fabian Greif
  * Copyright (c) 2012, Niklas Hauser
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -43,6 +44,12 @@ public:
 
 	void
 	testBalancer();
+
+	void
+	testCrcTable();
+
+	void
+	testPipelinedScan();
 };
 
 
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "adc_stream_test.hpp"
+
+#include <modm/driver/adc/adc_stream.hpp>
+#include <modm/driver/adc/ad7928.hpp>
+#include <modm/driver/adc/ads7828.hpp>
+#include <modm/driver/adc/ads816x.hpp>
+#include <modm/driver/adc/mcp3008.hpp>
+#include <modm-test/mock/i2c_bus.hpp>
+#include <modm-test/mock/spi_master.hpp>
+
+using SpiMaster = modm_test::platform::SpiMaster;
+using I2cBus = modm_test::platform::I2cBus;
+
+// Number of chip selects, a scan of n channels needs n frames
+static uint8_t selects;
+
+struct Cs
+{
+	static void set() {}
+	static void reset() { selects++; }
+	static void setOutput(bool) {}
+};
+
+void
+AdcStreamTest::setUp()
+{
+	SpiMaster::clearBuffers();
+	selects = 0;
+}
+
+// ----------------------------------------------------------------------------
+void
+AdcStreamTest::testMcp3008Scan()
+{
+	modm::Mcp3008<SpiMaster, Cs> adc;
+	modm::adc::BlockRing<modm::adc::Block<4>, 2> ring;
+
+	using Channel = modm::mcp3008::Channel;
+	const Channel channels[] = {Channel::Ch0, Channel::Ch7, Channel::Ch2Ch3Diff};
+	adc.setScan(channels);
+
+	uint8_t rx[] = {0, 0b01, 0x23, 0, 0b11, 0xFF, 0, 0b10, 0x00};
+	SpiMaster::appendRxBuffer(rx, sizeof(rx));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(adc.readScan(ring)));
+
+	// one chip select per conversion
+	TEST_ASSERT_EQUALS(selects, 3);
+	uint8_t tx[9];
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 9u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expectedTx[] = {1, 0x80, 0, 1, 0xF0, 0, 1, 0x20, 0};
+	TEST_ASSERT_EQUALS_ARRAY(expectedTx, tx, 9);
+
+	TEST_ASSERT_EQUALS(ring.getSize(), 1u);
+	const auto values = ring.front()[0].getValues();
+	TEST_ASSERT_EQUALS(values.size(), 3u);
+	const int32_t expected[] = {0x123, 0x3FF, 0x200};
+	TEST_ASSERT_EQUALS_ARRAY(expected, values.data(), 3);
+
+	// the scan is skipped when the ring is full
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(adc.readScan(ring)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(adc.readScan(ring)));
+	TEST_ASSERT_EQUALS(ring.getOverruns(), 1u);
+	TEST_ASSERT_EQUALS(selects, 6);
+	SpiMaster::clearBuffers();
+}
+
+void
+AdcStreamTest::testAd7928Scan()
+{
+	modm::Ad7928<SpiMaster, Cs> adc;
+	modm::adc::BlockRing<modm::adc::Block<4>, 4> ring;
+
+	using SequenceChannels = modm::ad7928::SequenceChannels;
+	RF_CALL_BLOCKING(adc.startScan(SequenceChannels::Ch1 | SequenceChannels::Ch3 | SequenceChannels::Ch6));
+
+	// control register with SHADOW bit and the shadow register
+	uint8_t tx[6];
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 4u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expectedSequence[] = {0x83, 0xB0, 0x52, 0x00};
+	TEST_ASSERT_EQUALS_ARRAY(expectedSequence, tx, 4);
+
+	// the sequencer is not in phase with the scan, the results are sorted by channel id
+	uint8_t rx[] = {0x39, 0x87, 0x66, 0x66, 0x11, 0x11};
+	SpiMaster::appendRxBuffer(rx, sizeof(rx));
+	selects = 0;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(adc.readScan(ring)));
+	TEST_ASSERT_EQUALS(selects, 3);
+
+	// every frame continues the sequence
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 6u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expectedTx[] = {0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30};
+	TEST_ASSERT_EQUALS_ARRAY(expectedTx, tx, 6);
+
+	const auto values = ring.front()[0].getValues();
+	TEST_ASSERT_EQUALS(values.size(), 3u);
+	const int32_t expected[] = {0x111, 0x987, 0x666};
+	TEST_ASSERT_EQUALS_ARRAY(expected, values.data(), 3);
+}
+
+void
+AdcStreamTest::testAds7828Scan()
+{
+	// the command byte addresses the result in the register file
+	static uint8_t registers[256];
+	for (int ii = 0; ii < 256; ii++) registers[ii] = ii;
+	I2cBus::removeDevices();
+	I2cBus::attachDevice(0x48, registers, sizeof(registers));
+	I2cBus::setSynchronous(true);
+	I2cBus::resetStatistics();
+
+	modm::ads7828::Data data;
+	modm::Ads7828<I2cBus> adc(data, 0x48);
+	modm::adc::BlockRing<modm::adc::Block<4>, 4> ring;
+
+	using InputChannel = modm::ads7828::InputChannel;
+	const InputChannel channels[] = {InputChannel::Ch0, InputChannel::Ch1, InputChannel::Ch5};
+	adc.setScan(channels);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(adc.readScan(ring)));
+
+	// all conversions are chained in one transaction
+	TEST_ASSERT_EQUALS(I2cBus::getStatistics().transactions, 1u);
+	TEST_ASSERT_EQUALS(I2cBus::getStatistics().bytes, 9u);
+
+	const auto values = ring.front()[0].getValues();
+	TEST_ASSERT_EQUALS(values.size(), 3u);
+	const int32_t expected[] = {0x8081, 0xC0C1, 0xE0E1};
+	TEST_ASSERT_EQUALS_ARRAY(expected, values.data(), 3);
+
+	// a missing device fails the scan
+	adc.setAddress(0x49);
+	I2cBus::removeDevices();
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(adc.readScan(ring)));
+	TEST_ASSERT_EQUALS(ring.getSize(), 1u);
+	I2cBus::setSynchronous(false);
+}
+
+void
+AdcStreamTest::testAds816xScan()
+{
+	modm::Ads816x<SpiMaster, Cs> adc;
+	adc.setTConv(std::chrono::microseconds(0));
+	modm::adc::BlockRing<modm::adc::Block<4>, 4> ring;
+
+	RF_CALL_BLOCKING(adc.startScan(0b1010'0101));
+
+	// DATA_CNTL appends the channel id, AUTO_SEQ_CFG1 selects AIN0, 2, 5 and 7
+	uint8_t tx[15];
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 6u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expectedConfig[] = {0x08, 0x10, 0x10, 0x08, 0x80, 0xA5};
+	TEST_ASSERT_EQUALS_ARRAY(expectedConfig, tx, 6);
+
+	// the conversions do not arrive in channel order, the results are sorted by channel id
+	uint8_t rx[] = {0x00, 0x00, 0x00,
+					0x55, 0x55, 0x50,
+					0x10, 0x00, 0x00,
+					0x77, 0x77, 0x70,
+					0x22, 0x22, 0x20};
+	SpiMaster::appendRxBuffer(rx, sizeof(rx));
+	selects = 0;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(adc.readScan(ring)));
+	TEST_ASSERT_EQUALS(selects, 5);
+
+	// SEQ_START followed by one frame per channel
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 15u);
+	SpiMaster::popTxBuffer(tx);
+	const uint8_t expectedTx[15] = {0x18, 0x1E, 0x01};
+	TEST_ASSERT_EQUALS_ARRAY(expectedTx, tx, 15);
+
+	const auto values = ring.front()[0].getValues();
+	TEST_ASSERT_EQUALS(values.size(), 4u);
+	const int32_t expected[] = {0x1000, 0x2222, 0x5555, 0x7777};
+	TEST_ASSERT_EQUALS_ARRAY(expected, values.data(), 4);
+}
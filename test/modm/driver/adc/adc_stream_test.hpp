@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef ADC_STREAM_TEST_HPP
+#define ADC_STREAM_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class AdcStreamTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	testMcp3008Scan();
+
+	void
+	testAd7928Scan();
+
+	void
+	testAds7828Scan();
+
+	void
+	testAds816xScan();
+};
+
+#endif // ADC_STREAM_TEST_HPP
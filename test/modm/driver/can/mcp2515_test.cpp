@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "mcp2515_test.hpp"
+
+#include <modm/driver/can/mcp2515.hpp>
+#include <modm-test/mock/mcp2515.hpp>
+
+using namespace modm::literals;
+using Chip = modm_test::platform::Mcp2515;
+
+namespace
+{
+
+using Controller = modm::Mcp2515<Chip, Chip::ChipSelect, Chip::Interrupt, 4, 4>;
+
+constexpr uint8_t CANSTAT = 0x0E;
+constexpr uint8_t CANINTE = 0x2B;
+constexpr uint8_t RXB0CTRL = 0x60;
+
+bool
+initialize()
+{
+	Chip::reset();
+	const bool result = Controller::initialize<8_MHz, 125_kbps>();
+	Chip::resetStatistics();
+	return result;
+}
+
+modm::can::Message
+makeMessage(uint32_t identifier, uint8_t length, bool extended = false)
+{
+	modm::can::Message message(identifier, length);
+	message.setExtended(extended);
+	for (uint8_t ii = 0; ii < length; ii++) {
+		message.data[ii] = uint8_t(identifier + ii);
+	}
+	return message;
+}
+
+}
+
+void
+Mcp2515Test::testInitialize()
+{
+	TEST_ASSERT_TRUE(initialize());
+
+	// normal mode with all interrupts enabled and rollover into buffer 1
+	TEST_ASSERT_EQUALS(Chip::getRegister(CANSTAT) & 0xE0, 0x00);
+	TEST_ASSERT_EQUALS(Chip::getRegister(CANINTE), 0x3F);
+	TEST_ASSERT_EQUALS(Chip::getRegister(RXB0CTRL) & 0x04, 0x04);
+
+	TEST_ASSERT_FALSE(Controller::isMessageAvailable());
+	TEST_ASSERT_TRUE(Controller::isReadyToSend());
+	TEST_ASSERT_EQUALS(Controller::getStatistics().rxHardwareOverflows, 0u);
+	TEST_ASSERT_EQUALS(Controller::getStatistics().rxQueueOverflows, 0u);
+	TEST_ASSERT_EQUALS(Controller::getStatistics().txQueueOverflows, 0u);
+}
+
+void
+Mcp2515Test::testReceive()
+{
+	TEST_ASSERT_TRUE(initialize());
+
+	const modm::can::Message standard = makeMessage(0x123, 8);
+	modm::can::Message remote = makeMessage(0x1234567, 2, true);
+	remote.setRemoteTransmitRequest(true);
+	TEST_ASSERT_TRUE(Chip::receive(standard));
+	TEST_ASSERT_TRUE(Chip::receive(remote));
+
+	// one transaction for the flags and one bulk transfer for each frame
+	Controller::update();
+	TEST_ASSERT_EQUALS(Chip::getStatistics().framesRead, 2u);
+	TEST_ASSERT_EQUALS(Chip::getStatistics().transactions, 3u);
+	TEST_ASSERT_EQUALS(Chip::getStatistics().bulkTransfers, 3u);
+	TEST_ASSERT_TRUE(Chip::Interrupt::read());
+
+	modm::can::Message message;
+	TEST_ASSERT_TRUE(Controller::getMessage(message));
+	TEST_ASSERT_TRUE(message == standard);
+	TEST_ASSERT_TRUE(Controller::getMessage(message));
+	TEST_ASSERT_EQUALS(message.getIdentifier(), 0x1234567u);
+	TEST_ASSERT_TRUE(message.isExtended());
+	TEST_ASSERT_TRUE(message.isRemoteTransmitRequest());
+	TEST_ASSERT_EQUALS(message.getLength(), 2u);
+	TEST_ASSERT_FALSE(Controller::getMessage(message));
+	TEST_ASSERT_EQUALS(Chip::getStatistics().framesRead, 2u);
+}
+
+void
+Mcp2515Test::testReceiveOverflow()
+{
+	TEST_ASSERT_TRUE(initialize());
+
+	// both hardware buffers are full, the third frame is lost
+	TEST_ASSERT_TRUE(Chip::receive(makeMessage(1, 1)));
+	TEST_ASSERT_TRUE(Chip::receive(makeMessage(2, 1)));
+	TEST_ASSERT_FALSE(Chip::receive(makeMessage(3, 1)));
+	Controller::update();
+	TEST_ASSERT_EQUALS(Controller::getStatistics().rxHardwareOverflows, 1u);
+	TEST_ASSERT_EQUALS(Chip::getRegister(0x2D) & 0xC0, 0x00);
+	TEST_ASSERT_TRUE(Chip::Interrupt::read());
+
+	// the software queue holds four frames
+	for (uint8_t id = 4; id < 8; id++)
+	{
+		TEST_ASSERT_TRUE(Chip::receive(makeMessage(id, 1)));
+		Controller::update();
+	}
+	TEST_ASSERT_EQUALS(Controller::getStatistics().rxQueueOverflows, 2u);
+
+	modm::can::Message message;
+	for (uint8_t id : {1, 2, 4, 5})
+	{
+		TEST_ASSERT_TRUE(Controller::getMessage(message));
+		TEST_ASSERT_EQUALS(message.getIdentifier(), id);
+	}
+	TEST_ASSERT_FALSE(Controller::getMessage(message));
+
+	Controller::resetStatistics();
+	TEST_ASSERT_EQUALS(Controller::getStatistics().rxHardwareOverflows, 0u);
+	TEST_ASSERT_EQUALS(Controller::getStatistics().rxQueueOverflows, 0u);
+}
+
+void
+Mcp2515Test::testTransmitOrder()
+{
+	TEST_ASSERT_TRUE(initialize());
+
+	// each frame is loaded with a single transfer and started with RTS
+	TEST_ASSERT_TRUE(Controller::sendMessage(makeMessage(1, 7, true)));
+	TEST_ASSERT_EQUALS(Chip::getStatistics().transactions, 2u);
+	TEST_ASSERT_EQUALS(Chip::getStatistics().bulkTransfers, 1u);
+
+	// three frames are pending in the controller, two in the queue
+	for (uint32_t id = 2; id <= 5; id++) {
+		TEST_ASSERT_TRUE(Controller::sendMessage(makeMessage(id, 8 - id, id & 1)));
+	}
+	TEST_ASSERT_EQUALS(Chip::getStatistics().bulkTransfers, 3u);
+
+	// the controller sends the frames in the order they were queued
+	modm::can::Message message;
+	for (uint32_t id = 1; id <= 5; id++)
+	{
+		TEST_ASSERT_TRUE(Chip::transmit(message));
+		TEST_ASSERT_TRUE(message == makeMessage(id, 8 - id, id & 1));
+		Controller::update();
+	}
+	TEST_ASSERT_FALSE(Chip::transmit(message));
+	TEST_ASSERT_TRUE(Chip::Interrupt::read());
+	// five frames loaded and the flags read once per transmission
+	TEST_ASSERT_EQUALS(Chip::getStatistics().bulkTransfers, 5u + 5u);
+}
+
+void
+Mcp2515Test::testTransmitOverflow()
+{
+	TEST_ASSERT_TRUE(initialize());
+
+	// three transmit buffers and four queued messages
+	for (uint32_t id = 1; id <= 7; id++) {
+		TEST_ASSERT_TRUE(Controller::sendMessage(makeMessage(id, 1)));
+	}
+	TEST_ASSERT_FALSE(Controller::isReadyToSend());
+	TEST_ASSERT_FALSE(Controller::sendMessage(makeMessage(8, 1)));
+	TEST_ASSERT_EQUALS(Controller::getStatistics().txQueueOverflows, 1u);
+
+	modm::can::Message message;
+	TEST_ASSERT_TRUE(Chip::transmit(message));
+	TEST_ASSERT_EQUALS(message.getIdentifier(), 1u);
+	TEST_ASSERT_TRUE(Controller::isReadyToSend());
+}
+
+void
+Mcp2515Test::testFilter()
+{
+	using namespace modm::can;
+	TEST_ASSERT_TRUE(initialize());
+
+	// buffer 0 receives standard, buffer 1 extended frames
+	TEST_ASSERT_TRUE(Controller::setMask(0, StandardMask{0x7F0}));
+	TEST_ASSERT_TRUE(Controller::setFilter(0, StandardIdentifier{0x120}));
+	TEST_ASSERT_TRUE(Controller::setFilter(1, StandardIdentifier{0x120}));
+	TEST_ASSERT_TRUE(Controller::setMask(1, ExtendedMask{0x1FFFFFFF}));
+	for (uint8_t index = 2; index < 6; index++) {
+		TEST_ASSERT_TRUE(Controller::setFilter(index, ExtendedIdentifier{0x1234567}));
+	}
+	TEST_ASSERT_FALSE(Controller::setFilter(6, StandardIdentifier{0x120}));
+	TEST_ASSERT_FALSE(Controller::setMask(2, StandardMask{0x7FF}));
+
+	// the previous mode is restored
+	TEST_ASSERT_EQUALS(Chip::getRegister(CANSTAT) & 0xE0, 0x00);
+
+	TEST_ASSERT_TRUE(Chip::receive(makeMessage(0x123, 1)));
+	TEST_ASSERT_FALSE(Chip::receive(makeMessage(0x133, 1)));
+	TEST_ASSERT_FALSE(Chip::receive(makeMessage(0x123, 1, true)));
+	TEST_ASSERT_TRUE(Chip::receive(makeMessage(0x1234567, 1, true)));
+	TEST_ASSERT_FALSE(Chip::receive(makeMessage(0x1234566, 1, true)));
+
+	modm::can::Message message;
+	TEST_ASSERT_TRUE(Controller::getMessage(message));
+	TEST_ASSERT_EQUALS(message.getIdentifier(), 0x123u);
+	TEST_ASSERT_TRUE(Controller::getMessage(message));
+	TEST_ASSERT_EQUALS(message.getIdentifier(), 0x1234567u);
+	TEST_ASSERT_FALSE(Controller::getMessage(message));
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MCP2515_TEST_HPP
+#define MCP2515_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class Mcp2515Test : public unittest::TestSuite
+{
+public:
+	void
+	testInitialize();
+
+	void
+	testReceive();
+
+	void
+	testReceiveOverflow();
+
+	void
+	testTransmitOrder();
+
+	void
+	testTransmitOverflow();
+
+	void
+	testFilter();
+};
+
+#endif	// MCP2515_TEST_HPP
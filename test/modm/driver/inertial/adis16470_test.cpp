@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "adis16470_test.hpp"
+
+#include <modm/driver/inertial/adis16470.hpp>
+#include <modm-test/mock/clock.hpp>
+#include <modm-test/mock/spi_master.hpp>
+
+using modm::adis16470;
+using test_clock = modm_test::chrono::micro_clock;
+
+namespace
+{
+
+/// Creates a burst read response with a valid checksum
+std::array<uint8_t, adis16470::BurstSize>
+makeResponse(uint16_t diagStat, int16_t gyro, int16_t accel, int16_t temperature, uint16_t counter)
+{
+	const uint16_t words[9] = {diagStat, uint16_t(gyro), uint16_t(-gyro), 0,
+							   uint16_t(accel), 0, uint16_t(-accel), uint16_t(temperature), counter};
+	std::array<uint8_t, adis16470::BurstSize> response{};
+	uint16_t checksum = 0;
+	for (std::size_t index = 0; index < 9; index++)
+	{
+		response[2 + 2*index] = words[index] >> 8;
+		response[3 + 2*index] = words[index];
+		checksum += response[2 + 2*index] + response[3 + 2*index];
+	}
+	response[20] = checksum >> 8;
+	response[21] = checksum;
+	return response;
+}
+
+struct Cs
+{
+	static void setOutput(bool) {}
+	static void set() {}
+	static void reset() {}
+};
+
+/// Data ready signal, which toggles with every read
+struct DataReady
+{
+	static bool
+	read()
+	{ return (reads++) & 1; }
+
+	static inline uint32_t reads{0};
+};
+
+using SpiMaster = modm_test::platform::SpiMaster;
+
+}
+
+void
+Adis16470Test::testDecodeBurst()
+{
+	auto response = makeResponse(0x0002, 100, 800, 250, 42);
+	adis16470::Burst burst{};
+	TEST_ASSERT_TRUE(adis16470::decodeBurst(response, burst));
+	TEST_ASSERT_TRUE(burst.diagStat == adis16470::DiagStat::DataPathOverrun);
+	TEST_ASSERT_EQUALS(burst.gyro[0], 100);
+	TEST_ASSERT_EQUALS(burst.gyro[1], -100);
+	TEST_ASSERT_EQUALS(burst.gyro[2], 0);
+	TEST_ASSERT_EQUALS(burst.accel[0], 800);
+	TEST_ASSERT_EQUALS(burst.accel[1], 0);
+	TEST_ASSERT_EQUALS(burst.accel[2], -800);
+	TEST_ASSERT_EQUALS(burst.temperature, 250);
+	TEST_ASSERT_EQUALS(burst.counter, 42);
+
+	// the response to the command is not part of the checksum
+	response[0] = 0xff;
+	TEST_ASSERT_TRUE(adis16470::decodeBurst(response, burst));
+
+	response[9] ^= 0x10;
+	burst.counter = 0;
+	TEST_ASSERT_FALSE(adis16470::decodeBurst(response, burst));
+	TEST_ASSERT_EQUALS(burst.counter, 0);
+}
+
+void
+Adis16470Test::testConvert()
+{
+	adis16470::Burst bursts[2]{};
+	TEST_ASSERT_TRUE(adis16470::decodeBurst(makeResponse(0, 100, 800, 250, 1), bursts[0]));
+	TEST_ASSERT_TRUE(adis16470::decodeBurst(makeResponse(0, -1800, -8, -100, 2), bursts[1]));
+	bursts[1].timestamp = modm::PreciseClock::time_point{std::chrono::microseconds{500}};
+
+	adis16470::Sample samples[3]{};
+	TEST_ASSERT_EQUALS(adis16470::convert(bursts, samples), 2u);
+	TEST_ASSERT_EQUALS(adis16470::convert(bursts, std::span{samples, 1}), 1u);
+
+	// 0.1 °/s, 1.25 mg and 0.1 °C per LSB
+	TEST_ASSERT_EQUALS_FLOAT(samples[0].angularRate[0], 0.174532925f);
+	TEST_ASSERT_EQUALS_FLOAT(samples[0].angularRate[1], -0.174532925f);
+	TEST_ASSERT_EQUALS_FLOAT(samples[0].acceleration[0], 9.80665f);
+	TEST_ASSERT_EQUALS_FLOAT(samples[0].acceleration[2], -9.80665f);
+	TEST_ASSERT_EQUALS_FLOAT(samples[0].temperature, 25.f);
+	TEST_ASSERT_EQUALS(samples[0].counter, 1);
+
+	TEST_ASSERT_EQUALS_FLOAT(samples[1].angularRate[0], -3.14159265f);
+	TEST_ASSERT_EQUALS_FLOAT(samples[1].acceleration[0], -0.0980665f);
+	TEST_ASSERT_EQUALS_FLOAT(samples[1].temperature, -10.f);
+	TEST_ASSERT_EQUALS(samples[1].counter, 2);
+	TEST_ASSERT_TRUE(samples[1].timestamp == bursts[1].timestamp);
+}
+
+void
+Adis16470Test::testBurstQueue()
+{
+	adis16470::BurstQueue<4> queue;
+	TEST_ASSERT_TRUE(queue.isEmpty());
+	TEST_ASSERT_EQUALS(queue.getMaxSize(), 4u);
+
+	for (uint16_t counter = 0; counter < 3; counter++)
+	{
+		adis16470::Burst *burst = queue.reserve();
+		TEST_ASSERT_TRUE(burst != nullptr);
+		TEST_ASSERT_TRUE(adis16470::decodeBurst(makeResponse(0, 10 * counter, 0, 0, counter), *burst));
+		queue.commit();
+	}
+	queue.pop(2);
+	for (uint16_t counter = 3; counter < 6; counter++)
+	{
+		TEST_ASSERT_TRUE(adis16470::decodeBurst(makeResponse(0, 10 * counter, 0, 0, counter), *queue.reserve()));
+		queue.commit();
+	}
+	TEST_ASSERT_TRUE(queue.reserve() == nullptr);
+	TEST_ASSERT_EQUALS(queue.getOverruns(), 1u);
+
+	// the bursts are converted block by block up to the end of the buffer
+	adis16470::Sample samples[4]{};
+	std::size_t converted = 0;
+	while (not queue.isEmpty())
+	{
+		const std::size_t count = adis16470::convert(queue.front(), std::span{samples}.subspan(converted));
+		TEST_ASSERT_EQUALS(count, 2u);
+		queue.pop(count);
+		converted += count;
+	}
+	TEST_ASSERT_EQUALS(converted, 4u);
+	for (uint16_t index = 0; index < 4; index++)
+	{
+		TEST_ASSERT_EQUALS(samples[index].counter, index + 2);
+		TEST_ASSERT_EQUALS_FLOAT(samples[index].angularRate[0], (index + 2) * 0.0174532925f);
+	}
+}
+
+void
+Adis16470Test::testReadBurst()
+{
+	modm::Adis16470<SpiMaster, Cs> imu;
+	adis16470::BurstQueue<2> queue;
+	test_clock::setTime(1000);
+	SpiMaster::clearBuffers();
+	RF_CALL_BLOCKING(imu.initialize());
+
+	auto response = makeResponse(0, 100, 800, 250, 7);
+	test_clock::setTime(2000);
+	SpiMaster::appendRxBuffer(response.data(), response.size());
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(imu.readBurst<DataReady>(queue)));
+
+	// the burst command is sent in one transfer
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), adis16470::BurstSize);
+	uint8_t tx[adis16470::BurstSize];
+	SpiMaster::popTxBuffer(tx);
+	TEST_ASSERT_EQUALS(tx[0], 0x68);
+	TEST_ASSERT_EQUALS(tx[1], 0x00);
+
+	TEST_ASSERT_EQUALS(queue.getSize(), 1u);
+	const adis16470::Burst& burst = queue.front()[0];
+	TEST_ASSERT_EQUALS(burst.counter, 7);
+	TEST_ASSERT_EQUALS(burst.gyro[0], 100);
+	TEST_ASSERT_TRUE(burst.timestamp == modm::PreciseClock::time_point{std::chrono::microseconds{2000}});
+
+	// a burst with a checksum mismatch is not queued
+	response[4] ^= 0x01;
+	test_clock::setTime(3000);
+	SpiMaster::appendRxBuffer(response.data(), response.size());
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(imu.readBurst<DataReady>(queue)));
+	TEST_ASSERT_EQUALS(queue.getSize(), 1u);
+
+	// a full queue drops the burst without reading it
+	response = makeResponse(0, 100, 800, 250, 8);
+	test_clock::setTime(4000);
+	SpiMaster::appendRxBuffer(response.data(), response.size());
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(imu.readBurst<DataReady>(queue)));
+	SpiMaster::clearBuffers();
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(imu.readBurst<DataReady>(queue)));
+	TEST_ASSERT_EQUALS(SpiMaster::getTxBufferLength(), 0u);
+	TEST_ASSERT_EQUALS(queue.getOverruns(), 1u);
+	TEST_ASSERT_EQUALS(queue.getSize(), 2u);
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef ADIS16470_TEST_HPP
+#define ADIS16470_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class Adis16470Test : public unittest::TestSuite
+{
+public:
+	void
+	testDecodeBurst();
+
+	void
+	testConvert();
+
+	void
+	testBurstQueue();
+
+	void
+	testReadBurst();
+};
+
+#endif // ADIS16470_TEST_HPP
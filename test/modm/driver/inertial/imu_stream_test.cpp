@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "imu_stream_test.hpp"
+
+#include <modm/driver/inertial/imu_stream.hpp>
+#include <modm/driver/inertial/bmi088.hpp>
+#include <modm/driver/inertial/ixm42xxx.hpp>
+#include <modm/driver/inertial/lsm6dso.hpp>
+
+#include <cstring>
+
+namespace
+{
+
+constexpr uint8_t TagGyroscope = 0x01;
+constexpr uint8_t TagAccelerometer = 0x02;
+constexpr uint8_t TagTemperature = 0x03;
+constexpr uint8_t TagTimestamp = 0x04;
+constexpr uint8_t TagConfigChange = 0x05;
+
+/// Writes a tagged LSM6DSO FIFO word and returns the next word
+uint8_t*
+writeWord(uint8_t *word, uint8_t tag, uint8_t slot, int16_t x, int16_t y = 0, int16_t z = 0)
+{
+	word[0] = tag << 3 | (slot & 0b11) << 1;
+	const int16_t values[3] = {x, y, z};
+	for (uint8_t axis = 0; axis < 3; axis++)
+	{
+		word[1 + 2*axis] = uint16_t(values[axis]);
+		word[2 + 2*axis] = uint16_t(values[axis]) >> 8;
+	}
+	return word + modm::lsm6dso::FifoWordSize;
+}
+
+/// Writes an IXM42xxx FIFO packet with 8-bit temperature and returns the next packet
+uint8_t*
+writePacket(uint8_t *packet, uint8_t header, int16_t accel, int16_t gyro, int8_t temp, uint16_t timestamp)
+{
+	*packet++ = header;
+	for (const int16_t value : {accel, int16_t(accel + 1), int16_t(accel + 2),
+								gyro, int16_t(gyro + 1), int16_t(gyro + 2)})
+	{
+		std::memcpy(packet, &value, 2);
+		packet += 2;
+	}
+	*packet++ = temp;
+	if (header & 0x08)
+	{
+		std::memcpy(packet, &timestamp, 2);
+		packet += 2;
+	}
+	return packet;
+}
+
+}
+
+void
+ImuStreamTest::testTimeline()
+{
+	// 16-bit counter with 1 µs resolution
+	modm::imu::Timeline timeline(16, 1, 1, 100);
+	TEST_ASSERT_EQUALS(timeline.update(65530), 65530u);
+	// the counter wraps around
+	TEST_ASSERT_EQUALS(timeline.update(4), 65540u);
+	TEST_ASSERT_EQUALS(timeline.next(), 65640u);
+	TEST_ASSERT_EQUALS(timeline.next(), 65740u);
+	TEST_ASSERT_EQUALS(timeline.update(204), 65740u);
+
+	// continues at the current time after a reset
+	timeline.reset();
+	TEST_ASSERT_EQUALS(timeline.update(1000), 65740u);
+	TEST_ASSERT_EQUALS(timeline.update(1010), 65750u);
+
+	// 24-bit counter with 39.0625 µs resolution
+	modm::imu::Timeline sensortime(24, 625, 16, 625);
+	TEST_ASSERT_EQUALS(sensortime.update(256), 10'000u);
+	TEST_ASSERT_EQUALS(sensortime.update(0xff'ffff), 655'359'960u);
+	TEST_ASSERT_EQUALS(sensortime.update(0), 655'360'000u);
+}
+
+void
+ImuStreamTest::testStream()
+{
+	modm::imu::FifoStream<modm::lsm6dso::FifoDecoder, 7*12, 4> stream{1000};
+	TEST_ASSERT_TRUE(stream.isEmpty());
+	TEST_ASSERT_TRUE(stream.read() == nullptr);
+
+	// first burst ends after the gyroscope word of the sixth slot
+	std::span<uint8_t> burst = stream.beginBurst();
+	TEST_ASSERT_EQUALS(burst.size(), 7u*12);
+	uint8_t *word = burst.data();
+	for (uint8_t slot = 0; slot < 6; slot++)
+	{
+		word = writeWord(word, TagGyroscope, slot, slot, -slot, 100);
+		if (slot < 5) word = writeWord(word, TagAccelerometer, slot, 10 * slot, 1, -1);
+	}
+	stream.endBurst(word - burst.data());
+	TEST_ASSERT_FALSE(stream.isEmpty());
+
+	// second burst continues with the accelerometer word of the sixth slot
+	burst = stream.beginBurst();
+	TEST_ASSERT_EQUALS(burst.size(), 7u*12);
+	word = writeWord(burst.data(), TagAccelerometer, 5, 50);
+	word = writeWord(word, TagGyroscope, 6, 6);
+	word = writeWord(word, TagAccelerometer, 6, 60);
+	stream.endBurst(word - burst.data());
+
+	// the first burst does not fit into one batch
+	auto *batch = stream.read();
+	TEST_ASSERT_TRUE(batch != nullptr);
+	TEST_ASSERT_EQUALS(batch->size, 4u);
+	for (uint8_t sample = 0; sample < 4; sample++)
+	{
+		TEST_ASSERT_EQUALS(batch->getTimestamps()[sample], 1000u * (sample + 1));
+		TEST_ASSERT_EQUALS(batch->getGyro(0)[sample], sample);
+		TEST_ASSERT_EQUALS(batch->getGyro(1)[sample], -sample);
+		TEST_ASSERT_EQUALS(batch->getGyro(2)[sample], 100);
+		TEST_ASSERT_EQUALS(batch->getAccel(0)[sample], 10 * sample);
+		TEST_ASSERT_EQUALS(batch->getAccel(1)[sample], 1);
+		TEST_ASSERT_EQUALS(batch->getAccel(2)[sample], -1);
+	}
+
+	batch = stream.read();
+	TEST_ASSERT_TRUE(batch != nullptr);
+	TEST_ASSERT_EQUALS(batch->size, 2u);
+	TEST_ASSERT_EQUALS(batch->timestamp[0], 5000u);
+	TEST_ASSERT_EQUALS(batch->timestamp[1], 6000u);
+	TEST_ASSERT_EQUALS(batch->gyro[0][1], 5);
+	TEST_ASSERT_EQUALS(batch->accel[0][1], 0);
+
+	// the sixth slot keeps its time across the bursts
+	batch = stream.read();
+	TEST_ASSERT_TRUE(batch != nullptr);
+	TEST_ASSERT_EQUALS(batch->size, 2u);
+	TEST_ASSERT_EQUALS(batch->timestamp[0], 6000u);
+	TEST_ASSERT_EQUALS(batch->accel[0][0], 50);
+	TEST_ASSERT_EQUALS(batch->timestamp[1], 7000u);
+	TEST_ASSERT_EQUALS(batch->gyro[0][1], 6);
+	TEST_ASSERT_EQUALS(batch->accel[0][1], 60);
+
+	TEST_ASSERT_TRUE(stream.read() == nullptr);
+	TEST_ASSERT_TRUE(stream.isEmpty());
+	TEST_ASSERT_EQUALS(stream.getOverruns(), 0u);
+}
+
+void
+ImuStreamTest::testStreamOverrun()
+{
+	modm::imu::FifoStream<modm::bmi088::GyroFifoDecoder, 12, 8> stream{500};
+
+	for (uint8_t index = 0; index < 2; index++)
+	{
+		std::span<uint8_t> burst = stream.beginBurst();
+		TEST_ASSERT_EQUALS(burst.size(), 12u);
+		std::fill(burst.begin(), burst.end(), index);
+		stream.endBurst(burst.size());
+	}
+	// both bursts are filled
+	TEST_ASSERT_TRUE(stream.beginBurst().empty());
+	TEST_ASSERT_EQUALS(stream.getOverruns(), 1u);
+
+	auto *batch = stream.read();
+	TEST_ASSERT_TRUE(batch != nullptr);
+	TEST_ASSERT_EQUALS(batch->size, 2u);
+	TEST_ASSERT_EQUALS(batch->timestamp[1], 1000u);
+	TEST_ASSERT_EQUALS(batch->gyro[2][1], 0);
+
+	// the first burst is released after it was decoded
+	std::span<uint8_t> burst = stream.beginBurst();
+	TEST_ASSERT_EQUALS(burst.size(), 12u);
+	std::fill(burst.begin(), burst.end(), 2);
+	// a cut off frame is not decoded
+	stream.endBurst(9);
+
+	batch = stream.read();
+	TEST_ASSERT_TRUE(batch != nullptr);
+	TEST_ASSERT_EQUALS(batch->size, 2u);
+	TEST_ASSERT_EQUALS(batch->gyro[2][1], 0x0101);
+
+	batch = stream.read();
+	TEST_ASSERT_TRUE(batch != nullptr);
+	TEST_ASSERT_EQUALS(batch->size, 1u);
+	TEST_ASSERT_EQUALS(batch->timestamp[0], 2500u);
+	TEST_ASSERT_EQUALS(batch->gyro[0][0], 0x0202);
+
+	TEST_ASSERT_TRUE(stream.read() == nullptr);
+	TEST_ASSERT_EQUALS(stream.getOverruns(), 1u);
+}
+
+void
+ImuStreamTest::testLsm6dsoTimestamp()
+{
+	modm::lsm6dso::FifoDecoder decoder{1000};
+	modm::imu::SampleBatch<4> batch;
+
+	uint8_t data[7*7];
+	uint8_t *word = writeWord(data, TagTimestamp, 0, 400, 0);
+	word = writeWord(word, TagGyroscope, 0, 1);
+	word = writeWord(word, TagConfigChange, 0, 0);
+	word = writeWord(word, TagGyroscope, 1, 2);
+	word = writeWord(word, TagGyroscope, 2, 3);
+	word = writeWord(word, TagTemperature, 2, 250);
+	// the timestamp overrides the time of its slot
+	word = writeWord(word, TagTimestamp, 3, 530, 0);
+
+	TEST_ASSERT_EQUALS(decoder.decode(data, batch), sizeof(data));
+	TEST_ASSERT_EQUALS(batch.size, 4u);
+	// the timestamp counts in units of 25 µs
+	TEST_ASSERT_EQUALS(batch.timestamp[0], 10'000u);
+	TEST_ASSERT_EQUALS(batch.timestamp[1], 11'000u);
+	TEST_ASSERT_EQUALS(batch.timestamp[2], 12'000u);
+	TEST_ASSERT_EQUALS(batch.timestamp[3], 13'250u);
+	TEST_ASSERT_EQUALS(batch.gyro[0][0], 1);
+	TEST_ASSERT_EQUALS(batch.gyro[0][1], 2);
+	TEST_ASSERT_EQUALS(batch.gyro[0][2], 3);
+	TEST_ASSERT_EQUALS(batch.temperature[1], 0);
+	TEST_ASSERT_EQUALS(batch.temperature[2], 250);
+	TEST_ASSERT_EQUALS(decoder.getTimeline().getTime(), 13'250u);
+}
+
+void
+ImuStreamTest::testIxm42xxxDecoder()
+{
+	modm::ixm42xxxdata::FifoDecoder decoder{1, 500};
+	modm::imu::SampleBatch<4> batch;
+
+	// accel, gyro and ODR timestamp
+	static_assert(modm::ixm42xxxdata::FifoPacket::getSize(0x68) == 16);
+	static_assert(modm::ixm42xxxdata::FifoPacket::getSize(0x60) == 14);
+	static_assert(modm::ixm42xxxdata::FifoPacket::getSize(0x78) == 20);
+
+	uint8_t data[16 + 14 + 8];
+	uint8_t *packet = writePacket(data, 0x68, 100, -100, 25, 1000);
+	packet = writePacket(packet, 0x60, 200, -200, 26, 0);
+	// incomplete packet
+	std::fill(packet, std::end(data), 0x68);
+
+	TEST_ASSERT_EQUALS(decoder.decode(data, batch), 30u);
+	TEST_ASSERT_EQUALS(batch.size, 2u);
+	TEST_ASSERT_EQUALS(batch.timestamp[0], 1000u);
+	TEST_ASSERT_EQUALS(batch.timestamp[1], 1500u);
+	TEST_ASSERT_EQUALS(batch.accel[0][0], 100);
+	TEST_ASSERT_EQUALS(batch.accel[2][0], 102);
+	TEST_ASSERT_EQUALS(batch.gyro[1][0], -99);
+	TEST_ASSERT_EQUALS(batch.accel[0][1], 200);
+	TEST_ASSERT_EQUALS(batch.gyro[2][1], -198);
+	TEST_ASSERT_EQUALS(batch.temperature[0], 25);
+	TEST_ASSERT_EQUALS(batch.temperature[1], 26);
+
+	// an empty FIFO is read as 0xFF
+	batch.clear();
+	std::fill(std::begin(data), std::end(data), 0xFF);
+	TEST_ASSERT_EQUALS(decoder.decode(data, batch), sizeof(data));
+	TEST_ASSERT_EQUALS(batch.size, 0u);
+}
+
+void
+ImuStreamTest::testBmi088Decoder()
+{
+	modm::bmi088::AccFifoDecoder decoder{625};
+	modm::imu::SampleBatch<4> batch;
+
+	const uint8_t data[] = {
+		0x84, 1, 0, 2, 0, 0xfd, 0xff,
+		0x85, 4, 0, 5, 0, 6, 0,
+		// skip frame
+		0x40, 1,
+		0x86, 7, 0, 0, 1, 9, 0,
+		// sensortime frame
+		0x44, 0x00, 0x01, 0x00,
+		// overread
+		0x80, 0x00, 0x80, 0x00,
+	};
+	TEST_ASSERT_EQUALS(decoder.decode(data, batch), sizeof(data));
+	TEST_ASSERT_EQUALS(batch.size, 3u);
+	// the sensortime is the time of the last sample
+	TEST_ASSERT_EQUALS(batch.timestamp[0], 8750u);
+	TEST_ASSERT_EQUALS(batch.timestamp[1], 9375u);
+	TEST_ASSERT_EQUALS(batch.timestamp[2], 10'000u);
+	TEST_ASSERT_EQUALS(batch.accel[0][0], 1);
+	TEST_ASSERT_EQUALS(batch.accel[2][0], -3);
+	TEST_ASSERT_EQUALS(batch.accel[1][1], 5);
+	TEST_ASSERT_EQUALS(batch.accel[1][2], 256);
+
+	// a cut off frame is read again with the next burst
+	batch.clear();
+	TEST_ASSERT_EQUALS(decoder.decode(std::span{data, 10}, batch), 7u);
+	TEST_ASSERT_EQUALS(batch.size, 1u);
+	TEST_ASSERT_EQUALS(batch.timestamp[0], 10'625u);
+
+	modm::bmi088::GyroFifoDecoder gyroDecoder{500};
+	batch.clear();
+	TEST_ASSERT_EQUALS(gyroDecoder.decode(std::span{data, 16}, batch), 12u);
+	TEST_ASSERT_EQUALS(batch.size, 2u);
+	TEST_ASSERT_EQUALS(batch.timestamp[1], 1000u);
+	TEST_ASSERT_EQUALS(batch.gyro[0][0], 0x0184);
+	TEST_ASSERT_EQUALS(batch.gyro[2][1], 0x0005);
+}
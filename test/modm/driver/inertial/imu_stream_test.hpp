@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef IMU_STREAM_TEST_HPP
+#define IMU_STREAM_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class ImuStreamTest : public unittest::TestSuite
+{
+public:
+	void
+	testTimeline();
+
+	void
+	testStream();
+
+	void
+	testStreamOverrun();
+
+	void
+	testLsm6dsoTimestamp();
+
+	void
+	testIxm42xxxDecoder();
+
+	void
+	testBmi088Decoder();
+};
+
+#endif // IMU_STREAM_TEST_HPP
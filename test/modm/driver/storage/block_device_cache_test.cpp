@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_cache_test.hpp"
+
+#include <modm/driver/storage/block_device_cache.hpp>
+#include <modm/driver/storage/block_device_heap.hpp>
+#include <cstring>
+
+namespace
+{
+
+/// RAM block device with page programming that counts device accesses
+class CountingDevice : public modm::BdHeap<8 * 1024>
+{
+public:
+	static constexpr bd_size_t BlockSizeWrite = 64;
+	static constexpr bd_size_t BlockSizeErase = 256;
+
+	static inline uint32_t reads;
+	static inline uint32_t programs;
+	static inline uint32_t programmed;
+
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		reads++;
+		return BdHeap::read(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		if (address % BlockSizeWrite or size % BlockSizeWrite) return false;
+		programs++;
+		programmed += size;
+		return BdHeap::program(buffer, address, size);
+	}
+};
+
+using Cache = modm::BdCache<CountingDevice, 4, 256>;
+
+}
+
+void
+BlockDeviceCacheTest::testReadHitMiss()
+{
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+	CountingDevice::reads = 0;
+
+	uint8_t buffer[16];
+	TEST_ASSERT_TRUE(cache.read(buffer, 0, 16));
+	TEST_ASSERT_TRUE(cache.read(buffer, 16, 16));
+	TEST_ASSERT_TRUE(cache.read(buffer, 250, 12));
+	TEST_ASSERT_EQUALS(cache.getStatistics().misses, 2u);
+	TEST_ASSERT_EQUALS(cache.getStatistics().hits, 2u);
+	// the second line directly follows the first miss and triggers a read-ahead
+	TEST_ASSERT_EQUALS(cache.getStatistics().readAheads, 1u);
+	TEST_ASSERT_EQUALS(CountingDevice::reads, 3u);
+
+	// reading five other lines evicts the least recently used line
+	for (uint32_t line = 2; line < 7; line++) {
+		TEST_ASSERT_TRUE(cache.read(buffer, line * 1024, 1));
+	}
+	cache.resetStatistics();
+	TEST_ASSERT_TRUE(cache.read(buffer, 0, 1));
+	TEST_ASSERT_EQUALS(cache.getStatistics().misses, 1u);
+	TEST_ASSERT_FALSE(cache.read(buffer, Cache::DeviceSize - 8, 16));
+}
+
+void
+BlockDeviceCacheTest::testReadAhead()
+{
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+
+	uint8_t buffer[64];
+	for (uint32_t address = 0; address < 4096; address += sizeof(buffer)) {
+		TEST_ASSERT_TRUE(cache.read(buffer, address, sizeof(buffer)));
+	}
+	// every other line of the sequential scan is read ahead
+	TEST_ASSERT_EQUALS(cache.getStatistics().misses, 9u);
+	TEST_ASSERT_EQUALS(cache.getStatistics().readAheads, 8u);
+	TEST_ASSERT_EQUALS(cache.getStatistics().hits, 55u);
+}
+
+void
+BlockDeviceCacheTest::testWriteCoalescing()
+{
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+	CountingDevice::programs = 0;
+
+	// byte-wise programs are buffered until the line is flushed
+	for (uint8_t ii = 0; ii < 100; ii++) {
+		TEST_ASSERT_TRUE(cache.program(&ii, 10 + ii, 1));
+	}
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 0u);
+
+	uint8_t buffer[100];
+	TEST_ASSERT_TRUE(cache.read(buffer, 10, 100));
+	TEST_ASSERT_EQUALS(buffer[0], 0);
+	TEST_ASSERT_EQUALS(buffer[99], 99);
+
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 1u);
+	TEST_ASSERT_EQUALS(cache.getStatistics().writeBacks, 1u);
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(buffer, 10, 100));
+	TEST_ASSERT_EQUALS(buffer[0], 0);
+	TEST_ASSERT_EQUALS(buffer[99], 99);
+
+	// nothing left to write back
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 1u);
+
+	// evicting a dirty line writes it back
+	TEST_ASSERT_TRUE(cache.program(buffer, 2048, 16));
+	for (uint32_t line = 0; line < 4; line++) {
+		TEST_ASSERT_TRUE(cache.read(buffer, 4096 + line * 256, 1));
+	}
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 2u);
+}
+
+void
+BlockDeviceCacheTest::testWriteEviction()
+{
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+	CountingDevice::programs = 0;
+
+	// fill all lines with buffered data outside of the written range
+	uint8_t pattern[256];
+	for (uint32_t line = 0; line < 4; line++)
+	{
+		std::memset(pattern, line, sizeof(pattern));
+		TEST_ASSERT_TRUE(cache.program(pattern, line * 256 + 64, 64));
+	}
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 0u);
+
+	// writing a new line evicts the least recently used dirty line
+	std::memset(pattern, 0xa5, sizeof(pattern));
+	TEST_ASSERT_TRUE(cache.write(pattern, 4096, 256));
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 1u);
+	TEST_ASSERT_EQUALS(cache.getStatistics().writeBacks, 1u);
+
+	uint8_t buffer[64];
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(buffer, 64, 64));
+	TEST_ASSERT_EQUALS(buffer[0], 0);
+	TEST_ASSERT_EQUALS(buffer[63], 0);
+
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 5u);
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(buffer, 4096 + 192, 64));
+	TEST_ASSERT_EQUALS(buffer[0], 0xa5);
+	TEST_ASSERT_EQUALS(buffer[63], 0xa5);
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(buffer, 3 * 256 + 64, 64));
+	TEST_ASSERT_EQUALS(buffer[0], 3);
+}
+
+void
+BlockDeviceCacheTest::testWriteBlocks()
+{
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+	CountingDevice::programs = 0;
+	CountingDevice::programmed = 0;
+
+	// programs in the first and the last write block of a line
+	const uint8_t data[4]{1, 2, 3, 4};
+	TEST_ASSERT_TRUE(cache.program(data, 1024 + 10, 4));
+	TEST_ASSERT_TRUE(cache.program(data, 1024 + 250, 4));
+	// and across the boundary of two write blocks of another line
+	TEST_ASSERT_TRUE(cache.program(data, 2048 + 62, 4));
+
+	// only the dirty write blocks are programmed, consecutive ones together
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 3u);
+	TEST_ASSERT_EQUALS(CountingDevice::programmed, 4 * 64u);
+	TEST_ASSERT_EQUALS(cache.getStatistics().writeBacks, 2u);
+
+	uint8_t buffer[4];
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(buffer, 1024 + 250, 4));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, 4);
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(buffer, 2048 + 62, 4));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, data, 4);
+}
+
+void
+BlockDeviceCacheTest::testErase()
+{
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+	CountingDevice::programs = 0;
+
+	uint8_t pattern[512];
+	std::memset(pattern, 0x5a, sizeof(pattern));
+	TEST_ASSERT_TRUE(cache.program(pattern, 0, sizeof(pattern)));
+	TEST_ASSERT_FALSE(cache.erase(0, 100));
+
+	// the buffered data of erased lines is discarded
+	TEST_ASSERT_TRUE(cache.erase(0, 256));
+	TEST_ASSERT_TRUE(cache.flush());
+	TEST_ASSERT_EQUALS(CountingDevice::programs, 1u);
+
+	uint8_t buffer[4];
+	TEST_ASSERT_TRUE(cache.read(buffer, 256, 4));
+	TEST_ASSERT_EQUALS(buffer[0], 0x5a);
+}
+
+void
+BlockDeviceCacheTest::testRandomAccess()
+{
+	// compare the cache against the uncached device for random accesses
+	static uint8_t reference[CountingDevice::DeviceSize];
+	Cache cache;
+	TEST_ASSERT_TRUE(cache.initialize());
+	std::memset(reference, 0, sizeof(reference));
+
+	uint32_t seed{42};
+	const auto random = [&seed](uint32_t limit) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 8) % limit;
+	};
+
+	uint8_t buffer[300];
+	for (uint32_t ii = 0; ii < 2000; ii++)
+	{
+		const uint32_t size = 1 + random(sizeof(buffer));
+		const uint32_t address = random(CountingDevice::DeviceSize - size);
+		if (random(2))
+		{
+			for (uint32_t jj = 0; jj < size; jj++) buffer[jj] = random(256);
+			TEST_ASSERT_TRUE(cache.program(buffer, address, size));
+			std::memcpy(reference + address, buffer, size);
+		}
+		else
+		{
+			TEST_ASSERT_TRUE(cache.read(buffer, address, size));
+			TEST_ASSERT_EQUALS_ARRAY(buffer, reference + address, size);
+		}
+	}
+
+	TEST_ASSERT_TRUE(cache.flush());
+	uint8_t content[CountingDevice::DeviceSize];
+	TEST_ASSERT_TRUE(cache.getBlockDevice().read(content, 0, sizeof(content)));
+	TEST_ASSERT_EQUALS_ARRAY(content, reference, sizeof(content));
+}
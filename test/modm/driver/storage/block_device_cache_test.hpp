@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef BLOCK_DEVICE_CACHE_TEST_HPP
+#define BLOCK_DEVICE_CACHE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class BlockDeviceCacheTest : public unittest::TestSuite
+{
+public:
+	void
+	testReadHitMiss();
+
+	void
+	testReadAhead();
+
+	void
+	testWriteCoalescing();
+
+	void
+	testWriteEviction();
+
+	void
+	testWriteBlocks();
+
+	void
+	testErase();
+
+	void
+	testRandomAccess();
+};
+
+#endif	// BLOCK_DEVICE_CACHE_TEST_HPP
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_mapped_file_test.hpp"
+
+#include <modm/driver/storage/block_device_mapped_file.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+struct TestFile
+{
+	static constexpr const char* name = "mapped_file_test.bin~";
+};
+
+constexpr size_t DeviceSize{4096};
+constexpr size_t EraseSize{1024};
+
+template< modm::BdSync Sync, size_t NorEraseSize = 0 >
+using Device = modm::BdMappedFile<TestFile, DeviceSize, Sync, NorEraseSize>;
+using NorDevice = Device<modm::BdSync::Never, EraseSize>;
+// a copy would unmap and close the file twice
+static_assert(not std::is_copy_constructible_v<NorDevice> and not std::is_copy_assignable_v<NorDevice>);
+
+uint8_t buffer[DeviceSize];
+uint8_t pattern[DeviceSize];
+
+void
+fillPattern(uint8_t seed)
+{
+	for (uint16_t ii = 0; ii < sizeof(pattern); ii++) {
+		pattern[ii] = uint8_t(ii * 7 + seed);
+	}
+}
+
+/// Reads the file through the file system instead of the mapping
+std::vector<uint8_t>
+readFile()
+{
+	std::ifstream file(TestFile::name, std::ios::binary);
+	return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+bool
+fileEquals(size_t offset, const uint8_t* data, size_t size)
+{
+	const auto content = readFile();
+	return content.size() == DeviceSize and std::memcmp(content.data() + offset, data, size) == 0;
+}
+
+/// Content written before each sync point must be in the file afterwards
+template< modm::BdSync Sync >
+void
+testSync(bool persistsOnWrite)
+{
+	fillPattern(Sync == modm::BdSync::OnWrite ? 3 : 5);
+	{
+		Device<Sync> device;
+		TEST_ASSERT_FALSE(device.sync());
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(pattern, 0, 512)));
+		if (persistsOnWrite) {
+			TEST_ASSERT_TRUE(fileEquals(0, pattern, 512));
+		}
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.write(pattern + 512, 512, 512)));
+		TEST_ASSERT_TRUE(device.sync());
+		TEST_ASSERT_TRUE(fileEquals(0, pattern, 1024));
+
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(pattern + 1024, 1024, 1024)));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.deinitialize()));
+		TEST_ASSERT_TRUE(device.getMemory() == nullptr);
+		TEST_ASSERT_FALSE(device.sync());
+		TEST_ASSERT_TRUE(fileEquals(0, pattern, 2048));
+		// the destructor must not unmap again
+	}
+
+	// the content is mapped again from the existing file
+	Device<Sync> device;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 0, 2048)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, pattern, 2048);
+	TEST_ASSERT_EQUALS(device.getMemory()[2047], pattern[2047]);
+}
+
+}
+
+void
+BlockDeviceMappedFileTest::setUp()
+{
+	std::remove(TestFile::name);
+}
+
+void
+BlockDeviceMappedFileTest::tearDown()
+{
+	std::remove(TestFile::name);
+}
+
+void
+BlockDeviceMappedFileTest::testCreate()
+{
+	{
+		Device<modm::BdSync::Never> device;
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.initialize()));
+		// a new file is zero filled
+		TEST_ASSERT_EQUALS(readFile().size(), DeviceSize);
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 0, DeviceSize)));
+		TEST_ASSERT_EQUALS(buffer[0], 0);
+		TEST_ASSERT_EQUALS(buffer[DeviceSize - 1], 0);
+
+		// without NOR simulation programming overwrites the content
+		fillPattern(1);
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(pattern, 100, 10)));
+		fillPattern(2);
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.program(pattern, 100, 10)));
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.read(buffer, 100, 10)));
+		TEST_ASSERT_EQUALS_ARRAY(buffer, pattern, 10);
+		// and erasing leaves it undefined
+		TEST_ASSERT_TRUE(RF_CALL_BLOCKING(device.erase(100, 1)));
+	}
+
+	// a file of a different size is not mapped
+	modm::BdMappedFile<TestFile, 2 * DeviceSize> other;
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(other.initialize()));
+	TEST_ASSERT_TRUE(other.getMemory() == nullptr);
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(other.read(buffer, 0, 1)));
+
+	// a new flash device starts out erased
+	std::remove(TestFile::name);
+	NorDevice flash;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.initialize()));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.read(buffer, 0, DeviceSize)));
+	TEST_ASSERT_EQUALS(buffer[0], 0xff);
+	TEST_ASSERT_EQUALS(buffer[DeviceSize - 1], 0xff);
+}
+
+void
+BlockDeviceMappedFileTest::testNorProgram()
+{
+	NorDevice flash;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.initialize()));
+
+	const uint8_t first[4]{0xf0, 0x0f, 0xaa, 0xff};
+	const uint8_t second[4]{0x3c, 0x3c, 0x55, 0x81};
+	const uint8_t result[4]{0x30, 0x0c, 0x00, 0x81};
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.program(first, 10, 4)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.read(buffer, 10, 4)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, first, 4);
+
+	// programming again without erasing can only clear bits
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.program(second, 10, 4)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.read(buffer, 10, 4)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, result, 4);
+	TEST_ASSERT_EQUALS_ARRAY(flash.getMemory() + 10, result, 4);
+
+	// the neighbouring bytes are still erased
+	TEST_ASSERT_EQUALS(flash.getMemory()[9], 0xff);
+	TEST_ASSERT_EQUALS(flash.getMemory()[14], 0xff);
+
+	// write erases before programming
+	fillPattern(7);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.write(pattern, 0, EraseSize)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.read(buffer, 0, EraseSize)));
+	TEST_ASSERT_EQUALS_ARRAY(buffer, pattern, EraseSize);
+}
+
+void
+BlockDeviceMappedFileTest::testNorErase()
+{
+	NorDevice flash;
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.initialize()));
+	TEST_ASSERT_EQUALS(NorDevice::BlockSizeErase, EraseSize);
+
+	std::memset(pattern, 0, sizeof(pattern));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.program(pattern, 0, DeviceSize)));
+
+	// erasing sets whole erase blocks to 0xff
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.erase(EraseSize, 2 * EraseSize)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.read(buffer, 0, DeviceSize)));
+	TEST_ASSERT_EQUALS(buffer[EraseSize - 1], 0);
+	for (size_t ii = EraseSize; ii < 3 * EraseSize; ii++) {
+		TEST_ASSERT_EQUALS(buffer[ii], 0xff);
+	}
+	TEST_ASSERT_EQUALS(buffer[3 * EraseSize], 0);
+
+	// only whole erase blocks can be erased
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.erase(0, EraseSize / 2)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.erase(EraseSize / 2, EraseSize)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.write(pattern, 0, EraseSize / 2)));
+	TEST_ASSERT_EQUALS(flash.getMemory()[0], 0);
+}
+
+void
+BlockDeviceMappedFileTest::testRange()
+{
+	NorDevice flash;
+	// nothing is accessible before the file is mapped
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.read(buffer, 0, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.program(pattern, 0, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.erase(0, EraseSize)));
+	TEST_ASSERT_FALSE(flash.advise(NorDevice::Advice::Sequential));
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.initialize()));
+	TEST_ASSERT_TRUE(flash.advise(NorDevice::Advice::Sequential));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.read(buffer, DeviceSize - 1, 1)));
+
+	// accesses beyond the end of the device are rejected
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.read(buffer, DeviceSize - 1, 2)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.read(buffer, DeviceSize, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.program(pattern, DeviceSize - 1, 2)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.erase(DeviceSize, EraseSize)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.erase(DeviceSize - EraseSize, 2 * EraseSize)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.write(pattern, DeviceSize - EraseSize, 2 * EraseSize)));
+	TEST_ASSERT_FALSE(flash.advise(NorDevice::Advice::Random, DeviceSize - 1, 2));
+
+	// empty accesses are rejected too
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.read(buffer, 0, 0)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.program(pattern, 0, 0)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.erase(0, 0)));
+
+	// the rejected program did not touch the last byte
+	TEST_ASSERT_EQUALS(flash.getMemory()[DeviceSize - 1], 0xff);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(flash.deinitialize()));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(flash.read(buffer, 0, 1)));
+}
+
+void
+BlockDeviceMappedFileTest::testSyncNever()
+{
+	testSync<modm::BdSync::Never>(false);
+}
+
+void
+BlockDeviceMappedFileTest::testSyncOnWrite()
+{
+	testSync<modm::BdSync::OnWrite>(true);
+}
+
+void
+BlockDeviceMappedFileTest::testSyncOnDeinitialize()
+{
+	testSync<modm::BdSync::OnDeinitialize>(false);
+}
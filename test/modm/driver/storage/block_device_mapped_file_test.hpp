@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef BLOCK_DEVICE_MAPPED_FILE_TEST_HPP
+#define BLOCK_DEVICE_MAPPED_FILE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class BlockDeviceMappedFileTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp();
+
+	void
+	tearDown();
+
+	void
+	testCreate();
+
+	void
+	testNorProgram();
+
+	void
+	testNorErase();
+
+	void
+	testRange();
+
+	void
+	testSyncNever();
+
+	void
+	testSyncOnWrite();
+
+	void
+	testSyncOnDeinitialize();
+};
+
+#endif	// BLOCK_DEVICE_MAPPED_FILE_TEST_HPP
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "block_device_sdcard_test.hpp"
+
+#include <modm/driver/storage/block_device_sdcard.hpp>
+#include <modm/platform/gpio/unused.hpp>
+#include <modm-test/mock/sd_card.hpp>
+#include <cstring>
+
+using Card = modm_test::platform::SdCard;
+using CardType = modm::sd::CardType;
+using Command = modm::sd::Command;
+
+namespace
+{
+
+using SdCard = modm::BdSdCard<Card, modm::platform::GpioUnused>;
+
+uint8_t buffer[4 * 512];
+uint8_t pattern[4 * 512];
+
+void
+fillPattern(uint8_t seed)
+{
+	for (uint16_t ii = 0; ii < sizeof(pattern); ii++) {
+		pattern[ii] = uint8_t(ii * 7 + seed);
+	}
+}
+
+uint32_t
+commands(Command command)
+{
+	if (uint8_t(command) & uint8_t(Command::App)) {
+		return Card::getStatistics().appCommands[uint8_t(command) & 0x3F];
+	}
+	return Card::getStatistics().commands[uint8_t(command)];
+}
+
+}
+
+void
+BlockDeviceSdCardTest::testInitialize()
+{
+	SdCard card;
+
+	Card::reset(CardType::Sdhc);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	TEST_ASSERT_TRUE(card.getCardType() == CardType::Sdhc);
+	TEST_ASSERT_EQUALS(card.getBlockCount(), 1024u);
+	TEST_ASSERT_EQUALS(commands(Command::GoIdleState), 1u);
+	TEST_ASSERT_EQUALS(commands(Command::SendInterfaceCondition), 1u);
+	// the card stays idle for the first two tries
+	TEST_ASSERT_EQUALS(commands(Command::AppSendOpCondition), 3u);
+	TEST_ASSERT_EQUALS(commands(Command::ReadOcr), 1u);
+	// block addressed cards have a fixed block length
+	TEST_ASSERT_EQUALS(commands(Command::SetBlockLength), 0u);
+
+	Card::reset(CardType::SdV2);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	TEST_ASSERT_TRUE(card.getCardType() == CardType::SdV2);
+	TEST_ASSERT_EQUALS(card.getBlockCount(), Card::Blocks);
+	TEST_ASSERT_EQUALS(commands(Command::SetBlockLength), 1u);
+
+	Card::reset(CardType::SdV1);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	TEST_ASSERT_TRUE(card.getCardType() == CardType::SdV1);
+	TEST_ASSERT_EQUALS(card.getBlockCount(), Card::Blocks);
+
+	Card::reset(CardType::Mmc);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	TEST_ASSERT_TRUE(card.getCardType() == CardType::Mmc);
+	TEST_ASSERT_EQUALS(commands(Command::SendOpCondition), 3u);
+	TEST_ASSERT_EQUALS(card.getBlockCount(), Card::Blocks);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.deinitialize()));
+	TEST_ASSERT_TRUE(card.getCardType() == CardType::None);
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.readBlocks(buffer, 0, 1)));
+}
+
+void
+BlockDeviceSdCardTest::testSingleBlock()
+{
+	SdCard card;
+	Card::reset(CardType::Sdhc);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	fillPattern(1);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 3, 1)));
+	TEST_ASSERT_EQUALS(commands(Command::WriteBlock), 1u);
+	TEST_ASSERT_EQUALS(commands(Command::AppSetWriteBlockEraseCount), 0u);
+	TEST_ASSERT_EQUALS(Card::getStatistics().blocksWritten, 1u);
+	TEST_ASSERT_EQUALS(std::memcmp(Card::getBlock(3), pattern, 512), 0);
+	// the driver waited until the card finished programming
+	TEST_ASSERT_EQUALS(Card::getStatistics().busyPolls, 4u);
+
+	std::memset(buffer, 0, sizeof(buffer));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.readBlocks(buffer, 3, 1)));
+	TEST_ASSERT_EQUALS(commands(Command::ReadSingleBlock), 1u);
+	TEST_ASSERT_EQUALS(commands(Command::StopTransmission), 0u);
+	TEST_ASSERT_EQUALS(std::memcmp(buffer, pattern, 512), 0);
+	TEST_ASSERT_EQUALS(Card::getStatistics().invalidFillBytes, 0u);
+	// every block is moved with a single transfer
+	TEST_ASSERT_EQUALS(Card::getStatistics().blockTransfers, 2u);
+}
+
+void
+BlockDeviceSdCardTest::testMultipleBlocks()
+{
+	SdCard card;
+	Card::reset(CardType::Sdhc);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	Card::setBusyBytes(20);
+	fillPattern(2);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 2, 4)));
+	TEST_ASSERT_EQUALS(commands(Command::WriteMultipleBlock), 1u);
+	TEST_ASSERT_EQUALS(commands(Command::WriteBlock), 0u);
+	TEST_ASSERT_EQUALS(commands(Command::AppSetWriteBlockEraseCount), 1u);
+	TEST_ASSERT_EQUALS(Card::getStatistics().eraseCount, 4u);
+	TEST_ASSERT_EQUALS(Card::getStatistics().blocksWritten, 4u);
+	TEST_ASSERT_EQUALS(Card::getStatistics().busyPolls, 5u * 20u);
+	for (uint8_t ii = 0; ii < 4; ii++) {
+		TEST_ASSERT_EQUALS(std::memcmp(Card::getBlock(2 + ii), pattern + ii * 512, 512), 0);
+	}
+	TEST_ASSERT_EQUALS(Card::getBlock(1)[0], 0xff);
+	TEST_ASSERT_EQUALS(Card::getBlock(6)[0], 0xff);
+
+	std::memset(buffer, 0, sizeof(buffer));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.readBlocks(buffer, 2, 4)));
+	TEST_ASSERT_EQUALS(commands(Command::ReadMultipleBlock), 1u);
+	TEST_ASSERT_EQUALS(commands(Command::StopTransmission), 1u);
+	// the read only returns after the card stopped being busy
+	TEST_ASSERT_EQUALS(Card::getStatistics().busyPolls, 6u * 20u);
+	TEST_ASSERT_EQUALS(Card::getStatistics().blocksRead, 4u);
+	TEST_ASSERT_EQUALS(std::memcmp(buffer, pattern, sizeof(pattern)), 0);
+	TEST_ASSERT_EQUALS(Card::getStatistics().invalidFillBytes, 0u);
+	TEST_ASSERT_EQUALS(Card::getStatistics().blockTransfers, 8u);
+
+	// the card is usable after stopping the transmission
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.readBlocks(buffer, 5, 1)));
+	TEST_ASSERT_EQUALS(std::memcmp(buffer, pattern + 3 * 512, 512), 0);
+}
+
+void
+BlockDeviceSdCardTest::testByteAddressing()
+{
+	SdCard card;
+	Card::reset(CardType::SdV2);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	fillPattern(3);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.write(pattern, 4 * 512, 2 * 512)));
+	TEST_ASSERT_EQUALS(std::memcmp(Card::getBlock(4), pattern, 2 * 512), 0);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.program(pattern + 2 * 512, 1 * 512, 512)));
+	TEST_ASSERT_EQUALS(std::memcmp(Card::getBlock(1), pattern + 2 * 512, 512), 0);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.read(buffer, 4 * 512, 2 * 512)));
+	TEST_ASSERT_EQUALS(std::memcmp(buffer, pattern, 2 * 512), 0);
+
+	// only whole blocks can be accessed
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.read(buffer, 100, 512)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.read(buffer, 0, 100)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.write(pattern, 0, 0)));
+	TEST_ASSERT_EQUALS(commands(Command::ReadSingleBlock) + commands(Command::ReadMultipleBlock), 1u);
+}
+
+void
+BlockDeviceSdCardTest::testErase()
+{
+	SdCard card;
+	Card::reset(CardType::Sdhc);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	fillPattern(4);
+
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 0, 4)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.erase(1 * 512, 2 * 512)));
+	TEST_ASSERT_EQUALS(commands(Command::Erase), 1u);
+	TEST_ASSERT_EQUALS(Card::getBlock(0)[0], pattern[0]);
+	TEST_ASSERT_EQUALS(Card::getBlock(1)[0], 0xff);
+	TEST_ASSERT_EQUALS(Card::getBlock(2)[511], 0xff);
+	TEST_ASSERT_EQUALS(Card::getBlock(3)[0], pattern[3 * 512]);
+}
+
+void
+BlockDeviceSdCardTest::testErrors()
+{
+	SdCard card;
+	Card::reset(CardType::Sdhc);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.initialize()));
+	fillPattern(5);
+
+	// out of range of the card
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.readBlocks(buffer, 1023, 2)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.readBlocks(buffer, 0, 0)));
+	TEST_ASSERT_EQUALS(commands(Command::ReadMultipleBlock), 0u);
+
+	// address error beyond the simulated storage
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.readBlocks(buffer, 100, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 100, 2)));
+	// the card sends an error token when streaming beyond the storage
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.readBlocks(buffer, 6, 4)));
+	TEST_ASSERT_EQUALS(Card::getStatistics().blocksRead, 2u);
+	TEST_ASSERT_EQUALS(commands(Command::StopTransmission), 1u);
+
+	// the card rejects the blocks
+	Card::setWriteProtected(true);
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 0, 1)));
+	TEST_ASSERT_FALSE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 0, 3)));
+	TEST_ASSERT_EQUALS(Card::getStatistics().blocksWritten, 0u);
+	TEST_ASSERT_EQUALS(Card::getBlock(0)[0], 0xff);
+
+	// the card recovers from all errors
+	Card::setWriteProtected(false);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.writeBlocks(pattern, 0, 2)));
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(card.readBlocks(buffer, 0, 2)));
+	TEST_ASSERT_EQUALS(std::memcmp(buffer, pattern, 2 * 512), 0);
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef BLOCK_DEVICE_SDCARD_TEST_HPP
+#define BLOCK_DEVICE_SDCARD_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class BlockDeviceSdCardTest : public unittest::TestSuite
+{
+public:
+	void
+	testInitialize();
+
+	void
+	testSingleBlock();
+
+	void
+	testMultipleBlocks();
+
+	void
+	testByteAddressing();
+
+	void
+	testErase();
+
+	void
+	testErrors();
+};
+
+#endif	// BLOCK_DEVICE_SDCARD_TEST_HPP
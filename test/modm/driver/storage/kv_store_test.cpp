@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "kv_store_test.hpp"
+
+#include <modm/driver/storage/kv_store.hpp>
+#include <modm/driver/storage/block_device_heap.hpp>
+#include <cstring>
+
+namespace
+{
+
+/// NOR flash model that can simulate a power loss while programming
+class NorFlash : public modm::BlockDevice
+{
+public:
+	static constexpr bd_size_t BlockSizeRead = 1;
+	static constexpr bd_size_t BlockSizeWrite = 16;
+	static constexpr bd_size_t BlockSizeErase = 1024;
+	static constexpr bd_size_t DeviceSize = 8 * 1024;
+
+	static inline uint8_t memory[DeviceSize];
+	static inline uint32_t eraseCount[DeviceSize / BlockSizeErase];
+	// bytes that can still be programmed before the power is cut
+	static inline uint32_t budget;
+
+	static void
+	reset()
+	{
+		std::memset(memory, 0xff, DeviceSize);
+		std::memset(eraseCount, 0, sizeof(eraseCount));
+		budget = uint32_t(-1);
+	}
+
+	bool initialize() { return true; }
+	bool deinitialize() { return true; }
+
+	bool
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		if (not budget or address + size > DeviceSize) return false;
+		std::memcpy(buffer, memory + address, size);
+		return true;
+	}
+
+	bool
+	program(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		if (size % BlockSizeWrite or address + size > DeviceSize) return false;
+		const bd_size_t programmed = std::min(size, budget);
+		for (bd_size_t ii = 0; ii < programmed; ii++) memory[address + ii] &= buffer[ii];
+		budget -= programmed;
+		return programmed == size;
+	}
+
+	bool
+	erase(bd_address_t address, bd_size_t size)
+	{
+		if (not budget or address % BlockSizeErase or size % BlockSizeErase) return false;
+		std::memset(memory + address, 0xff, size);
+		for (bd_size_t ii = 0; ii < size; ii += BlockSizeErase) eraseCount[(address + ii) / BlockSizeErase]++;
+		return true;
+	}
+};
+
+using Store = modm::KvStore<NorFlash, 16, 32, 1024>;
+
+uint32_t
+readValue(Store& store, Store::key_t key)
+{
+	uint32_t value{0};
+	if (not store.get(key, (uint8_t*) &value, sizeof(value))) return 0xdeadbeef;
+	return value;
+}
+
+bool
+writeValue(Store& store, Store::key_t key, uint32_t value)
+{
+	return store.set(key, (const uint8_t*) &value, sizeof(value));
+}
+
+}
+
+void
+KvStoreTest::setUp()
+{
+	NorFlash::reset();
+}
+
+void
+KvStoreTest::testSetGet()
+{
+	Store store;
+	TEST_ASSERT_TRUE(store.initialize());
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 0u);
+	TEST_ASSERT_FALSE(store.contains(1));
+
+	TEST_ASSERT_TRUE(writeValue(store, 1, 0x11223344));
+	TEST_ASSERT_TRUE(writeValue(store, Store::hash("gain"), 42));
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 2u);
+	TEST_ASSERT_EQUALS(store.getSize(1), 4u);
+	TEST_ASSERT_EQUALS(readValue(store, 1), 0x11223344u);
+	TEST_ASSERT_EQUALS(readValue(store, Store::hash("gain")), 42u);
+
+	TEST_ASSERT_TRUE(writeValue(store, 1, 0x55667788));
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 2u);
+	TEST_ASSERT_EQUALS(readValue(store, 1), 0x55667788u);
+
+	const char text[] = "hello world";
+	char result[sizeof(text)]{};
+	TEST_ASSERT_TRUE(store.set(7, (const uint8_t*) text, sizeof(text)));
+	TEST_ASSERT_EQUALS(store.getSize(7), sizeof(text));
+	TEST_ASSERT_TRUE(store.get(7, (uint8_t*) result, sizeof(result)));
+	TEST_ASSERT_EQUALS_STRING(result, text);
+
+	// values larger than MaxValueSize are rejected
+	uint8_t large[33]{};
+	TEST_ASSERT_FALSE(store.set(8, large, sizeof(large)));
+	TEST_ASSERT_FALSE(store.contains(8));
+}
+
+void
+KvStoreTest::testRemove()
+{
+	Store store;
+	TEST_ASSERT_TRUE(store.initialize());
+	TEST_ASSERT_FALSE(store.remove(1));
+
+	TEST_ASSERT_TRUE(writeValue(store, 1, 1));
+	TEST_ASSERT_TRUE(writeValue(store, 2, 2));
+	TEST_ASSERT_TRUE(store.remove(1));
+	TEST_ASSERT_FALSE(store.contains(1));
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 1u);
+	TEST_ASSERT_EQUALS(readValue(store, 2), 2u);
+
+	Store mounted;
+	TEST_ASSERT_TRUE(mounted.initialize());
+	TEST_ASSERT_FALSE(mounted.contains(1));
+	TEST_ASSERT_EQUALS(readValue(mounted, 2), 2u);
+}
+
+void
+KvStoreTest::testMount()
+{
+	{
+		Store store;
+		TEST_ASSERT_TRUE(store.initialize());
+		for (uint32_t key = 0; key < 16; key++) {
+			TEST_ASSERT_TRUE(writeValue(store, key, key * 3));
+		}
+		// Overwrite some keys several times to spread them over multiple sectors
+		for (uint32_t ii = 0; ii < 100; ii++) {
+			TEST_ASSERT_TRUE(writeValue(store, ii % 4, ii));
+		}
+	}
+
+	Store store;
+	TEST_ASSERT_TRUE(store.initialize());
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 16u);
+	for (uint32_t key = 0; key < 4; key++) {
+		TEST_ASSERT_EQUALS(readValue(store, key), 96 + key);
+	}
+	for (uint32_t key = 4; key < 16; key++) {
+		TEST_ASSERT_EQUALS(readValue(store, key), key * 3);
+	}
+
+	TEST_ASSERT_TRUE(store.format());
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 0u);
+	Store formatted;
+	TEST_ASSERT_TRUE(formatted.initialize());
+	TEST_ASSERT_EQUALS(formatted.getKeyCount(), 0u);
+}
+
+void
+KvStoreTest::testCapacity()
+{
+	Store store;
+	TEST_ASSERT_TRUE(store.initialize());
+
+	uint8_t value[32];
+	for (uint32_t key = 0; key < 16; key++) {
+		std::memset(value, key, sizeof(value));
+		TEST_ASSERT_TRUE(store.set(key, value, sizeof(value)));
+	}
+	// more keys than the index can hold
+	TEST_ASSERT_FALSE(store.set(16, value, 1));
+
+	// the full store can still be updated indefinitely
+	for (uint32_t ii = 0; ii < 500; ii++) {
+		std::memset(value, ii, sizeof(value));
+		TEST_ASSERT_TRUE(store.set(ii % 16, value, sizeof(value)));
+	}
+	for (uint32_t key = 0; key < 16; key++) {
+		const uint8_t last = (496 + key < 500) ? 496 + key : 480 + key;
+		uint8_t result[32];
+		TEST_ASSERT_TRUE(store.get(key, result, sizeof(result)));
+		TEST_ASSERT_EQUALS(result[0], last);
+		TEST_ASSERT_EQUALS(result[31], last);
+	}
+}
+
+void
+KvStoreTest::testWearLeveling()
+{
+	Store store;
+	TEST_ASSERT_TRUE(store.initialize());
+
+	// Static values must not prevent their sectors from being reused
+	for (uint32_t key = 0; key < 8; key++) {
+		TEST_ASSERT_TRUE(writeValue(store, 100 + key, key));
+	}
+	for (uint32_t ii = 0; ii < 5000; ii++)
+	{
+		TEST_ASSERT_TRUE(writeValue(store, ii % 3, ii));
+		while (store.needsCompaction()) {
+			TEST_ASSERT_TRUE(store.compact());
+		}
+	}
+
+	uint32_t minimum{uint32_t(-1)}, maximum{0};
+	for (uint32_t count : NorFlash::eraseCount)
+	{
+		minimum = std::min(minimum, count);
+		maximum = std::max(maximum, count);
+	}
+	TEST_ASSERT_TRUE(minimum > 0);
+	TEST_ASSERT_TRUE(maximum - minimum <= 1);
+
+	for (uint32_t key = 0; key < 8; key++) {
+		TEST_ASSERT_EQUALS(readValue(store, 100 + key), key);
+	}
+}
+
+void
+KvStoreTest::testPowerCut()
+{
+	// Cut the power after every possible number of programmed bytes while
+	// updating a value, which also triggers compactions along the way.
+	for (uint32_t cut = 0; cut < 10000; cut += 12)
+	{
+		NorFlash::reset();
+		{
+			Store store;
+			TEST_ASSERT_TRUE(store.initialize());
+			for (uint32_t key = 0; key < 8; key++) {
+				TEST_ASSERT_TRUE(writeValue(store, key, key));
+			}
+			NorFlash::budget = cut;
+			for (uint32_t ii = 0; ii < 600; ii++) {
+				if (not writeValue(store, 0, 1000 + ii)) break;
+			}
+		}
+		NorFlash::budget = uint32_t(-1);
+
+		Store store;
+		TEST_ASSERT_TRUE(store.initialize());
+		TEST_ASSERT_EQUALS(store.getKeyCount(), 8u);
+		const uint32_t value = readValue(store, 0);
+		TEST_ASSERT_TRUE(value == 0 or (value >= 1000 and value < 1600));
+		for (uint32_t key = 1; key < 8; key++) {
+			TEST_ASSERT_EQUALS(readValue(store, key), key);
+		}
+		// the store must remain writable after recovering
+		TEST_ASSERT_TRUE(writeValue(store, 0, 2000));
+		TEST_ASSERT_EQUALS(readValue(store, 0), 2000u);
+	}
+}
+
+void
+KvStoreTest::testHeapDevice()
+{
+	// A RAM device does not erase, so old records remain in reused sectors
+	static uint8_t memory[4096]{};
+	using HeapStore = modm::KvStore<modm::BdHeap<4096, true>, 8, 16, 512>;
+	{
+		HeapStore store;
+		TEST_ASSERT_TRUE(store.getBlockDevice().initialize(memory));
+		TEST_ASSERT_TRUE(store.mount());
+		for (uint32_t ii = 0; ii < 1000; ii++) {
+			TEST_ASSERT_TRUE(store.set(ii % 5, (const uint8_t*) &ii, sizeof(ii)));
+		}
+		TEST_ASSERT_TRUE(store.remove(3));
+	}
+
+	HeapStore store;
+	TEST_ASSERT_TRUE(store.getBlockDevice().initialize(memory));
+	TEST_ASSERT_TRUE(store.mount());
+	TEST_ASSERT_EQUALS(store.getKeyCount(), 4u);
+	TEST_ASSERT_FALSE(store.contains(3));
+	for (uint32_t key : {0, 1, 2, 4})
+	{
+		uint32_t value{};
+		TEST_ASSERT_TRUE(store.get(key, (uint8_t*) &value, sizeof(value)));
+		TEST_ASSERT_EQUALS(value, 995 + key);
+	}
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef KV_STORE_TEST_HPP
+#define KV_STORE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class KvStoreTest : public unittest::TestSuite
+{
+public:
+	void
+	setUp() override;
+
+	void
+	testSetGet();
+
+	void
+	testRemove();
+
+	void
+	testMount();
+
+	void
+	testCapacity();
+
+	void
+	testWearLeveling();
+
+	void
+	testPowerCut();
+
+	void
+	testHeapDevice();
+};
+
+#endif	// KV_STORE_TEST_HPP
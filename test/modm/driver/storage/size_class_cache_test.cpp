@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "size_class_cache_test.hpp"
+
+#include <modm/driver/storage/size_class_cache.hpp>
+
+namespace
+{
+	using Cache = modm::SizeClassCache<4, 8, 64>;
+	alignas(8) uint8_t memory[4 + 4 * 64 + 8];
+}
+
+void
+SizeClassCacheTest::testInitialize()
+{
+	Cache cache;
+	cache.initialize(memory, memory + sizeof(memory));
+
+	// one byte of page table per page and alignment of the pages
+	TEST_ASSERT_EQUALS(cache.getPageCount(), 4u);
+	TEST_ASSERT_EQUALS(cache.getFreePageCount(), 4u);
+	TEST_ASSERT_EQUALS(cache.getFragmentedSize(), 0u);
+	TEST_ASSERT_FALSE(cache.contains(memory));
+
+	cache.initialize(memory, memory + 4 + 4 * 64);
+	TEST_ASSERT_EQUALS(cache.getPageCount(), 3u);
+
+	cache.initialize(memory, memory + 10);
+	TEST_ASSERT_EQUALS(cache.getPageCount(), 0u);
+	TEST_ASSERT_EQUALS(cache.allocate(1), (void *) nullptr);
+}
+
+void
+SizeClassCacheTest::testAllocate()
+{
+	Cache cache;
+	cache.initialize(memory, memory + sizeof(memory));
+
+	TEST_ASSERT_EQUALS(Cache::MaxSize, 32u);
+	TEST_ASSERT_EQUALS(cache.allocate(33), (void *) nullptr);
+
+	uint8_t *a = static_cast<uint8_t *>(cache.allocate(1));
+	uint8_t *b = static_cast<uint8_t *>(cache.allocate(8));
+	uint8_t *c = static_cast<uint8_t *>(cache.allocate(9));
+	TEST_ASSERT_TRUE(cache.contains(a));
+	TEST_ASSERT_EQUALS(b, a + 8);
+	TEST_ASSERT_EQUALS(uintptr_t(a) % 8, 0u);
+	TEST_ASSERT_EQUALS(cache.getSize(a), 8u);
+	TEST_ASSERT_EQUALS(cache.getSize(c), 16u);
+	TEST_ASSERT_EQUALS(cache.getSize(memory), 0u);
+
+	// each class uses its own page
+	TEST_ASSERT_EQUALS(cache.getFreePageCount(), 2u);
+	TEST_ASSERT_EQUALS(cache.getStatistics(0).allocations, 2u);
+	TEST_ASSERT_EQUALS(cache.getStatistics(0).used, 2u);
+	TEST_ASSERT_EQUALS(cache.getStatistics(1).pages, 1u);
+	TEST_ASSERT_EQUALS(cache.getFragmentedSize(), 64u - 16u + 64u - 16u);
+}
+
+void
+SizeClassCacheTest::testFree()
+{
+	Cache cache;
+	cache.initialize(memory, memory + sizeof(memory));
+	int other;
+
+	void *a = cache.allocate(4);
+	void *b = cache.allocate(4);
+	TEST_ASSERT_FALSE(cache.free(&other));
+	TEST_ASSERT_TRUE(cache.free(a));
+	TEST_ASSERT_EQUALS(cache.getStatistics(0).used, 1u);
+	TEST_ASSERT_EQUALS(cache.getStatistics(0).peak, 2u);
+
+	// freed blocks are reused first
+	TEST_ASSERT_EQUALS(cache.allocate(8), a);
+	TEST_ASSERT_TRUE(cache.free(b));
+	TEST_ASSERT_TRUE(cache.free(a));
+	TEST_ASSERT_EQUALS(cache.allocate(2), a);
+	TEST_ASSERT_EQUALS(cache.allocate(2), b);
+	TEST_ASSERT_EQUALS(cache.getStatistics(0).pages, 1u);
+}
+
+void
+SizeClassCacheTest::testExhaustion()
+{
+	Cache cache;
+	cache.initialize(memory, memory + sizeof(memory));
+
+	// two blocks of 32 bytes per page
+	void *blocks[8];
+	for (void *&block : blocks) {
+		TEST_ASSERT_TRUE((block = cache.allocate(32)) != nullptr);
+	}
+	TEST_ASSERT_EQUALS(cache.allocate(32), (void *) nullptr);
+	TEST_ASSERT_EQUALS(cache.allocate(1), (void *) nullptr);
+	TEST_ASSERT_EQUALS(cache.getStatistics(3).misses, 1u);
+	TEST_ASSERT_EQUALS(cache.getStatistics(0).misses, 1u);
+	TEST_ASSERT_EQUALS(cache.getFreePageCount(), 0u);
+
+	// pages stay assigned to their class
+	TEST_ASSERT_TRUE(cache.free(blocks[0]));
+	TEST_ASSERT_EQUALS(cache.getFragmentedSize(), 32u);
+	TEST_ASSERT_EQUALS(cache.allocate(1), (void *) nullptr);
+	TEST_ASSERT_EQUALS(cache.allocate(32), blocks[0]);
+}
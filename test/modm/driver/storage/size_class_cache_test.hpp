@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef SIZE_CLASS_CACHE_TEST_HPP
+#define SIZE_CLASS_CACHE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_driver
+class SizeClassCacheTest : public unittest::TestSuite
+{
+public:
+	void
+	testInitialize();
+
+	void
+	testAllocate();
+
+	void
+	testFree();
+
+	void
+	testExhaustion();
+};
+
+#endif	// SIZE_CLASS_CACHE_TEST_HPP
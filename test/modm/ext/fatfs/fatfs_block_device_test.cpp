@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "fatfs_block_device_test.hpp"
+
+#include <unittest/benchmark.hpp>
+
+#include <fatfs/ff.h>
+#include <fatfs/block_device.hpp>
+#include <modm/driver/storage/block_device_file.hpp>
+#include <modm/driver/storage/block_device_heap.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+
+constexpr size_t SectorSize = 512;
+constexpr size_t SectorCount = 512;
+
+/// RAM block device that records the accesses of the disk
+class CountingDevice : public modm::BdHeap<SectorCount * SectorSize>
+{
+public:
+	static inline uint32_t reads;
+	static inline uint32_t writes;
+	static inline uint32_t erases;
+	static inline bd_size_t lastSize;
+
+	static void
+	resetCounters()
+	{ reads = writes = erases = lastSize = 0; }
+
+	modm::ResumableResult<bool>
+	read(uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		reads++;
+		lastSize = size;
+		return BdHeap::read(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	write(const uint8_t* buffer, bd_address_t address, bd_size_t size)
+	{
+		writes++;
+		lastSize = size;
+		return BdHeap::write(buffer, address, size);
+	}
+
+	modm::ResumableResult<bool>
+	erase(bd_address_t address, bd_size_t size)
+	{
+		erases++;
+		lastSize = size;
+		return BdHeap::erase(address, size);
+	}
+};
+
+struct ImageFile
+{
+	static constexpr const char* name = "fatfs_block_device_test.img~";
+};
+
+CountingDevice device;
+modm::BdFile<ImageFile, 1024 * 1024> image;
+
+alignas(4) uint8_t data[16 * SectorSize + 1];
+alignas(4) uint8_t result[16 * SectorSize];
+
+void
+fillData(uint8_t seed)
+{
+	for (size_t ii = 0; ii < sizeof(data); ii++) data[ii] = ii * 7 + seed;
+}
+
+// Four sectors per cluster, so that a cluster is accessed with one call
+const MKFS_PARM formatOptions{FM_FAT | FM_SFD, 0, 0, 0, 4 * SectorSize};
+
+}
+
+void
+FatFsBlockDeviceTest::testMultipleSectors()
+{
+	modm::fatfs::BlockDeviceDisk disk{device};
+	TEST_ASSERT_EQUALS(disk.initialize(), 0);
+	fillData(1);
+
+	CountingDevice::resetCounters();
+	TEST_ASSERT_TRUE(disk.write(data, 4, 16) == RES_OK);
+	TEST_ASSERT_EQUALS(CountingDevice::writes, 1u);
+	TEST_ASSERT_EQUALS(CountingDevice::lastSize, 16 * SectorSize);
+
+	TEST_ASSERT_TRUE(disk.read(result, 4, 16) == RES_OK);
+	TEST_ASSERT_EQUALS(CountingDevice::reads, 1u);
+	TEST_ASSERT_EQUALS(CountingDevice::lastSize, 16 * SectorSize);
+	TEST_ASSERT_EQUALS_ARRAY(result, data, sizeof(result));
+
+	// the end of the device is still in range
+	TEST_ASSERT_TRUE(disk.read(result, SectorCount - 2, 2) == RES_OK);
+	TEST_ASSERT_TRUE(disk.read(result, SectorCount - 1, 2) == RES_ERROR);
+}
+
+void
+FatFsBlockDeviceTest::testUnalignedBuffer()
+{
+	modm::fatfs::BlockDeviceDisk<CountingDevice, SectorSize, 2> disk{device};
+	TEST_ASSERT_EQUALS(disk.initialize(), 0);
+	fillData(2);
+
+	// five sectors are copied through the bounce buffer with three calls
+	CountingDevice::resetCounters();
+	TEST_ASSERT_TRUE(disk.write(data + 1, 0, 5) == RES_OK);
+	TEST_ASSERT_EQUALS(CountingDevice::writes, 3u);
+	TEST_ASSERT_EQUALS(CountingDevice::lastSize, SectorSize);
+
+	TEST_ASSERT_TRUE(disk.read(result, 0, 5) == RES_OK);
+	TEST_ASSERT_EQUALS(CountingDevice::reads, 1u);
+	TEST_ASSERT_EQUALS_ARRAY(result, data + 1, 5 * SectorSize);
+
+	std::memset(data, 0, sizeof(data));
+	TEST_ASSERT_TRUE(disk.read(data + 1, 0, 5) == RES_OK);
+	TEST_ASSERT_EQUALS(CountingDevice::reads, 4u);
+	TEST_ASSERT_EQUALS_ARRAY(data + 1, result, 5 * SectorSize);
+}
+
+void
+FatFsBlockDeviceTest::testIoctl()
+{
+	modm::fatfs::BlockDeviceDisk disk{device};
+	LBA_t count{};
+	TEST_ASSERT_EQUALS(disk.status(), STA_NOINIT);
+	TEST_ASSERT_TRUE(disk.ioctl(GET_SECTOR_COUNT, &count) == RES_NOTRDY);
+	TEST_ASSERT_TRUE(disk.read(result, 0, 1) == RES_NOTRDY);
+	TEST_ASSERT_TRUE(disk.write(result, 0, 1) == RES_NOTRDY);
+
+	TEST_ASSERT_EQUALS(disk.initialize(), 0);
+	TEST_ASSERT_EQUALS(disk.status(), 0);
+
+	WORD size{};
+	DWORD block{};
+	TEST_ASSERT_TRUE(disk.ioctl(GET_SECTOR_COUNT, &count) == RES_OK);
+	TEST_ASSERT_EQUALS(count, SectorCount);
+	TEST_ASSERT_TRUE(disk.ioctl(GET_SECTOR_SIZE, &size) == RES_OK);
+	TEST_ASSERT_EQUALS(size, SectorSize);
+	TEST_ASSERT_TRUE(disk.ioctl(GET_BLOCK_SIZE, &block) == RES_OK);
+	TEST_ASSERT_EQUALS(block, 1u);
+	TEST_ASSERT_TRUE(disk.ioctl(CTRL_SYNC, nullptr) == RES_OK);
+	TEST_ASSERT_TRUE(disk.ioctl(0xff, nullptr) == RES_PARERR);
+
+	// the trimmed range includes the last sector
+	CountingDevice::resetCounters();
+	LBA_t range[2] = {2, 5};
+	TEST_ASSERT_TRUE(disk.ioctl(CTRL_TRIM, range) == RES_OK);
+	TEST_ASSERT_EQUALS(CountingDevice::erases, 1u);
+	TEST_ASSERT_EQUALS(CountingDevice::lastSize, 4 * SectorSize);
+
+	range[0] = 6;
+	TEST_ASSERT_TRUE(disk.ioctl(CTRL_TRIM, range) == RES_PARERR);
+	range[0] = 0;
+	range[1] = SectorCount;
+	TEST_ASSERT_TRUE(disk.ioctl(CTRL_TRIM, range) == RES_PARERR);
+	TEST_ASSERT_EQUALS(CountingDevice::erases, 1u);
+}
+
+void
+FatFsBlockDeviceTest::testDiskTable()
+{
+	modm::fatfs::BlockDeviceDisk disk{device};
+	TEST_ASSERT_FALSE(modm::fatfs::registerDisk(FF_VOLUMES, disk));
+	TEST_ASSERT_EQUALS(disk_status(0), STA_NOINIT);
+	TEST_ASSERT_TRUE(disk_read(0, result, 0, 1) == RES_NOTRDY);
+
+	TEST_ASSERT_TRUE(modm::fatfs::registerDisk(0, disk));
+	TEST_ASSERT_EQUALS(disk_initialize(0), 0);
+	TEST_ASSERT_EQUALS(disk_status(0), 0);
+	TEST_ASSERT_TRUE(disk_read(0, result, 0, 1) == RES_OK);
+	TEST_ASSERT_TRUE(disk_write(0, result, 0, 1) == RES_OK);
+	TEST_ASSERT_EQUALS(disk_status(1), STA_NOINIT);
+	TEST_ASSERT_TRUE(disk_read(FF_VOLUMES, result, 0, 1) == RES_NOTRDY);
+
+	modm::fatfs::unregisterDisk(0);
+	TEST_ASSERT_EQUALS(disk_status(0), STA_NOINIT);
+	TEST_ASSERT_TRUE(disk_ioctl(0, CTRL_SYNC, nullptr) == RES_NOTRDY);
+}
+
+void
+FatFsBlockDeviceTest::testFileSystem()
+{
+#if not FF_USE_MKFS
+	// the FatFs configuration of the project does not provide f_mkfs()
+	return;
+#else
+	modm::fatfs::BlockDeviceDisk disk{device};
+	TEST_ASSERT_TRUE(modm::fatfs::registerDisk(0, disk));
+
+	uint8_t work[FF_MAX_SS];
+	TEST_ASSERT_TRUE(f_mkfs("0:", &formatOptions, work, sizeof(work)) == FR_OK);
+	FATFS fs;
+	TEST_ASSERT_TRUE(f_mount(&fs, "0:", 1) == FR_OK);
+
+	FIL file;
+	UINT count;
+	fillData(3);
+	TEST_ASSERT_TRUE(f_open(&file, "0:test.bin", FA_CREATE_ALWAYS | FA_WRITE) == FR_OK);
+	// write back the directory entry before counting
+	TEST_ASSERT_TRUE(f_sync(&file) == FR_OK);
+	// a whole cluster is written from the buffer with one call
+	CountingDevice::resetCounters();
+	TEST_ASSERT_TRUE(f_write(&file, data, 4 * SectorSize, &count) == FR_OK);
+	TEST_ASSERT_EQUALS(count, 4 * SectorSize);
+	TEST_ASSERT_EQUALS(CountingDevice::writes, 1u);
+	TEST_ASSERT_EQUALS(CountingDevice::lastSize, 4 * SectorSize);
+	TEST_ASSERT_TRUE(f_close(&file) == FR_OK);
+
+	TEST_ASSERT_TRUE(f_open(&file, "0:test.bin", FA_READ) == FR_OK);
+	CountingDevice::resetCounters();
+	TEST_ASSERT_TRUE(f_read(&file, result, sizeof(result), &count) == FR_OK);
+	TEST_ASSERT_EQUALS(count, 4 * SectorSize);
+	TEST_ASSERT_EQUALS(CountingDevice::reads, 1u);
+	TEST_ASSERT_EQUALS_ARRAY(result, data, 4 * SectorSize);
+	TEST_ASSERT_TRUE(f_close(&file) == FR_OK);
+
+	CountingDevice::resetCounters();
+	TEST_ASSERT_TRUE(f_unlink("0:test.bin") == FR_OK);
+#if FF_USE_TRIM
+	// the released cluster is trimmed
+	TEST_ASSERT_EQUALS(CountingDevice::erases, 1u);
+	TEST_ASSERT_EQUALS(CountingDevice::lastSize, 4 * SectorSize);
+#endif
+
+	TEST_ASSERT_TRUE(f_mount(nullptr, "0:", 0) == FR_OK);
+	modm::fatfs::unregisterDisk(0);
+#endif
+}
+
+void
+FatFsBlockDeviceTest::testBenchmark()
+{
+#if not FF_USE_MKFS
+	// the FatFs configuration of the project does not provide f_mkfs()
+	return;
+#else
+	// create an empty image, which is filled with zeros by the device
+	std::ofstream{ImageFile::name};
+	modm::fatfs::BlockDeviceDisk disk{image};
+	TEST_ASSERT_TRUE(modm::fatfs::registerDisk(0, disk));
+
+	uint8_t work[FF_MAX_SS];
+	TEST_ASSERT_TRUE(f_mkfs("0:", &formatOptions, work, sizeof(work)) == FR_OK);
+	FATFS fs;
+	TEST_ASSERT_TRUE(f_mount(&fs, "0:", 1) == FR_OK);
+	FIL file;
+	TEST_ASSERT_TRUE(f_open(&file, "0:bench.bin", FA_CREATE_ALWAYS | FA_WRITE | FA_READ) == FR_OK);
+
+	// throughput of 8 KiB per call
+	constexpr UINT Size = 16 * SectorSize;
+	fillData(4);
+	UINT count{};
+	TEST_BENCHMARK("file_write", [&] {
+		f_lseek(&file, 0);
+		f_write(&file, data, Size, &count);
+	});
+	TEST_ASSERT_EQUALS(count, Size);
+	TEST_BENCHMARK("file_read", [&] {
+		f_lseek(&file, 0);
+		f_read(&file, result, Size, &count);
+	});
+	TEST_ASSERT_EQUALS(count, Size);
+	TEST_ASSERT_EQUALS_ARRAY(result, data, Size);
+	TEST_BENCHMARK("file_write_unaligned", [&] {
+		f_lseek(&file, 0);
+		f_write(&file, data + 1, Size, &count);
+	});
+	TEST_ASSERT_EQUALS(count, Size);
+
+	TEST_ASSERT_TRUE(f_close(&file) == FR_OK);
+	TEST_ASSERT_TRUE(f_mount(nullptr, "0:", 0) == FR_OK);
+	modm::fatfs::unregisterDisk(0);
+	TEST_ASSERT_TRUE(RF_CALL_BLOCKING(image.deinitialize()));
+	std::remove(ImageFile::name);
+#endif
+}
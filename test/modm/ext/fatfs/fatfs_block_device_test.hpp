@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef FATFS_BLOCK_DEVICE_TEST_HPP
+#define FATFS_BLOCK_DEVICE_TEST_HPP
+
+#include <unittest/testsuite.hpp>
+
+/// @ingroup modm_test_test_ext_fatfs
+class FatFsBlockDeviceTest : public unittest::TestSuite
+{
+public:
+	void
+	testMultipleSectors();
+
+	void
+	testUnalignedBuffer();
+
+	void
+	testIoctl();
+
+	void
+	testDiskTable();
+
+	void
+	testFileSystem();
+
+	void
+	testBenchmark();
+};
+
+#endif	// FATFS_BLOCK_DEVICE_TEST_HPP
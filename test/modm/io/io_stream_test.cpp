@@ -6,6 +6,7 @@
  * Copyright (c) 2016-2017, Sascha Schade
  * Copyright (c) 2017, Marten Junga
  * Copyright (c) 2018, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -19,6 +20,7 @@
 
 #include <modm/architecture/utils.hpp> // MODM_ARRAY_SIZE
 #include <modm-test/mock/iodevice.hpp>
+#include <unittest/benchmark.hpp>
 #include <stdio.h>	// snprintf
 #include <string.h>	// memset
 #include <limits>
@@ -623,3 +625,16 @@ IoStreamTest::testPointer()
 	TEST_ASSERT_EQUALS_ARRAY(string, device.buffer, bytesWritten);
 	TEST_ASSERT_EQUALS(device.bytesWritten, bytesWritten);
 }
+
+void
+IoStreamTest::testBenchmark()
+{
+	TEST_BENCHMARK("integer", [&] {
+		device.clear();
+		(*stream) << uint32_t(4294967295ul) << int16_t(-12345);
+	});
+	TEST_BENCHMARK("printf", [&] {
+		device.clear();
+		stream->printf("%u %x %s", 12345u, 0xbeefu, "abc");
+	});
+}
@@ -5,6 +5,7 @@
  * Copyright (c) 2016, Sascha Schade
  * Copyright (c) 2017, Marten Junga
  * Copyright (c) 2018, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -169,6 +170,9 @@ public:
 	void
 	testPointer();
 
+	void
+	testBenchmark();
+
 private:
 	modm::IOStream *stream;
 };
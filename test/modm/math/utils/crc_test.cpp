@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/math/utils/crc.hpp>
+#include <unittest/benchmark.hpp>
+
+#include "crc_test.hpp"
+
+namespace
+{
+	const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+}
+
+void
+CrcTest::testCrc8()
+{
+#ifdef MODM_CPU_AVR
+	// _crc8_ccitt_update() of avr-libc
+	TEST_ASSERT_EQUALS(modm::math::crc8_ccitt(check, sizeof(check)), 0xfbU);
+#else
+	// the software implementation differs from avr-libc, but AMNB frames rely on it
+	TEST_ASSERT_EQUALS(modm::math::crc8_ccitt(check, sizeof(check)), 0x9bU);
+#endif
+	TEST_ASSERT_EQUALS(modm::math::crc8_ccitt(check, 0), modm::math::crc8_ccitt_init);
+}
+
+void
+CrcTest::testCrc16()
+{
+	// CRC-16/MCRF4XX
+	TEST_ASSERT_EQUALS(modm::math::crc16_ccitt(check, sizeof(check)), 0x6f91U);
+	TEST_ASSERT_EQUALS(modm::math::crc16_ccitt(check, 0), modm::math::crc16_ccitt_init);
+}
+
+void
+CrcTest::testCrc32()
+{
+	TEST_ASSERT_EQUALS(modm::math::crc32(check, sizeof(check)), 0xcbf43926UL);
+	TEST_ASSERT_EQUALS(modm::math::crc32(check, 0), 0UL);
+}
+
+void
+CrcTest::testBenchmark()
+{
+	uint8_t data[64];
+	for (uint8_t ii = 0; ii < sizeof(data); ii++) data[ii] = ii;
+
+	TEST_BENCHMARK("crc8", [&] {
+		unittest::doNotOptimize(modm::math::crc8_ccitt(data, sizeof(data)));
+	});
+	TEST_BENCHMARK("crc16", [&] {
+		unittest::doNotOptimize(modm::math::crc16_ccitt(data, sizeof(data)));
+	});
+	TEST_BENCHMARK("crc32", [&] {
+		unittest::doNotOptimize(modm::math::crc32(data, sizeof(data)));
+	});
+}
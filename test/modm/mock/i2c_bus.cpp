@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include "i2c_bus.hpp"
+
+using I2cBus = modm_test::platform::I2cBus;
+
+// start, stop and repeated start conditions take one bit time each,
+// every byte takes eight data bits and the acknowledge bit
+static constexpr std::size_t ConditionBits = 1;
+static constexpr std::size_t ByteBits = 9;
+
+void
+I2cBus::attachDevice(uint8_t address, uint8_t *registers, std::size_t size)
+{
+	if (deviceCount < std::size(devices))
+		devices[deviceCount++] = {address, registers, size, 0};
+}
+
+void
+I2cBus::removeDevices()
+{
+	deviceCount = 0;
+}
+
+I2cBus::Device*
+I2cBus::findDevice(uint8_t address)
+{
+	for (uint8_t ii = 0; ii < deviceCount; ii++)
+		if (devices[ii].address == address) return &devices[ii];
+	return nullptr;
+}
+
+// ----------------------------------------------------------------------------
+bool
+I2cBus::start(modm::I2cTransaction *transaction, ConfigurationHandler handler)
+{
+	if (not transaction) return false;
+	if ((synchronous or not buffered) ? (active != nullptr) : (queueCount >= TransactionBufferSize))
+		return false;
+
+	if (not transaction->attaching())
+	{
+		transaction->detaching(DetachCause::FailedToAttach);
+		return false;
+	}
+	if (handler and configuration != handler)
+	{
+		configuration = handler;
+		configuration();
+	}
+
+	if (active)
+	{
+		queue[(queueHead + queueCount) % TransactionBufferSize] = transaction;
+		queueCount++;
+		return true;
+	}
+	active = transaction;
+	if (synchronous) process();
+	return true;
+}
+
+void
+I2cBus::reset()
+{
+	error = Error::SoftwareReset;
+	if (active) active->detaching(DetachCause::ErrorCondition);
+	active = nullptr;
+	while (queueCount)
+	{
+		modm::I2cTransaction *next = queue[queueHead];
+		queueHead = (queueHead + 1) % TransactionBufferSize;
+		queueCount--;
+		next->detaching(DetachCause::ErrorCondition);
+	}
+}
+
+bool
+I2cBus::process()
+{
+	if (not active) return false;
+
+	execute(active);
+	active = nullptr;
+	statistics.transactions++;
+
+	// the interrupt starts the next queued transaction
+	if (queueCount)
+	{
+		active = queue[queueHead];
+		queueHead = (queueHead + 1) % TransactionBufferSize;
+		queueCount--;
+		statistics.idle += interruptLatency;
+	}
+	return true;
+}
+
+void
+I2cBus::execute(modm::I2cTransaction *transaction)
+{
+	error = Error::NoError;
+
+	Operation next = Operation::Restart;
+	while (next == Operation::Restart)
+	{
+		// (repeated) start condition and address byte
+		const modm::I2cTransaction::Starting starting = transaction->starting();
+		transmit(ConditionBits + ByteBits);
+
+		Device *device = findDevice(starting.address >> 1);
+		if (not device)
+		{
+			error = Error::AddressNack;
+			transmit(ConditionBits);
+			transaction->detaching(DetachCause::ErrorCondition);
+			return;
+		}
+
+		// the first byte written after the address sets the register pointer
+		bool addressing = true;
+		next = static_cast<Operation>(starting.next);
+		do
+		{
+			switch (next)
+			{
+				case Operation::Write:
+				{
+					const modm::I2cTransaction::Writing writing = transaction->writing();
+					for (std::size_t ii = 0; ii < writing.length; ii++)
+					{
+						const uint8_t data = writing.buffer[ii];
+						if (addressing) device->pointer = data;
+						else device->registers[device->pointer++ % device->size] = data;
+						addressing = false;
+					}
+					transmit(writing.length * ByteBits);
+					statistics.bytes += writing.length;
+					next = static_cast<Operation>(writing.next);
+					break;
+				}
+				case Operation::Read:
+				{
+					const modm::I2cTransaction::Reading reading = transaction->reading();
+					for (std::size_t ii = 0; ii < reading.length; ii++)
+						reading.buffer[ii] = device->registers[device->pointer++ % device->size];
+					transmit(reading.length * ByteBits);
+					statistics.bytes += reading.length;
+					next = static_cast<Operation>(reading.next);
+					break;
+				}
+				default:
+				case Operation::Stop:
+					transmit(ConditionBits);
+					transaction->detaching(DetachCause::NormalStop);
+					return;
+			}
+		}
+		while (next != Operation::Restart);
+	}
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_TEST_MOCK_I2C_BUS_HPP
+#define MODM_TEST_MOCK_I2C_BUS_HPP
+
+#include <modm/architecture/interface/i2c_master.hpp>
+#include <chrono>
+
+namespace modm_test
+{
+
+namespace platform
+{
+
+/**
+ * Simulated I2C bus with an interrupt driven master and register file devices.
+ *
+ * The master queues up to `TransactionBufferSize` transactions like the
+ * hardware drivers. `process()` performs the active transaction like the
+ * interrupt of the master, detaches it and starts the next queued
+ * transaction after the interrupt latency. The transaction stays active
+ * while it is detached, like in the hardware drivers.
+ *
+ * The bus time is accounted from the bits on the wire at the configured
+ * baudrate. Time spent between transactions is accounted as idle time:
+ * the interrupt latency when transactions are chained and the time passed
+ * to `idle()` by the test to model the software between transfers.
+ *
+ * A device has a register pointer, which is set by the first byte written
+ * after its address and incremented by every following byte written or read.
+ *
+ * @ingroup modm_test_mock_i2c_bus
+ */
+class I2cBus : public modm::I2cMaster
+{
+public:
+	static constexpr size_t TransactionBufferSize = 4;
+
+	struct Statistics
+	{
+		/// Time the bus was transferring bits
+		std::chrono::nanoseconds busy;
+		/// Time the bus was idle between transactions
+		std::chrono::nanoseconds idle;
+		/// Number of finished transactions
+		uint32_t transactions;
+		/// Number of data bytes transferred without the address bytes
+		uint32_t bytes;
+
+		/// Share of the bus time used for transfers
+		float
+		getUtilization() const
+		{
+			const auto total = busy + idle;
+			return total.count() ? float(busy.count()) / float(total.count()) : 0.f;
+		}
+	};
+
+public:
+	/// Attaches a register file device at the address (< 128).
+	static void
+	attachDevice(uint8_t address, uint8_t *registers, std::size_t size);
+
+	static void
+	removeDevices();
+
+	static void
+	setBaudrate(uint32_t baudrate)
+	{ bitTime = std::chrono::nanoseconds(1'000'000'000 / baudrate); }
+
+	/// Time between the stop condition and the start of the next queued transaction
+	static void
+	setInterruptLatency(std::chrono::nanoseconds latency)
+	{ interruptLatency = latency; }
+
+	/**
+	 * Queues transactions in the master like the STM32 drivers.
+	 *
+	 * Without a buffer the master only holds one transaction and rejects
+	 * others until it has finished detaching it, like the AVR master.
+	 */
+	static void
+	setBuffered(bool buffered)
+	{ I2cBus::buffered = buffered; }
+
+	/**
+	 * Performs transactions synchronously within `start()`.
+	 *
+	 * The master then behaves like a bit-banged master without a queue, which
+	 * rejects transactions while the previous one is being detached.
+	 */
+	static void
+	setSynchronous(bool synchronous)
+	{ I2cBus::synchronous = synchronous; }
+
+	/// Performs the active transaction.
+	/// @return `false` if the bus is idle.
+	static bool
+	process();
+
+	/// Performs transactions until the bus is idle.
+	static void
+	run()
+	{ while(process()) ; }
+
+	/// Accounts time in which the bus is idle, e.g. while the software prepares the next transfer.
+	static void
+	idle(std::chrono::nanoseconds time)
+	{ statistics.idle += time; }
+
+	static bool
+	isBusy()
+	{ return active; }
+
+	static const Statistics&
+	getStatistics()
+	{ return statistics; }
+
+	static void
+	resetStatistics()
+	{ statistics = {}; }
+
+public:
+	static bool
+	start(modm::I2cTransaction *transaction, ConfigurationHandler handler = nullptr);
+
+	static void
+	reset();
+
+	static Error
+	getErrorState()
+	{ return error; }
+
+private:
+	struct Device
+	{
+		uint8_t address;
+		uint8_t *registers;
+		std::size_t size;
+		std::size_t pointer;
+	};
+
+	static Device*
+	findDevice(uint8_t address);
+
+	static void
+	execute(modm::I2cTransaction *transaction);
+
+	static void
+	transmit(std::size_t bits)
+	{ statistics.busy += bitTime * bits; }
+
+	static inline Device devices[16]{};
+	static inline uint8_t deviceCount{0};
+
+	static inline modm::I2cTransaction *active{nullptr};
+	static inline modm::I2cTransaction *queue[TransactionBufferSize]{};
+	static inline uint8_t queueHead{0};
+	static inline uint8_t queueCount{0};
+	static inline ConfigurationHandler configuration{nullptr};
+	static inline Error error{Error::NoError};
+
+	static inline std::chrono::nanoseconds bitTime{10'000};
+	static inline std::chrono::nanoseconds interruptLatency{0};
+	static inline bool synchronous{false};
+	static inline bool buffered{true};
+	static inline Statistics statistics{};
+};
+
+} // namespace platform
+
+} // namespace modm_test
+
+#endif // MODM_TEST_MOCK_I2C_BUS_HPP
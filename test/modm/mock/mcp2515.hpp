@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_TEST_MOCK_MCP2515_HPP
+#define MODM_TEST_MOCK_MCP2515_HPP
+
+#include <modm/architecture/interface/can_message.hpp>
+#include <modm/architecture/interface/spi_master.hpp>
+
+namespace modm_test
+{
+
+namespace platform
+{
+
+/**
+ * Simulated MCP2515 CAN controller connected to a mock SPI master.
+ *
+ * The controller decodes the SPI instructions of the driver and implements
+ * the register file, the acceptance filters, the receive buffers with
+ * rollover and the transmit buffers with their priorities. The CAN bus is
+ * replaced by `receive()` and `transmit()`, which are called by the test.
+ *
+ * Use `ChipSelect` and `Interrupt` as the CS and INT pins of the driver.
+ *
+ * @ingroup modm_test_mock_mcp2515
+ */
+class Mcp2515 : public modm::SpiMaster
+{
+public:
+	struct Statistics
+	{
+		/// Number of SPI transactions framed by the chip select
+		uint32_t transactions;
+		/// Number of buffer transfers with more than one byte
+		uint32_t bulkTransfers;
+		/// Number of frames read with the READ RX BUFFER instruction
+		uint32_t framesRead;
+	};
+
+	/// Active low chip select, which frames the instructions
+	struct ChipSelect
+	{
+		static void
+		set();
+
+		static void
+		reset();
+	};
+
+	/// Active low interrupt output
+	struct Interrupt
+	{
+		static bool
+		read();
+	};
+
+public:
+	/// Powers up the controller in configuration mode
+	static void
+	reset();
+
+	/**
+	 * Receives a frame from the bus into a buffer accepted by the filters.
+	 *
+	 * @return false if the frame was rejected or lost due to an overflow
+	 */
+	static bool
+	receive(const modm::can::Message &message);
+
+	/// Sends the pending frame with the highest priority over the bus
+	static bool
+	transmit(modm::can::Message &message);
+
+	static uint8_t
+	getRegister(uint8_t address)
+	{ return registers[address & 0x7F]; }
+
+	static const Statistics&
+	getStatistics()
+	{ return statistics; }
+
+	static void
+	resetStatistics()
+	{ statistics = {}; }
+
+public:
+	static void
+	initialize()
+	{
+	}
+
+	static void
+	setDataMode(DataMode)
+	{
+	}
+
+	static void
+	setDataOrder(DataOrder)
+	{
+	}
+
+	static uint8_t
+	acquire(void *ctx, ConfigurationHandler handler = nullptr);
+
+	static uint8_t
+	release(void *ctx);
+
+	static uint8_t
+	transferBlocking(uint8_t data)
+	{ return exchange(data); }
+
+	static void
+	transferBlocking(uint8_t *tx, uint8_t *rx, std::size_t length);
+
+	static modm::ResumableResult<uint8_t>
+	transfer(uint8_t data);
+
+	static modm::ResumableResult<void>
+	transfer(uint8_t *tx, uint8_t *rx, std::size_t length);
+
+private:
+	static void
+	resetRegisters();
+
+	static uint8_t
+	exchange(uint8_t data);
+
+	static void
+	write(uint8_t address, uint8_t data);
+
+	static bool
+	matches(uint8_t filter, uint8_t mask, const uint8_t *frame);
+
+	static bool
+	store(uint8_t buffer, const uint8_t *frame);
+
+	enum class
+	State : uint8_t
+	{
+		Instruction,
+		Address,
+		Read,
+		Write,
+		Mask,
+		Modify,
+		Status,
+		Ignore,
+	};
+
+	static inline void* context{nullptr};
+	static inline uint8_t count{0};
+
+	static inline uint8_t registers[128];
+	static inline Statistics statistics{};
+
+	static inline State state{State::Ignore};
+	static inline State next{State::Ignore};
+	static inline uint8_t address{0};
+	static inline uint8_t mask{0};
+	static inline uint8_t status{0};
+	/// RXnIF flags to clear at the end of a READ RX BUFFER instruction
+	static inline uint8_t clearFlags{0};
+};
+
+} // namespace platform
+
+} // namespace modm_test
+
+#endif // MODM_TEST_MOCK_MCP2515_HPP
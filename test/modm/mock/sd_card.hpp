@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_TEST_MOCK_SD_CARD_HPP
+#define MODM_TEST_MOCK_SD_CARD_HPP
+
+#include <modm/architecture/interface/spi_master.hpp>
+#include <modm/driver/storage/sd_constants.hpp>
+
+namespace modm_test
+{
+
+namespace platform
+{
+
+/**
+ * Simulated SD card in SPI mode connected to a mock SPI master.
+ *
+ * The card decodes the bytes sent by the driver and answers with the
+ * responses, tokens and busy signals of a real card, so a driver can be
+ * tested on any target. The chip select is not simulated, since commands
+ * are recognized by their start bits. Only the first `Blocks` blocks are
+ * stored, the remaining capacity of an SDHC card answers with an address error.
+ *
+ * @ingroup modm_test_mock_sd_card
+ */
+class SdCard : public modm::SpiMaster
+{
+public:
+	static constexpr uint32_t Blocks = 8;
+
+	struct Statistics
+	{
+		/// Number of received commands indexed by command number
+		uint16_t commands[64];
+		/// Number of application commands indexed by command number
+		uint16_t appCommands[64];
+		/// Number of data blocks read and written by the driver
+		uint32_t blocksRead;
+		uint32_t blocksWritten;
+		/// Last pre-erase hint
+		uint32_t eraseCount;
+		/// Number of buffer transfers with at least a full block
+		uint32_t blockTransfers;
+		/// Number of bytes polled while the card was busy
+		uint32_t busyPolls;
+		/// Number of bytes other than 0xFF sent while the card sends data
+		uint32_t invalidFillBytes;
+	};
+
+public:
+	/// Powers up the card with erased blocks
+	static void
+	reset(modm::sd::CardType type = modm::sd::CardType::Sdhc);
+
+	/// Number of bytes the card stays busy after programming a block
+	static void
+	setBusyBytes(uint16_t bytes)
+	{ busyBytes = bytes; }
+
+	/// Rejects all written blocks with a write error
+	static void
+	setWriteProtected(bool enable)
+	{ writeProtected = enable; }
+
+	static uint8_t*
+	getBlock(uint32_t block)
+	{ return storage[block]; }
+
+	static const Statistics&
+	getStatistics()
+	{ return statistics; }
+
+public:
+	static void
+	initialize()
+	{
+	}
+
+	static void
+	setDataMode(DataMode)
+	{
+	}
+
+	static void
+	setDataOrder(DataOrder)
+	{
+	}
+
+	static uint8_t
+	acquire(void *ctx, ConfigurationHandler handler = nullptr);
+
+	static uint8_t
+	release(void *ctx);
+
+	static modm::ResumableResult<uint8_t>
+	transfer(uint8_t data);
+
+	static modm::ResumableResult<void>
+	transfer(const uint8_t *tx, uint8_t *rx, std::size_t length);
+
+private:
+	static uint8_t
+	exchange(uint8_t data);
+
+	static void
+	execute();
+
+	static bool
+	toBlock(uint32_t address, uint32_t &block);
+
+	enum class
+	State : uint8_t
+	{
+		Idle,
+		Command,
+		Response,
+		ReadToken,
+		ReadData,
+		WriteToken,
+		WriteData,
+		Busy,
+	};
+
+	static inline void* context{nullptr};
+	static inline uint8_t count{0};
+
+	static inline modm::sd::CardType cardType{modm::sd::CardType::Sdhc};
+	static inline uint8_t storage[Blocks][modm::sd::BlockSize];
+	static inline Statistics statistics{};
+	static inline uint16_t busyBytes{4};
+	static inline bool writeProtected{false};
+
+	static inline State state{State::Idle};
+	static inline State next{State::Idle};
+	static inline bool initialized{false};
+	static inline bool appCommand{false};
+	static inline bool multiple{false};
+	static inline uint8_t initializeRetries{0};
+
+	static inline uint8_t command[6];
+	static inline uint8_t response[8];
+	static inline uint8_t responseLength{0};
+	static inline uint8_t csd[16];
+	static inline const uint8_t *readData{nullptr};
+	static inline uint16_t readLength{0};
+	static inline uint32_t block{0};
+	static inline uint32_t eraseStart{0};
+	static inline uint32_t eraseEnd{0};
+	static inline bool accepted{false};
+	static inline uint16_t position{0};
+	static inline uint16_t busy{0};
+};
+
+} // namespace platform
+
+} // namespace modm_test
+
+#endif // MODM_TEST_MOCK_SD_CARD_HPP
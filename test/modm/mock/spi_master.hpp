@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2018, Raphael Lehmann
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -80,7 +81,7 @@ public:
 	}
 
 	static void
-	transferBlocking(uint8_t *tx, uint8_t *rx, std::size_t length)
+	transferBlocking(const uint8_t *tx, uint8_t *rx, std::size_t length)
 	{
 		RF_CALL_BLOCKING(transfer(tx, rx, length));
 	}
@@ -90,7 +91,7 @@ public:
 	transfer(uint8_t data);
 
 	static modm::ResumableResult<void>
-	transfer(uint8_t *tx, uint8_t *rx, std::size_t length);
+	transfer(const uint8_t *tx, uint8_t *rx, std::size_t length);
 
 public:
 	static std::size_t getTxBufferLength() {
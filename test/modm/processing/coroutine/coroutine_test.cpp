@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/processing/coroutine.hpp>
+#include <modm/processing/resumable.hpp>
+#include <unittest/benchmark.hpp>
+
+#include "coroutine_test.hpp"
+
+namespace
+{
+
+uint8_t entered;
+bool ready;
+
+modm::task<uint8_t>
+transfer(uint8_t value)
+{
+	entered++;
+	co_await modm::coroutine::yield();
+	entered++;
+	co_return value + 1;
+}
+
+modm::task<uint8_t>
+readRegister(uint8_t reg)
+{
+	co_return (co_await transfer(reg)) * 2;
+}
+
+modm::task<uint16_t>
+readData()
+{
+	const uint8_t first = co_await readRegister(1);
+	const uint8_t second = co_await readRegister(2);
+	co_return first + second;
+}
+
+modm::task<>
+waitForReady()
+{
+	entered++;
+	co_await modm::coroutine::wait_until([] { return ready; });
+	entered++;
+}
+
+modm::task<>
+waitNested()
+{
+	co_await waitForReady();
+}
+
+// the same nesting depth as a sensor driver reading a register over I2C
+modm::task<>
+level4()
+{
+	while (not ready) co_await modm::coroutine::yield();
+}
+
+modm::task<>
+level3()
+{ co_await level4(); }
+
+modm::task<>
+level2()
+{ co_await level3(); }
+
+modm::task<>
+level1()
+{ co_await level2(); }
+
+#ifndef MODM_RESUMABLE_IS_FIBER
+class NestedDriver : public modm::NestedResumable<4>
+{
+public:
+	modm::ResumableResult<void>
+	level1()
+	{
+		RF_BEGIN();
+		RF_CALL(level2());
+		RF_END();
+	}
+
+	modm::ResumableResult<void>
+	level2()
+	{
+		RF_BEGIN();
+		RF_CALL(level3());
+		RF_END();
+	}
+
+	modm::ResumableResult<void>
+	level3()
+	{
+		RF_BEGIN();
+		RF_CALL(level4());
+		RF_END();
+	}
+
+	modm::ResumableResult<void>
+	level4()
+	{
+		RF_BEGIN();
+		RF_WAIT_UNTIL(ready);
+		RF_END();
+	}
+};
+#endif
+
+}
+
+void
+CoroutineTest::testNesting()
+{
+	auto &pool = modm::coroutine::framePool();
+	{
+		entered = 0;
+		auto task = readData();
+		TEST_ASSERT_EQUALS(pool.getUsed(), 1u);
+		TEST_ASSERT_FALSE(task.done());
+		TEST_ASSERT_EQUALS(entered, 0);
+
+		TEST_ASSERT_TRUE(task.resume());
+		TEST_ASSERT_EQUALS(entered, 1);
+		TEST_ASSERT_EQUALS(pool.getUsed(), 3u);
+
+		// returns through two levels and calls the next register read
+		TEST_ASSERT_TRUE(task.resume());
+		TEST_ASSERT_EQUALS(entered, 3);
+		TEST_ASSERT_EQUALS(pool.getUsed(), 3u);
+
+		TEST_ASSERT_FALSE(task.resume());
+		TEST_ASSERT_TRUE(task.done());
+		TEST_ASSERT_EQUALS(entered, 4);
+		TEST_ASSERT_EQUALS(task.result(), (2 + 3) * 2);
+		TEST_ASSERT_EQUALS(pool.getUsed(), 1u);
+
+		TEST_ASSERT_FALSE(task.resume());
+	}
+	TEST_ASSERT_EQUALS(pool.getUsed(), 0u);
+
+	auto task = readData();
+	TEST_ASSERT_EQUALS(task.wait(), 10);
+}
+
+void
+CoroutineTest::testDestroy()
+{
+	auto &pool = modm::coroutine::framePool();
+	{
+		auto task = readData();
+		task.resume();
+		TEST_ASSERT_EQUALS(pool.getUsed(), 3u);
+
+		auto moved = std::move(task);
+		TEST_ASSERT_TRUE(task.done());
+		TEST_ASSERT_FALSE(task.resume());
+		TEST_ASSERT_FALSE(moved.done());
+	}
+	// destroying the outermost task destroys all awaited tasks
+	TEST_ASSERT_EQUALS(pool.getUsed(), 0u);
+}
+
+void
+CoroutineTest::testWaitUntil()
+{
+	entered = 0;
+	ready = false;
+	auto task = waitNested();
+
+	TEST_ASSERT_TRUE(task.resume());
+	TEST_ASSERT_EQUALS(entered, 1);
+	// only the condition is checked
+	TEST_ASSERT_TRUE(task.resume());
+	TEST_ASSERT_TRUE(task.resume());
+	TEST_ASSERT_EQUALS(entered, 1);
+
+	ready = true;
+	TEST_ASSERT_FALSE(task.resume());
+	TEST_ASSERT_EQUALS(entered, 2);
+
+	// no suspension if the condition is already true
+	entered = 0;
+	auto immediate = waitNested();
+	TEST_ASSERT_FALSE(immediate.resume());
+	TEST_ASSERT_EQUALS(entered, 2);
+}
+
+void
+CoroutineTest::testResumable()
+{
+	uint8_t calls = 0;
+	auto read = [&calls]() -> modm::task<uint8_t>
+	{
+#ifdef MODM_RESUMABLE_IS_FIBER
+		co_return co_await modm::coroutine::resumable([&calls]() -> modm::ResumableResult<uint8_t>
+		{
+			calls++;
+			return 42;
+		});
+#else
+		co_return co_await modm::coroutine::resumable([&calls]() -> modm::ResumableResult<uint8_t>
+		{
+			if (++calls < 3) return {modm::rf::Running};
+			return {modm::rf::Stop, 42};
+		});
+#endif
+	};
+	auto task = read();
+	while (task.resume()) ;
+	TEST_ASSERT_EQUALS(task.result(), 42);
+#ifdef MODM_RESUMABLE_IS_FIBER
+	TEST_ASSERT_EQUALS(calls, 1);
+#else
+	TEST_ASSERT_EQUALS(calls, 3);
+#endif
+}
+
+void
+CoroutineTest::testBenchmark()
+{
+	ready = false;
+	auto task = level1();
+	task.resume();
+	TEST_BENCHMARK("nested", [&] { task.resume(); });
+	TEST_ASSERT_FALSE(task.done());
+
+#ifndef MODM_RESUMABLE_IS_FIBER
+	NestedDriver driver;
+	TEST_BENCHMARK("nested_macro", [&] { driver.level1(); });
+	TEST_ASSERT_TRUE(driver.isResumableRunning());
+#endif
+	ready = true;
+	TEST_ASSERT_FALSE(task.resume());
+}
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/processing/protothread/scheduler.hpp>
+#include <modm/processing/timer.hpp>
+#include <modm-test/mock/clock.hpp>
+
+#include "protothread_scheduler_test.hpp"
+
+using test_clock = modm_test::chrono::milli_clock;
+using namespace std::chrono_literals;
+
+namespace
+{
+
+class TimeoutThread : public modm::pt::Protothread
+{
+public:
+	bool
+	run()
+	{
+		runs++;
+		PT_BEGIN();
+		timeout.restart(10ms);
+		PT_WAIT_FOR(timeout);
+		state = 1;
+		PT_END();
+	}
+
+	modm::Timeout timeout;
+	uint8_t runs{0};
+	uint8_t state{0};
+};
+
+class FlagThread : public modm::pt::Protothread
+{
+public:
+	bool
+	run()
+	{
+		runs++;
+		PT_BEGIN();
+		PT_WAIT_FOR(flag);
+		state = 1;
+		timeout.restart(5ms);
+		PT_WAIT_FOR(flag2, timeout);
+		state = 2;
+		PT_YIELD();
+		state = 3;
+		PT_END();
+	}
+
+	modm::Timeout timeout;
+	volatile bool flag{false};
+	volatile bool flag2{false};
+	uint8_t runs{0};
+	uint8_t state{0};
+};
+
+class SemaphoreThread : public modm::pt::Protothread
+{
+public:
+	SemaphoreThread(modm::pt::Semaphore &semaphore) : semaphore(semaphore) {}
+
+	bool
+	run()
+	{
+		runs++;
+		PT_BEGIN();
+		PT_WAIT_FOR(semaphore);
+		acquired = true;
+		PT_END();
+	}
+
+	modm::pt::Semaphore &semaphore;
+	uint8_t runs{0};
+	bool acquired{false};
+};
+
+class YieldThread : public modm::pt::Protothread
+{
+public:
+	bool
+	run()
+	{
+		runs++;
+		PT_BEGIN();
+		while (true) PT_YIELD();
+		PT_END();
+	}
+
+	uint8_t runs{0};
+};
+
+class CompoundThread : public modm::pt::Protothread
+{
+public:
+	CompoundThread(modm::pt::Semaphore &first, modm::pt::Semaphore &second) :
+		first(first), second(second) {}
+
+	bool
+	run()
+	{
+		runs++;
+		PT_BEGIN();
+		while (true)
+		{
+			PT_WAIT_FOR(flags[0], flags[1], first, second);
+			flags[0] = flags[1] = false;
+			wakeups++;
+			PT_WAIT_FOR(flags[2], flags[3], flags[4], flags[5], flags[6]);
+			flags[6] = false;
+			wakeups++;
+		}
+		PT_END();
+	}
+
+	modm::pt::Semaphore &first;
+	modm::pt::Semaphore &second;
+	volatile bool flags[7]{};
+	uint8_t runs{0};
+	uint8_t wakeups{0};
+};
+
+class ParentThread : public modm::pt::Protothread
+{
+public:
+	bool
+	run()
+	{
+		runs++;
+		PT_BEGIN();
+		PT_WAIT_THREAD(child);
+		state = 1;
+		child.restart();
+		PT_WAIT_UNTIL(not child.run() or cancelled);
+		state = 2;
+		PT_END();
+	}
+
+	FlagThread child;
+	bool cancelled{false};
+	uint8_t runs{0};
+	uint8_t state{0};
+};
+
+}
+
+void
+ProtothreadSchedulerTest::setUp()
+{
+	test_clock::setTime(1000);
+}
+
+void
+ProtothreadSchedulerTest::testTimeout()
+{
+	TimeoutThread thread;
+	modm::pt::Scheduler<2> scheduler;
+	scheduler.add(thread);
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+
+	TEST_ASSERT_TRUE(scheduler.run());
+	TEST_ASSERT_EQUALS(thread.runs, 1);
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::time_point{1010ms});
+
+	// the parked protothread is not run
+	test_clock::setTime(1009);
+	TEST_ASSERT_TRUE(scheduler.run());
+	TEST_ASSERT_EQUALS(thread.runs, 1);
+
+	test_clock::setTime(1010);
+	TEST_ASSERT_FALSE(scheduler.run());
+	TEST_ASSERT_EQUALS(thread.runs, 2);
+	TEST_ASSERT_EQUALS(thread.state, 1);
+	TEST_ASSERT_FALSE(scheduler.nextWakeup().has_value());
+
+	// restarted protothreads are run again
+	thread.restart();
+	TEST_ASSERT_TRUE(scheduler.run());
+	TEST_ASSERT_EQUALS(thread.runs, 3);
+}
+
+void
+ProtothreadSchedulerTest::testFlag()
+{
+	FlagThread thread;
+	modm::pt::Scheduler<1> scheduler;
+	scheduler.add(thread);
+
+	scheduler.run();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, 1);
+	// only an interrupt can wake up the protothread
+	TEST_ASSERT_FALSE(scheduler.nextWakeup().has_value());
+
+	thread.flag = true;
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, 2);
+	TEST_ASSERT_EQUALS(thread.state, 1);
+
+	thread.flag2 = true;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.state, 2);
+}
+
+void
+ProtothreadSchedulerTest::testSemaphore()
+{
+	modm::pt::Semaphore semaphore(0);
+	SemaphoreThread first(semaphore), second(semaphore);
+	modm::pt::Scheduler<2> scheduler;
+	scheduler.add(first);
+	scheduler.add(second);
+
+	scheduler.run();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(first.runs, 1);
+	TEST_ASSERT_EQUALS(second.runs, 1);
+
+	semaphore.release();
+	scheduler.run();
+	TEST_ASSERT_TRUE(first.acquired);
+	TEST_ASSERT_FALSE(second.acquired);
+	// the first protothread took the semaphore, so the second stays parked
+	TEST_ASSERT_EQUALS(second.runs, 1);
+	TEST_ASSERT_FALSE(semaphore.isAvailable());
+
+	semaphore.release();
+	scheduler.run();
+	TEST_ASSERT_TRUE(second.acquired);
+	TEST_ASSERT_EQUALS(second.runs, 2);
+	TEST_ASSERT_FALSE(scheduler.run());
+}
+
+void
+ProtothreadSchedulerTest::testMultipleSources()
+{
+	FlagThread thread;
+	thread.flag = true;
+	modm::pt::Scheduler<1> scheduler;
+	scheduler.add(thread);
+
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.state, 1);
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::time_point{1005ms});
+
+	test_clock::setTime(1005);
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.state, 2);
+	// the yield is not parked on the flag any more
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.state, 3);
+}
+
+void
+ProtothreadSchedulerTest::testPolling()
+{
+	YieldThread yielding;
+	TimeoutThread timed;
+	modm::pt::Scheduler<2> scheduler;
+	scheduler.add(yielding);
+	scheduler.add(timed);
+
+	for (uint8_t ii = 0; ii < 5; ii++) scheduler.run();
+	TEST_ASSERT_EQUALS(yielding.runs, 5);
+	TEST_ASSERT_EQUALS(timed.runs, 1);
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+
+	// without a scheduler the wait is evaluated on every call
+	TimeoutThread thread;
+	thread.run();
+	thread.run();
+	TEST_ASSERT_EQUALS(thread.runs, 2);
+	test_clock::setTime(1010);
+	TEST_ASSERT_FALSE(thread.run());
+	TEST_ASSERT_EQUALS(thread.state, 1);
+}
+
+void
+ProtothreadSchedulerTest::testChild()
+{
+	ParentThread thread;
+	modm::pt::Scheduler<1> scheduler;
+	scheduler.add(thread);
+
+	// the parent is parked on the flag of the child
+	scheduler.run();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, 1);
+	TEST_ASSERT_FALSE(scheduler.nextWakeup().has_value());
+
+	thread.child.flag = true;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.child.state, 1);
+	thread.child.flag = false;
+	thread.child.flag2 = true;
+	scheduler.run();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.state, 1);
+
+	// a compound condition is polled, even though the child is parked
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+	const uint8_t runs = thread.runs;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, runs + 1);
+	thread.cancelled = true;
+	TEST_ASSERT_FALSE(scheduler.run());
+	TEST_ASSERT_EQUALS(thread.state, 2);
+}
+
+void
+ProtothreadSchedulerTest::testCompoundSources()
+{
+	modm::pt::Semaphore first(0), second(0);
+	CompoundThread thread(first, second);
+	modm::pt::Scheduler<1> scheduler;
+	scheduler.add(thread);
+
+	scheduler.run();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, 1);
+	TEST_ASSERT_FALSE(scheduler.nextWakeup().has_value());
+
+	// every source of the compound wait wakes up the protothread
+	thread.flags[0] = true;
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.wakeups, 1);
+	// more sources than can be watched are polled
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, 3);
+	TEST_ASSERT_TRUE(*scheduler.nextWakeup() == modm::Clock::now());
+	thread.flags[6] = true;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.wakeups, 2);
+
+	TEST_ASSERT_FALSE(scheduler.nextWakeup().has_value());
+	const uint8_t runs = thread.runs;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.runs, runs);
+	first.release();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.wakeups, 3);
+	TEST_ASSERT_FALSE(first.isAvailable());
+
+	thread.flags[6] = true;
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.wakeups, 4);
+	second.release();
+	scheduler.run();
+	TEST_ASSERT_EQUALS(thread.wakeups, 5);
+	TEST_ASSERT_FALSE(second.isAvailable());
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#include <modm/utils/monotonic_arena.hpp>
+#include <modm/utils/pool_allocator.hpp>
+#include <modm/utils/resource_allocator.hpp>
+#include <modm/utils/memory_resource.hpp>
+#include <modm/container/dynamic_array.hpp>
+#include <modm/container/linked_list.hpp>
+
+#include "arena_test.hpp"
+
+namespace
+{
+	alignas(16) uint8_t buffer[512];
+}
+
+void
+ArenaTest::testMonotonicArena()
+{
+	modm::MonotonicArena arena(buffer);
+	TEST_ASSERT_EQUALS(arena.getSize(), sizeof(buffer));
+	TEST_ASSERT_EQUALS(arena.getUsed(), 0u);
+
+	uint8_t *a = static_cast<uint8_t *>(arena.allocate(3, 1));
+	TEST_ASSERT_TRUE(a == buffer);
+	uint8_t *b = static_cast<uint8_t *>(arena.allocate(8, 8));
+	TEST_ASSERT_TRUE(b == buffer + 8);
+	TEST_ASSERT_EQUALS(arena.getUsed(), 16u);
+	TEST_ASSERT_TRUE(arena.contains(b));
+
+	// only the last allocation is given back
+	arena.deallocate(a, 3);
+	TEST_ASSERT_EQUALS(arena.getUsed(), 16u);
+	arena.deallocate(b, 8);
+	TEST_ASSERT_EQUALS(arena.getUsed(), 8u);
+
+	TEST_ASSERT_TRUE(arena.allocate(sizeof(buffer)) == nullptr);
+	TEST_ASSERT_TRUE(arena.allocate(sizeof(buffer) - 8, 8) != nullptr);
+	TEST_ASSERT_EQUALS(arena.getAvailable(), 0u);
+	TEST_ASSERT_TRUE(arena.allocate(1, 1) == nullptr);
+
+	arena.reset();
+	TEST_ASSERT_EQUALS(arena.getUsed(), 0u);
+	TEST_ASSERT_EQUALS(arena.getPeak(), sizeof(buffer));
+	TEST_ASSERT_TRUE(arena.allocate(1, 1) == buffer);
+}
+
+void
+ArenaTest::testMonotonicArenaTraits()
+{
+	modm::MonotonicArena arena(100, modm::MemoryDefault);
+	TEST_ASSERT_EQUALS(arena.getSize(), 100u);
+	void *ptr = arena.allocate(100, 1);
+	TEST_ASSERT_TRUE(ptr != nullptr);
+	TEST_ASSERT_TRUE(arena.contains(ptr));
+	TEST_ASSERT_FALSE(arena.contains(buffer));
+}
+
+void
+ArenaTest::testPoolAllocator()
+{
+	modm::PoolAllocator pool(buffer, 24, 8);
+	TEST_ASSERT_EQUALS(pool.getBlockSize(), 24u);
+	TEST_ASSERT_EQUALS(pool.getBlockCount(), sizeof(buffer) / 24);
+
+	TEST_ASSERT_TRUE(pool.allocate(25) == nullptr);
+	TEST_ASSERT_TRUE(pool.allocate(8, 16) == nullptr);
+
+	void *a = pool.allocate(24);
+	void *b = pool.allocate(1);
+	TEST_ASSERT_TRUE(a == buffer);
+	TEST_ASSERT_TRUE(b == buffer + 24);
+	TEST_ASSERT_EQUALS(pool.getUsed(), 2u);
+
+	// freed blocks are reused first
+	pool.deallocate(a);
+	TEST_ASSERT_EQUALS(pool.getUsed(), 1u);
+	TEST_ASSERT_TRUE(pool.allocate(4) == a);
+
+	while (pool.allocate(24)) ;
+	TEST_ASSERT_EQUALS(pool.getAvailable(), 0u);
+	TEST_ASSERT_EQUALS(pool.getPeak(), pool.getBlockCount());
+
+	pool.reset();
+	TEST_ASSERT_EQUALS(pool.getUsed(), 0u);
+	TEST_ASSERT_TRUE(pool.allocate(4) == buffer);
+
+	modm::PoolAllocator heapPool(16, 4, modm::MemoryDefault);
+	TEST_ASSERT_EQUALS(heapPool.getBlockCount(), 4u);
+}
+
+void
+ArenaTest::testContainers()
+{
+	modm::MonotonicArena arena(buffer);
+	{
+		modm::DynamicArray<uint16_t, modm::ResourceAllocator<uint16_t, modm::MonotonicArena>> array(10, arena);
+		for (uint16_t ii = 0; ii < 10; ii++) array.append(ii);
+		TEST_ASSERT_EQUALS(array.getSize(), 10u);
+		TEST_ASSERT_EQUALS(array[9], 9);
+		TEST_ASSERT_EQUALS(arena.getUsed(), 20u);
+	}
+	// the array was the last allocation
+	TEST_ASSERT_EQUALS(arena.getUsed(), 0u);
+
+	modm::PoolAllocator pool(buffer, 32, 8);
+	{
+		modm::LinkedList<uint32_t, modm::ResourceAllocator<uint32_t, modm::PoolAllocator>> list(pool);
+		for (uint32_t ii = 0; ii < 5; ii++) list.append(ii);
+		TEST_ASSERT_EQUALS(pool.getUsed(), 5u);
+		list.removeFront();
+		TEST_ASSERT_EQUALS(pool.getUsed(), 4u);
+		TEST_ASSERT_EQUALS(list.getFront(), 1u);
+	}
+	TEST_ASSERT_EQUALS(pool.getUsed(), 0u);
+}
+
+void
+ArenaTest::testMemoryResource()
+{
+	modm::PoolAllocator pool(buffer, 32, 8);
+	modm::MemoryResource<modm::PoolAllocator> resource(pool, std::pmr::new_delete_resource());
+	{
+		modm::DoublyLinkedList<int, std::pmr::polymorphic_allocator<int>> list(&resource);
+		list.append(1);
+		list.append(2);
+		TEST_ASSERT_EQUALS(pool.getUsed(), 2u);
+
+		// too large for the pool, so it comes from the upstream resource
+		void *ptr = resource.allocate(100);
+		TEST_ASSERT_FALSE(pool.contains(ptr));
+		resource.deallocate(ptr, 100);
+	}
+	TEST_ASSERT_EQUALS(pool.getUsed(), 0u);
+	TEST_ASSERT_TRUE(resource.is_equal(resource));
+}
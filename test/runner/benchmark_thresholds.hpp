@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026, modm authors
+ *
+ * This file is part of the modm project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+// ----------------------------------------------------------------------------
+
+#ifndef MODM_TEST_BENCHMARK_THRESHOLDS_HPP
+#define MODM_TEST_BENCHMARK_THRESHOLDS_HPP
+
+#include <unittest/reporter.hpp>
+
+// Maximum median per call in nanoseconds of the hosted benchmarks. The limits
+// are about ten times the median of a release build on a current desktop CPU,
+// so that only real regressions fail on slower CI machines.
+static constexpr unittest::BenchmarkThreshold benchmarkThresholds[] =
+{
+	{"crc.crc8", 10'000},
+	{"crc.crc16", 5'000},
+	{"crc.crc32", 10'000},
+	{"dynamic_array.append", 5'000},
+	{"fatfs_block_device.file_read", 100'000},
+	{"fatfs_block_device.file_write", 100'000},
+	{"fatfs_block_device.file_write_unaligned", 400'000},
+	{"io_stream.integer", 10'000},
+	{"io_stream.printf", 20'000},
+};
+
+#endif // MODM_TEST_BENCHMARK_THRESHOLDS_HPP
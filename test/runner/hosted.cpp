@@ -4,6 +4,7 @@
  * Copyright (c) 2012, Sascha Schade
  * Copyright (c) 2014, 2016, 2018, Niklas Hauser
  * Copyright (c) 2015, Kevin Läufer
+ * Copyright (c) 2026, modm authors
  *
  * This file is part of the modm project.
  *
@@ -14,6 +15,7 @@
 // ----------------------------------------------------------------------------
 
 #include <unittest/reporter.hpp>
+#include <unittest/testsuite.hpp>
 
 #include <modm/debug/logger.hpp>
 #include <modm/platform.hpp>
@@ -22,6 +24,22 @@
 #include <info_git.h>
 #include <info_build.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifndef MODM_OS_WIN32
+#	include <poll.h>
+#	include <sys/wait.h>
+#	include <unistd.h>
+#endif
+
+#include "benchmark_thresholds.hpp"
+
 modm::Terminal outputDevice;
 namespace unittest
 {
@@ -44,8 +62,211 @@ modm::log::StyleWrapper< modm::log::Prefix< char[10] > > loggerDeviceError( \
 		modm::log::Prefix< char[10] >("Error  : ", outputDevice ));
 modm::log::Logger modm::log::error(loggerDeviceError);
 
-int main()
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct SuiteResult
+{
+	std::string output;
+	int_fast16_t passed{0};
+	int_fast16_t failed{0};
+	int status{0};
+	Clock::duration duration{};
+	bool done{false};
+};
+
+std::vector<SuiteResult> results;
+
+void
+printTimings()
+{
+	static constexpr std::size_t Slowest = 10;
+
+	std::vector<std::size_t> order(unittest::testSuiteCount);
+	for (std::size_t ii = 0; ii < order.size(); ii++) order[ii] = ii;
+	std::stable_sort(order.begin(), order.end(), [](std::size_t a, std::size_t b)
+			{ return results[a].duration > results[b].duration; });
+
+	modm::IOStream stream(outputDevice);
+	stream << "\nSlowest test suites:\n";
+	for (std::size_t ii = 0; ii < std::min(Slowest, order.size()); ii++)
+	{
+		using namespace std::chrono;
+		const auto ms = duration_cast<milliseconds>(results[order[ii]].duration).count();
+		stream.printf("%8lu ms  %s\n", static_cast<unsigned long>(ms),
+					  unittest::testSuites[order[ii]].name);
+	}
+}
+
+void
+runSerial()
+{
+	for (std::size_t ii = 0; ii < unittest::testSuiteCount; ii++)
+	{
+		const auto start = Clock::now();
+		unittest::reporter.nextTestSuite(modm::accessor::asFlash(unittest::testSuites[ii].name));
+		unittest::testSuites[ii].run();
+		results[ii].duration = Clock::now() - start;
+	}
+}
+
+#ifndef MODM_OS_WIN32
+struct Worker
+{
+	pid_t pid;
+	int output;
+	int counts;
+	std::size_t suite;
+	Clock::time_point start;
+};
+
+Worker
+spawn(std::size_t suite)
+{
+	int output[2], counts[2];
+	if (pipe(output) or pipe(counts))
+	{
+		MODM_LOG_ERROR << "Unable to create pipes for the test suite!" << modm::endl;
+		std::exit(2);
+	}
+	// otherwise the child flushes the buffered output a second time
+	outputDevice.flush();
+
+	const auto start = Clock::now();
+	const pid_t pid = fork();
+	if (pid < 0)
+	{
+		MODM_LOG_ERROR << "Unable to fork the test suite!" << modm::endl;
+		std::exit(2);
+	}
+	if (pid == 0)
+	{
+		close(output[0]);
+		close(counts[0]);
+		dup2(output[1], STDOUT_FILENO);
+		dup2(output[1], STDERR_FILENO);
+		close(output[1]);
+
+		// the reporter also contains the results of previous suites
+		const int_fast16_t passed = unittest::reporter.getPassed();
+		const int_fast16_t failed = unittest::reporter.getFailed();
+		unittest::reporter.nextTestSuite(modm::accessor::asFlash(unittest::testSuites[suite].name));
+		unittest::testSuites[suite].run();
+		outputDevice.flush();
+
+		const int_fast16_t result[2] = {
+				int_fast16_t(unittest::reporter.getPassed() - passed),
+				int_fast16_t(unittest::reporter.getFailed() - failed)};
+		const bool written = write(counts[1], result, sizeof(result)) == sizeof(result);
+		_exit(written ? 0 : 2);
+	}
+	close(output[1]);
+	close(counts[1]);
+	return {pid, output[0], counts[0], suite, start};
+}
+
+void
+finish(const Worker &worker)
 {
+	SuiteResult &result = results[worker.suite];
+	waitpid(worker.pid, &result.status, 0);
+	result.duration = Clock::now() - worker.start;
+
+	int_fast16_t counts[2];
+	if (read(worker.counts, counts, sizeof(counts)) == sizeof(counts) and
+		WIFEXITED(result.status) and WEXITSTATUS(result.status) == 0)
+	{
+		result.passed = counts[0];
+		result.failed = counts[1];
+		result.status = 0;
+	}
+	close(worker.output);
+	close(worker.counts);
+	result.done = true;
+}
+
+void
+print(std::size_t suite)
+{
+	const SuiteResult &result = results[suite];
+	outputDevice.write(result.output.c_str());
+
+	int_fast16_t failed = result.failed;
+	if (result.status)
+	{
+		// the suite did not finish, so its partial results are lost
+		modm::IOStream stream(outputDevice);
+		stream << "FAIL: " << unittest::testSuites[suite].name << " : ";
+		if (WIFSIGNALED(result.status))
+			stream << "terminated by signal " << WTERMSIG(result.status) << '\n';
+		else
+			stream << "exited with code " << WEXITSTATUS(result.status) << '\n';
+		failed++;
+	}
+	unittest::reporter.addResults(result.passed, failed);
+}
+
+/// Runs every suite in its own process, at most `jobs` at a time, and prints
+/// their output in the order of the suites.
+void
+runForked(std::size_t jobs)
+{
+	std::vector<Worker> workers;
+	std::size_t next = 0;
+	std::size_t printed = 0;
+	while (printed < unittest::testSuiteCount)
+	{
+		while (next < unittest::testSuiteCount and workers.size() < jobs)
+			workers.push_back(spawn(next++));
+
+		std::vector<pollfd> fds;
+		for (const Worker &worker : workers)
+			fds.push_back({worker.output, POLLIN, 0});
+		if (poll(fds.data(), fds.size(), -1) < 0) continue;
+
+		for (std::size_t ii = workers.size(); ii-- > 0; )
+		{
+			if (not fds[ii].revents) continue;
+			char buffer[4096];
+			const ssize_t size = read(workers[ii].output, buffer, sizeof(buffer));
+			if (size > 0) {
+				results[workers[ii].suite].output.append(buffer, size);
+			} else {
+				finish(workers[ii]);
+				workers.erase(workers.begin() + ii);
+			}
+		}
+		while (printed < next and results[printed].done)
+			print(printed++);
+	}
+}
+#endif
+
+}	// anonymous namespace
+
+int main(int argc, char *argv[])
+{
+	std::size_t jobs = 1;
+	bool isolate = false;
+	for (int ii = 1; ii < argc; ii++)
+	{
+		const std::string_view arg(argv[ii]);
+		if ((arg == "-j" or arg == "--jobs") and ii + 1 < argc)
+			jobs = std::strtoul(argv[++ii], nullptr, 10);
+		else if (arg.starts_with("--jobs="))
+			jobs = std::strtoul(argv[ii] + 7, nullptr, 10);
+		else if (arg == "--fork")
+			isolate = true;
+		else
+		{
+			MODM_LOG_ERROR << "Usage: " << argv[0] << " [--jobs N] [--fork]" << modm::endl;
+			return 2;
+		}
+	}
+	if (jobs == 0) jobs = std::max(1u, std::thread::hardware_concurrency());
+
 	MODM_LOG_INFO << "Machine:  " << MODM_BUILD_MACHINE  << modm::endl;
 	MODM_LOG_INFO << "User:     " << MODM_BUILD_USER     << modm::endl;
 	MODM_LOG_INFO << "Os:       " << MODM_BUILD_OS       << modm::endl;
@@ -76,6 +297,17 @@ int main()
 	MODM_LOG_INFO << "Copied:    " << MODM_GIT_COPIED    << modm::endl;
 	MODM_LOG_INFO << "Untracked: " << MODM_GIT_UNTRACKED << modm::endl;
 
-	extern int run_modm_unit_test();
-	return run_modm_unit_test();
+	unittest::reporter.setBenchmarkThresholds(benchmarkThresholds,
+			sizeof(benchmarkThresholds) / sizeof(benchmarkThresholds[0]));
+
+	results.resize(unittest::testSuiteCount);
+#ifndef MODM_OS_WIN32
+	if (jobs > 1 or isolate)
+		runForked(jobs);
+	else
+#endif
+		runSerial();
+
+	printTimings();
+	return unittest::reporter.printSummary();
 }
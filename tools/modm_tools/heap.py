@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026, modm authors
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+r"""
+### Heap Profile
+
+Symbolizes the heap profile recorded by the `modm:debug:heap` module, either
+the text written by `modm::HeapProfiler::dump()` or a CrashCatcher coredump of
+the `modm:platform:fault` module, which contains the profile as well:
+
+```sh
+python3 -m modm_tools.heap path/to/project.elf heap.txt
+python3 -m modm_tools.heap path/to/project.elf coredump.txt --leaks
+```
+
+The call sites are resolved with `addr2line` of the toolchain matching the ELF
+file, which can be overwritten with `--addr2line`.
+"""
+
+import re
+import struct
+import subprocess
+
+MAGIC = 0x3170686d
+BUCKETS = ["<= {}".format(8 << i) for i in range(12)] + ["> 16384"]
+
+
+# -----------------------------------------------------------------------------
+class Profile:
+    def __init__(self):
+        self.untracked = 0
+        self.histogram = []
+        self.pools = []
+        self.sites = []
+        self.leaks = []
+
+    @staticmethod
+    def from_text(text):
+        profile = Profile()
+        # only use the last dump, other output may be interleaved
+        text = text[text.rfind("heap profile"):]
+        for line in text.splitlines():
+            fields = line.split()
+            if not fields or fields[0] == "end": break
+            values = [int(v, 0) for v in fields[1::2]] if fields[0] in ("pool", "site", "leak") else []
+            if fields[0] == "untracked":
+                profile.untracked = int(fields[1])
+            elif fields[0] == "histogram":
+                profile.histogram = [int(v) for v in fields[1:]]
+            elif fields[0] == "pool":
+                profile.pools.append(dict(zip(("traits", "live", "bytes", "peak"), values)))
+            elif fields[0] == "site":
+                profile.sites.append(dict(zip(("caller", "allocations", "live", "bytes", "peak"), values)))
+            elif fields[0] == "leak":
+                profile.leaks.append(dict(zip(("pointer", "size", "caller"), values)))
+        return profile
+
+    @staticmethod
+    def from_binary(data):
+        offset = data.find(struct.pack("<I", MAGIC))
+        if offset < 0:
+            raise ValueError("No heap profile found in dump")
+        _, psize, buckets, pools, sites, records, _, untracked = \
+            struct.unpack_from("<IBBBBHHI", data, offset)
+        pointer = "I" if psize == 4 else "Q"
+        align = lambda o: o + (-(o - offset) % psize)
+
+        profile = Profile()
+        profile.untracked = untracked
+        offset += 16
+        profile.histogram = list(struct.unpack_from("<{}I".format(buckets), data, offset))
+        offset += buckets * 4
+        for _ in range(pools):
+            pool = dict(zip(("traits", "live", "bytes", "peak"), struct.unpack_from("<4I", data, offset)))
+            if pool["peak"]: profile.pools.append(pool)
+            offset += 16
+        offset = align(offset)
+        site_format = "<{}4I".format(pointer)
+        callers = []
+        for _ in range(sites):
+            site = dict(zip(("caller", "allocations", "live", "bytes", "peak"),
+                            struct.unpack_from(site_format, data, offset)))
+            callers.append(site["caller"])
+            if site["allocations"]: profile.sites.append(site)
+            offset = align(offset + struct.calcsize(site_format))
+        record_format = "<{}IBBH".format(pointer)
+        for _ in range(records):
+            ptr, size, site, _, _ = struct.unpack_from(record_format, data, offset)
+            if ptr: profile.leaks.append({"pointer": ptr, "size": size, "caller": callers[site]})
+            offset = align(offset + struct.calcsize(record_format))
+        return profile
+
+
+def read(source):
+    with open(source, "rb") as file:
+        data = file.read()
+    if b"heap profile" in data:
+        return Profile.from_text(data.decode("utf-8", "replace"))
+    # a coredump is stored as hexadecimal text, otherwise it is raw binary
+    text = data.decode("ascii", "replace")
+    if re.fullmatch(r"(\s|0x|[0-9a-fA-F])*", text):
+        data = bytes.fromhex(re.sub(r"0x|\s", "", text))
+    return Profile.from_binary(data)
+
+
+# -----------------------------------------------------------------------------
+def _default_addr2line(elf):
+    with open(elf, "rb") as file:
+        header = file.read(20)
+    # EM_ARM
+    if header[:4] == b"\x7fELF" and struct.unpack_from("<H", header, 18)[0] == 40:
+        return "arm-none-eabi-addr2line"
+    return "addr2line"
+
+
+def symbolize(elf, addresses, addr2line=None):
+    """Maps return addresses to the source location of the call"""
+    addresses = sorted(set(addresses))
+    if not addresses: return {}
+    # the return address points behind the call instruction
+    command = [addr2line or _default_addr2line(elf), "-f", "-C", "-p", "-e", elf]
+    command += ["0x{:x}".format(max(a - 1, 0)) for a in addresses]
+    try:
+        output = subprocess.run(command, capture_output=True, text=True, check=True).stdout
+    except (OSError, subprocess.CalledProcessError):
+        return {a: "0x{:x}".format(a) for a in addresses}
+    return dict(zip(addresses, (l.strip() for l in output.splitlines())))
+
+
+def format_profile(profile, symbols, leaks=False):
+    lines = []
+    live = sum(p["live"] for p in profile.pools)
+    size = sum(p["bytes"] for p in profile.pools)
+    lines.append("{} live allocations with {} bytes, {} untracked allocations"
+                 .format(live, size, profile.untracked))
+
+    lines.append("\nPools by requested memory traits:")
+    for pool in profile.pools:
+        lines.append("  0x{traits:04x}: {live:6} live {bytes:8} bytes {peak:8} peak".format(**pool))
+
+    lines.append("\nAllocation sizes:")
+    for name, count in zip(BUCKETS, profile.histogram):
+        if count: lines.append("  {:>8}: {}".format(name, count))
+
+    lines.append("\nCall sites by live bytes:")
+    for site in sorted(profile.sites, key=lambda s: (s["bytes"], s["peak"]), reverse=True):
+        lines.append("  {bytes:8} bytes {live:6} live {allocations:8} total {peak:8} peak  ".format(**site)
+                     + symbols.get(site["caller"], "0x{:x}".format(site["caller"])))
+
+    if leaks and profile.leaks:
+        lines.append("\nLive allocations:")
+        for leak in sorted(profile.leaks, key=lambda l: l["caller"]):
+            lines.append("  0x{pointer:08x} {size:8} bytes  ".format(**leak)
+                         + symbols.get(leak["caller"], "0x{:x}".format(leak["caller"])))
+    return "\n".join(lines)
+
+
+# -----------------------------------------------------------------------------
+if __name__ == "__main__":
+    import argparse
+
+    parser = argparse.ArgumentParser(description="Symbolize a heap profile.")
+    parser.add_argument(
+            dest="elf",
+            metavar="ELF",
+            help="The image the profile was recorded with.")
+    parser.add_argument(
+            dest="source",
+            metavar="DUMP",
+            help="The text dump of the profiler or a coredump.")
+    parser.add_argument(
+            "--leaks",
+            action="store_true",
+            help="List all live allocations.")
+    parser.add_argument(
+            "--addr2line",
+            help="The addr2line binary to use.")
+
+    args = parser.parse_args()
+    profile = read(args.source)
+    callers = [s["caller"] for s in profile.sites] + [l["caller"] for l in profile.leaks]
+    print(format_profile(profile, symbolize(args.elf, callers, args.addr2line), args.leaks))
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026, modm authors
+#
+# This file is part of the modm project.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at http://mozilla.org/MPL/2.0/.
+# -----------------------------------------------------------------------------
+
+r"""
+### Deferred Log Decoder
+
+Binary log records written by the `MODM_DLOG_*` macros of the `modm:debug`
+module or by `modm::platform::Rtt::writeRecord()` only contain a reference
+to the format string and the raw arguments. This tool looks up the format
+strings in the ELF file and formats the records on the host:
+
+```sh
+python3 -m modm_tools.log path/to/project.elf log.bin
+```
+
+Pass `-` to decode a live stream from stdin, for example from an RTT channel:
+
+```sh
+nc localhost 9090 | python3 -m modm_tools.log path/to/project.elf -
+```
+
+Bytes outside of records are passed through as text, so binary records can
+be mixed with the output of the stream loggers on the same channel.
+"""
+
+import re
+import struct
+
+LEVELS = ["debug", "info", "warning", "error"]
+SYNC_DEFERRED = 0xA0
+SYNC_RTT = 0xA5
+HEADER_DEFERRED = 2 + 4
+
+# flags, width, precision, length modifier and conversion of printf
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGaAcspn%])")
+
+
+# -----------------------------------------------------------------------------
+class Image:
+    def __init__(self, source):
+        from elftools.elf.elffile import ELFFile
+        with open(source, "rb") as src:
+            elf = ELFFile(src)
+            avr = elf["e_machine"] == "EM_AVR"
+            self.pointer_size = 2 if avr else elf.elfclass // 8
+            self.long_size = 4 if avr else elf.elfclass // 8
+            self.double_size = 4 if avr else 8
+            self.sections = [(s["sh_addr"], s.data()) for s in elf.iter_sections()
+                             if s["sh_flags"] & 0x2 and s["sh_type"] != "SHT_NOBITS"]
+            self.anchor = None
+            symbols = elf.get_section_by_name(".symtab")
+            if symbols is not None:
+                anchor = symbols.get_symbol_by_name("modm_log_anchor")
+                if anchor:
+                    self.anchor = anchor[0]["st_value"]
+        self.strings = {}
+
+    def string(self, address):
+        if address not in self.strings:
+            for start, data in self.sections:
+                if start <= address < start + len(data):
+                    end = data.find(b"\0", address - start)
+                    self.strings[address] = data[address - start:end].decode("utf-8", "replace")
+                    break
+            else:
+                self.strings[address] = None
+        return self.strings[address]
+
+    def format_id(self, identifier):
+        if self.anchor is None:
+            return None
+        return self.string(self.anchor + identifier)
+
+
+def _integer_size(image, length):
+    if length in ("ll", "j"): return 8
+    if length in ("l", "z", "t"): return image.long_size
+    return 4
+
+
+def _unpack(data, offset, size, signed):
+    value = int.from_bytes(data[offset:offset + size], "little", signed=signed)
+    return value, offset + size
+
+
+def format_record(image, fmt, args):
+    """Formats the arguments of a record like printf does"""
+    offset = 0
+    output = []
+    position = 0
+
+    def integer(size, signed):
+        nonlocal offset
+        if offset + size > len(args):
+            raise ValueError("Record is missing arguments")
+        value, offset = _unpack(args, offset, size, signed)
+        return value
+
+    for match in CONVERSION.finditer(fmt):
+        output.append(fmt[position:match.start()])
+        position = match.end()
+        flags, width, precision, length, conversion = match.groups()
+        if conversion == "%":
+            output.append("%")
+            continue
+        if width == "*":
+            width = str(integer(4, True))
+        if precision == "*":
+            precision = str(integer(4, True))
+        spec = "%" + flags + (width or "") + ("" if precision is None else "." + precision)
+
+        if conversion in "di":
+            value = integer(_integer_size(image, length), True)
+            output.append((spec + "d") % value)
+        elif conversion in "ouxX":
+            size = _integer_size(image, length)
+            value = integer(size, False)
+            # arguments were promoted, truncate them to the original type
+            if length == "hh": value &= 0xff
+            elif length == "h": value &= 0xffff
+            output.append((spec + conversion.replace("u", "d")) % value)
+        elif conversion in "eEfFgGaA":
+            size = image.double_size
+            if offset + size > len(args):
+                raise ValueError("Record is missing arguments")
+            value = struct.unpack_from("<d" if size == 8 else "<f", args, offset)[0]
+            offset += size
+            if conversion in "aA":
+                value = value.hex()
+                output.append((spec + "s") % (value.upper() if conversion == "A" else value))
+            else:
+                output.append((spec + conversion) % value)
+        elif conversion == "c":
+            output.append((spec + "c") % chr(integer(4, False) & 0xff))
+        elif conversion == "s":
+            end = args.find(b"\0", offset)
+            if end < 0:
+                raise ValueError("Record is missing arguments")
+            output.append((spec + "s") % args[offset:end].decode("utf-8", "replace"))
+            offset = end + 1
+        elif conversion == "p":
+            output.append("0x{:x}".format(integer(image.pointer_size, False)))
+        else:
+            raise ValueError("Unsupported conversion '%{}'".format(conversion))
+
+    output.append(fmt[position:])
+    return "".join(output)
+
+
+# -----------------------------------------------------------------------------
+class Decoder:
+    """Incrementally decodes a byte stream of text and binary records"""
+    def __init__(self, image, prefix=False):
+        self.image = image
+        self.prefix = prefix
+        self.buffer = bytearray()
+
+    def _header_size(self, sync):
+        if sync == SYNC_RTT:
+            return 2 + self.image.pointer_size
+        return HEADER_DEFERRED
+
+    @staticmethod
+    def _is_sync(byte):
+        return SYNC_DEFERRED <= byte < SYNC_DEFERRED + len(LEVELS) or byte == SYNC_RTT
+
+    def feed(self, data):
+        self.buffer += data
+        output = []
+        while self.buffer:
+            sync = self.buffer[0]
+            if not self._is_sync(sync):
+                # pass through text up to the next possible record
+                end = next((i for i, b in enumerate(self.buffer) if self._is_sync(b)),
+                           len(self.buffer))
+                output.append(self.buffer[:end].decode("utf-8", "replace"))
+                del self.buffer[:end]
+                continue
+
+            header = self._header_size(sync)
+            if len(self.buffer) < header or len(self.buffer) < header + self.buffer[1]:
+                break
+            args = bytes(self.buffer[header:header + self.buffer[1]])
+            if sync == SYNC_RTT:
+                fmt = self.image.string(int.from_bytes(self.buffer[2:header], "little"))
+                level = None
+            else:
+                fmt = self.image.format_id(int.from_bytes(self.buffer[2:header], "little", signed=True))
+                level = LEVELS[sync - SYNC_DEFERRED]
+
+            if fmt is None:
+                # not a valid record, pass the byte through instead
+                output.append(self.buffer[:1].decode("latin-1"))
+                del self.buffer[:1]
+                continue
+            del self.buffer[:header + len(args)]
+            try:
+                text = format_record(self.image, fmt, args)
+            except (ValueError, TypeError) as error:
+                text = "<{}: {!r}>\n".format(error, fmt)
+            if self.prefix and level is not None:
+                text = "[{}] {}".format(level, text)
+            output.append(text)
+        return "".join(output)
+
+
+def decode(elf, source, prefix=False):
+    decoder = Decoder(Image(elf), prefix)
+    with source:
+        while chunk := source.read1(4096) if hasattr(source, "read1") else source.read(4096):
+            yield decoder.feed(chunk)
+
+
+# -----------------------------------------------------------------------------
+if __name__ == "__main__":
+    import argparse, sys
+
+    parser = argparse.ArgumentParser(description="Decode deferred binary log records.")
+    parser.add_argument(
+            dest="elf",
+            metavar="ELF",
+            help="The image containing the format strings.")
+    parser.add_argument(
+            dest="source",
+            metavar="LOG",
+            help="The binary log file or '-' for stdin.")
+    parser.add_argument(
+            "--level",
+            dest="prefix",
+            action="store_true",
+            help="Prefix each record with its log level.")
+
+    args = parser.parse_args()
+    source = sys.stdin.buffer if args.source == "-" else open(args.source, "rb")
+    for text in decode(args.elf, source, args.prefix):
+        sys.stdout.write(text)
+        sys.stdout.flush()
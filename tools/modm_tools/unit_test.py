@@ -2,6 +2,7 @@
 # -*- coding: utf-8 -*-
 #
 # Copyright (c) 2020, Niklas Hauser
+# Copyright (c) 2026, modm authors
 #
 # This file is part of the modm project.
 #
@@ -31,6 +32,10 @@ public:
     void testCase1();
 }
 ```
+
+Besides `run_modm_unit_test()`, which runs all test suites in order, the runner
+also contains the `unittest::testSuites` table, so that a runner can execute
+each test suite on its own, for example in a separate process.
 """
 
 import re
@@ -43,6 +48,7 @@ from . import find_files
 # -----------------------------------------------------------------------------
 TEMPLATE_UNITTEST = r"""\
 #include <unittest/reporter.hpp>
+#include <unittest/testsuite.hpp>
 
 {% for test in tests %}
 #include "{{test.include}}"
@@ -50,35 +56,48 @@ TEMPLATE_UNITTEST = r"""\
 
 namespace
 {
-{% for test in tests -%}
+{% for test in tests %}
 FLASH_STORAGE_STRING({{test.instance}}Name) = "{{test.file[:-5]}}";
-{%- if functions %}
-{% for test_case in test.test_cases -%}
+{% if functions %}
+{% for test_case in test.test_cases %}
 FLASH_STORAGE_STRING({{test.instance}}_{{test_case}}Name) = "{{test_case[4:]}}";
-{% endfor -%}
-{% endif -%}
-{% endfor -%}
+{% endfor %}
+{% endif %}
+{% endfor %}
+{% for test in tests %}
+
+void run_{{test.instance}}()
+{
+    {{test.class}} {{test.instance}};
+{% for test_case in test.test_cases %}
+
+{% if functions %}
+    unittest::reporter.nextTestFunction(modm::accessor::asFlash({{test.instance}}_{{test_case}}Name));
+{% endif %}
+    {{test.instance}}.setUp();
+    {{test.instance}}.{{test_case}}();
+    {{test.instance}}.tearDown();
+{% endfor %}
 }
+{% endfor %}
+}
+
+const unittest::TestSuiteEntry unittest::testSuites[] =
+{
+{% for test in tests %}
+    { {{test.instance}}Name, run_{{test.instance}} },
+{% endfor %}
+};
+const std::size_t unittest::testSuiteCount = {{ tests | length }};
 
 int run_modm_unit_test()
 {
     using namespace modm::accessor;
 
-{% for test in tests -%}
+{% for test in tests %}
     unittest::reporter.nextTestSuite(asFlash({{test.instance}}Name));
-    {
-        {{test.class}} {{test.instance}};
-    {%- for test_case in test.test_cases %}
-
-    {% if functions -%}
-        unittest::reporter.nextTestFunction(asFlash({{test.instance}}_{{test_case}}Name));
-    {% endif -%}
-        {{test.instance}}.setUp();
-        {{test.instance}}.{{test_case}}();
-        {{test.instance}}.tearDown();
-    {% endfor -%}
-    }
-{%- endfor %}
+    run_{{test.instance}}();
+{% endfor %}
 
     return unittest::reporter.printSummary();
 }
@@ -116,7 +135,7 @@ def extract_tests(headers):
 
 def render_runner(headers, destination=None, functions=False):
     tests = extract_tests(headers)
-    content = Environment().from_string(TEMPLATE_UNITTEST)
+    content = Environment(trim_blocks=True, lstrip_blocks=True).from_string(TEMPLATE_UNITTEST)
     content = content.render({"tests": tests, "functions": functions})
 
     if destination is not None: